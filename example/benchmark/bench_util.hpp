@@ -0,0 +1,91 @@
+#pragma once
+
+// 네트워크 벤치마크 공용 도우미 (Linux)
+// - bench_server: 임의 포트(0)로 시작한 tcp_server 의 실제 포트
+// - null_buffer: 로그 출력을 버리는 스트림 버퍼
+// - raise_fd_limit / status_value / cpu_us: fd 한도, /proc/self/status 값, 프로세스 CPU 시간
+// - ms_since / wait_until: 경과 시간, 조건 대기
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <streambuf>
+#include <string>
+#include <thread>
+
+#include <j2_library/j2_library.hpp>
+
+#ifdef __linux__
+
+#include <sys/socket.h>
+#include <sys/resource.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+namespace j2_bench {
+
+    // 임의 포트(0)로 시작한 서버의 실제 포트
+    class bench_server : public j2::network::tcp::tcp_server {
+    public:
+        std::uint16_t port() const {
+            sockaddr_in addr{};
+            socklen_t len = sizeof(addr);
+            ::getsockname(server_socket, reinterpret_cast<sockaddr*>(&addr), &len);
+            return ntohs(addr.sin_port);
+        }
+    };
+
+    // 여러 스레드가 동시에 써도 되는 버림 전용 버퍼
+    class null_buffer : public std::streambuf {
+    protected:
+        int overflow(int c) override { return c; }
+    };
+
+    // 반환값: 올린 뒤의 fd 한도
+    inline std::size_t raise_fd_limit() {
+        rlimit rl{};
+        if (::getrlimit(RLIMIT_NOFILE, &rl) != 0) return 1024;
+        if (rl.rlim_cur < rl.rlim_max) {
+            rl.rlim_cur = rl.rlim_max;
+            ::setrlimit(RLIMIT_NOFILE, &rl);
+        }
+        return static_cast<std::size_t>(rl.rlim_cur);
+    }
+
+    // key 예: "Threads:", "VmRSS:" (kB)
+    inline long status_value(const std::string& key) {
+        std::ifstream in("/proc/self/status");
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.compare(0, key.size(), key) == 0) {
+                return std::strtol(line.c_str() + key.size(), nullptr, 10);
+            }
+        }
+        return 0;
+    }
+
+    // 프로세스 CPU 시간 (user+sys), us
+    inline double cpu_us() {
+        rusage ru{};
+        ::getrusage(RUSAGE_SELF, &ru);
+        return (ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) * 1e6 + (ru.ru_utime.tv_usec + ru.ru_stime.tv_usec);
+    }
+
+    inline double ms_since(std::chrono::steady_clock::time_point t0) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    template <typename Pred>
+    bool wait_until(Pred pred, int seconds = 30) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(seconds);
+        while (!pred()) {
+            if (std::chrono::steady_clock::now() > deadline) return false;
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        return true;
+    }
+
+} // namespace j2_bench
+
+#endif // __linux__
@@ -0,0 +1,176 @@
+// pub/sub 페이로드 벤치마크: 텍스트 json(dump/parse) vs MessagePack / CBOR (j2::json::encode/decode)
+//
+// pub/sub 예제의 Person 구조체를 메시지 하나로 보내는 경우와, Person 배열(한 번에 여러 건)을 보내는 경우를 측정한다.
+//  - bytes        : 메시지 1개의 페이로드 크기
+//  - encode ns    : Person -> json -> 페이로드 (텍스트는 dump, 바이너리는 재사용 버퍼에 encode)
+//  - decode ns    : 페이로드 -> json -> Person (텍스트는 parse, 바이너리는 decode)
+//
+// 사용법:
+//   j2_json_binary_benchmark [--iterations N] [--batch B] [--tags T] [--csv]
+//     --iterations : 형식별 반복 횟수 (기본: 100000, 배열은 1/B 배)
+//     --batch      : 배열 메시지의 Person 수 (기본: 100)
+//     --tags       : Person 당 태그 수 (기본: 3)
+//     --csv        : 결과를 CSV 로 출력
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+
+#include <j2_library/j2_library.hpp>
+
+#include "person.hpp"
+
+namespace {
+
+    using j2::json::binary_format;
+    using j2::json::nj;
+    using clock_type = std::chrono::steady_clock;
+
+    struct result {
+        std::string payload;
+        std::string format;
+        std::size_t bytes = 0;
+        double encodeNs = 0;
+        double decodeNs = 0;
+    };
+
+    // 컴파일러가 결과를 버리지 않도록 누적
+    volatile std::size_t g_sink = 0;
+
+    double elapsed_ns(clock_type::time_point start, std::size_t iterations) {
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - start).count();
+        return static_cast<double>(ns) / static_cast<double>(iterations);
+    }
+
+    template <class T>
+    result run_text(const std::string& payload, const T& value, std::size_t iterations) {
+        result r{ payload, "json-text" };
+        std::string text;
+
+        auto start = clock_type::now();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            text = nj(value).dump();
+            g_sink = g_sink + text.size();
+        }
+        r.encodeNs = elapsed_ns(start, iterations);
+        r.bytes = text.size();
+
+        start = clock_type::now();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            T back = nj::parse(text).get<T>();
+            g_sink = g_sink + sizeof(back);
+        }
+        r.decodeNs = elapsed_ns(start, iterations);
+        return r;
+    }
+
+    template <class T>
+    result run_binary(const std::string& payload, const T& value, binary_format format, std::size_t iterations) {
+        result r{ payload, format == binary_format::cbor ? "cbor" : "msgpack" };
+        std::vector<std::uint8_t> buffer; // 재사용 버퍼
+
+        auto start = clock_type::now();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            j2::json::encode_value(value, format, buffer);
+            g_sink = g_sink + buffer.size();
+        }
+        r.encodeNs = elapsed_ns(start, iterations);
+        r.bytes = buffer.size();
+
+        start = clock_type::now();
+        T back{};
+        for (std::size_t i = 0; i < iterations; ++i) {
+            if (!j2::json::decode_value(buffer.data(), buffer.size(), format, back)) {
+                std::cerr << "decode failed (" << r.format << ")" << std::endl;
+                std::exit(1);
+            }
+            g_sink = g_sink + sizeof(back);
+        }
+        r.decodeNs = elapsed_ns(start, iterations);
+        return r;
+    }
+
+    template <class T>
+    void run_all(std::vector<result>& results, const std::string& payload, const T& value, std::size_t iterations) {
+        results.push_back(run_text(payload, value, iterations));
+        results.push_back(run_binary(payload, value, binary_format::msgpack, iterations));
+        results.push_back(run_binary(payload, value, binary_format::cbor, iterations));
+    }
+
+    Person make_person(std::size_t index, std::size_t tags) {
+        Person p;
+        p.name = "Person " + std::to_string(index);
+        if (index % 4 != 0) p.age = static_cast<int>(20 + index % 50);
+        for (std::size_t t = 0; t < tags; ++t) {
+            p.tags.push_back("tag-" + std::to_string(t));
+        }
+        return p;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t iterations = 100000;
+    std::size_t batch = 100;
+    std::size_t tags = 3;
+    bool csv = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto next = [&]() -> std::size_t {
+            if (i + 1 >= argc) {
+                std::cerr << arg << " requires a value" << std::endl;
+                std::exit(1);
+            }
+            return static_cast<std::size_t>(std::strtoull(argv[++i], nullptr, 10));
+        };
+        if (arg == "--iterations") iterations = next();
+        else if (arg == "--batch") batch = next();
+        else if (arg == "--tags") tags = next();
+        else if (arg == "--csv") csv = true;
+        else {
+            std::cerr << "unknown option: " << arg << std::endl;
+            return 1;
+        }
+    }
+    if (iterations == 0 || batch == 0) {
+        std::cerr << "--iterations and --batch must be positive" << std::endl;
+        return 1;
+    }
+
+    std::vector<result> results;
+    run_all(results, "person", make_person(1, tags), iterations);
+
+    std::vector<Person> people;
+    for (std::size_t i = 0; i < batch; ++i) {
+        people.push_back(make_person(i, tags));
+    }
+    run_all(results, "person[" + std::to_string(batch) + "]", people, std::max<std::size_t>(1, iterations / batch));
+
+    if (csv) {
+        std::cout << "payload,format,bytes,encode_ns,decode_ns\n";
+        for (const auto& r : results) {
+            std::cout << r.payload << ',' << r.format << ',' << r.bytes << ','
+                << std::fixed << std::setprecision(1) << r.encodeNs << ',' << r.decodeNs << '\n';
+        }
+        return 0;
+    }
+
+    std::cout << std::left << std::setw(14) << "payload" << std::setw(11) << "format"
+        << std::right << std::setw(10) << "bytes" << std::setw(9) << "size %"
+        << std::setw(14) << "encode ns" << std::setw(14) << "decode ns" << '\n';
+    std::size_t text_bytes = 0;
+    for (const auto& r : results) {
+        if (r.format == "json-text") text_bytes = r.bytes;
+        std::cout << std::left << std::setw(14) << r.payload << std::setw(11) << r.format
+            << std::right << std::setw(10) << r.bytes
+            << std::setw(8) << std::fixed << std::setprecision(0) << (100.0 * r.bytes / text_bytes) << '%'
+            << std::setw(14) << std::setprecision(1) << r.encodeNs
+            << std::setw(14) << r.decodeNs << '\n';
+    }
+    return 0;
+}
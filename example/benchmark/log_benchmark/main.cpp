@@ -0,0 +1,267 @@
+// 로거 처리량/지연 시간 벤치마크
+//
+// logger_manager 를 싱크 조합(시나리오)별 INI 로 초기화한 뒤
+// 1, 2, 4 ... N 개 스레드에서 동시에 로깅하여 다음을 측정한다.
+//  - msgs/s      : 전체 메시지 수 / 경과 시간
+//  - p50/p99/p999: 로깅 호출 1회의 호출자 지연 (ns)
+//  - flush ms    : 측정 후 logger->flush() 소요 시간
+// 메시지는 info 이며 100 개마다 1 개는 warn 이다. (alerts 파일 싱크에 1% 가 기록됨)
+//
+// 사용법:
+//   j2_log_benchmark [--threads N] [--messages M] [--dir path] [--only name] [--csv]
+//     --threads  : 최대 스레드 수 (기본: 하드웨어 스레드 수)
+//     --messages : 스레드당 메시지 수 (기본: 100000)
+//     --dir      : 로그 파일을 기록할 임시 디렉터리 (기본: 시스템 임시 디렉터리)
+//     --only     : 지정한 시나리오만 실행
+//     --csv      : 결과를 CSV 로 출력
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <filesystem>
+#include <cstdlib>
+#include <cstdint>
+
+#include <spdlog/spdlog.h>
+
+#include <j2_library/j2_library.hpp>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+    struct scenario {
+        std::string name;
+        std::string description;
+        std::string ini; // 기본 설정 뒤에 덧붙일 INI 항목
+    };
+
+    struct result {
+        std::string scenario;
+        unsigned threads = 0;
+        std::uint64_t messages = 0;
+        double seconds = 0;
+        std::uint64_t p50 = 0;
+        std::uint64_t p99 = 0;
+        std::uint64_t p999 = 0;
+        std::uint64_t max = 0;
+        double flushMs = 0;
+    };
+
+    std::vector<scenario> make_scenarios() {
+        return {
+            { "all-file", "console off, all.log only",
+              "ENABLE_FILE_LOG_ALL=true\nENABLE_FILE_LOG_ALERTS=false\n" },
+            { "alerts-file", "console off, alerts.log only (warn+, 99% filtered)",
+              "ENABLE_FILE_LOG_ALL=false\nENABLE_FILE_LOG_ALERTS=true\n" },
+            { "dist", "console off, all.log + alerts.log via dist sink",
+              "ENABLE_FILE_LOG_ALL=true\nENABLE_FILE_LOG_ALERTS=true\n" },
+            { "dist-flush-warn", "dist, FLUSH_ON_LEVEL=warn",
+              "ENABLE_FILE_LOG_ALL=true\nENABLE_FILE_LOG_ALERTS=true\nFLUSH_ON_LEVEL=warn\n" },
+            { "dist-index", "dist, INDEX_ENABLE=true",
+              "ENABLE_FILE_LOG_ALL=true\nENABLE_FILE_LOG_ALERTS=true\nINDEX_ENABLE=true\n" },
+            { "dist-archive", "dist, ARCHIVE_ENABLE=true",
+              "ENABLE_FILE_LOG_ALL=true\nENABLE_FILE_LOG_ALERTS=true\nARCHIVE_ENABLE=true\n" },
+            { "all-flight", "all.log + flight recorder",
+              "ENABLE_FILE_LOG_ALL=true\nENABLE_FILE_LOG_ALERTS=false\nFLIGHT_RECORDER_ENABLE=true\n" },
+            { "all-net-udp", "all.log + network sink (UDP 127.0.0.1:9)",
+              "ENABLE_FILE_LOG_ALL=true\nENABLE_FILE_LOG_ALERTS=false\n"
+              "NET_SINK_ENABLE=true\nNET_SINK_HOST=127.0.0.1\nNET_SINK_PORT=9\nNET_SINK_LEVEL=trace\n" },
+        };
+    }
+
+    std::string write_ini(const fs::path& dir, const scenario& sc) {
+        std::ostringstream ss;
+        ss << "[Log]\n"
+            << "AUTO_RELOAD_SEC=0\n"
+            << "ENABLE_CONSOLE_LOG=false\n"
+            << "ALL_PATH=" << (dir / "all.log").generic_string() << "\n"
+            << "ALERTS_PATH=" << (dir / "alerts.log").generic_string() << "\n"
+            << "ALL_MAX_SIZE=100MB\nALL_MAX_FILES=3\n"
+            << "ALERT_MAX_SIZE=100MB\nALERT_MAX_FILES=3\n"
+            << "LOGGER_LEVEL=trace\nALL_FILE_LEVEL=trace\nALERTS_FILE_LEVEL=warn\n"
+            << "FLUSH_ON_LEVEL=critical\nFLUSH_EVERY_SEC=1\n"
+            << "DISK_GUARD_ENABLE=false\n"
+            << sc.ini;
+
+        const fs::path path = dir / "bench.ini";
+        std::ofstream out(path);
+        out << ss.str();
+        return path.string();
+    }
+
+    std::uint64_t percentile(std::vector<std::uint32_t>& v, double p) {
+        if (v.empty()) return 0;
+        std::size_t k = static_cast<std::size_t>(p * static_cast<double>(v.size() - 1));
+        std::nth_element(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(k), v.end());
+        return v[k];
+    }
+
+    result run_one(const scenario& sc, unsigned threads, std::uint64_t perThread, const fs::path& root) {
+        result r;
+        r.scenario = sc.name;
+        r.threads = threads;
+        r.messages = perThread * threads;
+
+        const fs::path dir = root / (sc.name + "-" + std::to_string(threads));
+        std::error_code ec;
+        fs::remove_all(dir, ec);
+        fs::create_directories(dir, ec);
+
+        const std::string loggerName = "j2_bench_" + sc.name + "_" + std::to_string(threads);
+        {
+            j2::log::logger_manager mgr;
+            if (!mgr.init(write_ini(dir, sc), "Log", loggerName)) {
+                std::cerr << "init failed: " << sc.name << "\n";
+                return r;
+            }
+            auto logger = mgr.getLogger();
+
+            std::vector<std::vector<std::uint32_t>> lat(threads);
+            std::atomic<unsigned> ready{ 0 };
+            std::atomic<bool> go{ false };
+            std::vector<std::thread> pool;
+
+            for (unsigned t = 0; t < threads; ++t) {
+                pool.emplace_back([&, t] {
+                    auto& mine = lat[t];
+                    mine.resize(static_cast<std::size_t>(perThread));
+                    ++ready;
+                    while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+
+                    for (std::uint64_t i = 0; i < perThread; ++i) {
+                        const auto t0 = std::chrono::steady_clock::now();
+                        if (i % 100 == 99) {
+                            logger->warn("bench warn seq={} thread={} value={:.3f}", i, t, 3.14159);
+                        }
+                        else {
+                            logger->info("bench info seq={} thread={} value={:.3f}", i, t, 3.14159);
+                        }
+                        const auto t1 = std::chrono::steady_clock::now();
+                        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+                        mine[static_cast<std::size_t>(i)] = static_cast<std::uint32_t>(
+                            std::min<long long>(ns, 0xFFFFFFFFLL));
+                    }
+                });
+            }
+
+            while (ready.load() < threads) std::this_thread::yield();
+            const auto start = std::chrono::steady_clock::now();
+            go.store(true, std::memory_order_release);
+            for (auto& th : pool) th.join();
+            const auto end = std::chrono::steady_clock::now();
+
+            const auto f0 = std::chrono::steady_clock::now();
+            logger->flush();
+            const auto f1 = std::chrono::steady_clock::now();
+
+            r.seconds = std::chrono::duration<double>(end - start).count();
+            r.flushMs = std::chrono::duration<double, std::milli>(f1 - f0).count();
+
+            std::vector<std::uint32_t> all;
+            all.reserve(static_cast<std::size_t>(r.messages));
+            for (auto& v : lat) all.insert(all.end(), v.begin(), v.end());
+            r.p50 = percentile(all, 0.50);
+            r.p99 = percentile(all, 0.99);
+            r.p999 = percentile(all, 0.999);
+            r.max = *std::max_element(all.begin(), all.end());
+
+            spdlog::drop(loggerName);
+        }
+
+        fs::remove_all(dir, ec);
+        return r;
+    }
+
+    void print_header(bool csv) {
+        if (csv) {
+            std::cout << "scenario,threads,messages,seconds,msgs_per_sec,p50_ns,p99_ns,p999_ns,max_ns,flush_ms\n";
+            return;
+        }
+        std::cout << std::left << std::setw(18) << "scenario"
+            << std::right << std::setw(8) << "threads"
+            << std::setw(14) << "msgs/s"
+            << std::setw(10) << "p50 ns"
+            << std::setw(10) << "p99 ns"
+            << std::setw(10) << "p999 ns"
+            << std::setw(12) << "max ns"
+            << std::setw(10) << "flush ms" << "\n";
+    }
+
+    void print_result(const result& r, bool csv) {
+        const double rate = r.seconds > 0 ? static_cast<double>(r.messages) / r.seconds : 0.0;
+        if (csv) {
+            std::cout << r.scenario << "," << r.threads << "," << r.messages << ","
+                << std::fixed << std::setprecision(6) << r.seconds << ","
+                << std::setprecision(0) << rate << ","
+                << r.p50 << "," << r.p99 << "," << r.p999 << "," << r.max << ","
+                << std::setprecision(3) << r.flushMs << "\n";
+            return;
+        }
+        std::cout << std::left << std::setw(18) << r.scenario
+            << std::right << std::setw(8) << r.threads
+            << std::setw(14) << std::fixed << std::setprecision(0) << rate
+            << std::setw(10) << r.p50
+            << std::setw(10) << r.p99
+            << std::setw(10) << r.p999
+            << std::setw(12) << r.max
+            << std::setw(10) << std::setprecision(2) << r.flushMs << "\n";
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::uint64_t perThread = 100000;
+    fs::path root = fs::temp_directory_path() / "j2_log_benchmark";
+    std::string only;
+    bool csv = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        if (a == "--threads" && i + 1 < argc) maxThreads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        else if (a == "--messages" && i + 1 < argc) perThread = std::strtoull(argv[++i], nullptr, 10);
+        else if (a == "--dir" && i + 1 < argc) root = argv[++i];
+        else if (a == "--only" && i + 1 < argc) only = argv[++i];
+        else if (a == "--csv") csv = true;
+        else {
+            std::cerr << "usage: j2_log_benchmark [--threads N] [--messages M] [--dir path] [--only name] [--csv]\n";
+            return 1;
+        }
+    }
+    if (maxThreads == 0) maxThreads = 1;
+    if (perThread == 0) perThread = 1;
+
+    std::vector<unsigned> threadCounts;
+    for (unsigned t = 1; t < maxThreads; t *= 2) threadCounts.push_back(t);
+    threadCounts.push_back(maxThreads);
+
+    const auto scenarios = make_scenarios();
+    if (!csv) {
+        std::cout << "messages per thread: " << perThread << ", log dir: " << root.string() << "\n";
+        for (const auto& sc : scenarios) {
+            if (!only.empty() && sc.name != only) continue;
+            std::cout << "  " << std::left << std::setw(18) << sc.name << sc.description << "\n";
+        }
+        std::cout << "\n";
+    }
+
+    print_header(csv);
+    for (const auto& sc : scenarios) {
+        if (!only.empty() && sc.name != only) continue;
+        for (unsigned t : threadCounts) {
+            print_result(run_one(sc, t, perThread, root), csv);
+        }
+    }
+
+    std::error_code ec;
+    fs::remove_all(root, ec);
+    return 0;
+}
@@ -0,0 +1,510 @@
+// tcp/udp 루프백 네트워크 벤치마크 (tcp_server/tcp_client, udp_sender/udp_receiver)
+//
+// 같은 프로세스에서 서버(수신기)와 클라이언트(송신기)를 loopback 으로 연결하고 시나리오별로 측정한다.
+//  - tcp-stream  : 연결 C 개가 길이 접두 프레임(크기 S)을 D 초 동안 최대 속도로 보냄 (Epoll 서버)
+//  - tcp-rtt     : 연결 C 개가 각자 ping-pong (보내고 echo 를 받은 뒤 다음), 왕복 지연 백분위
+//  - udp-send    : 송신 스레드 C 개가 udp_thread_sender::send_data 로 데이터그램 1 개씩
+//  - udp-batch   : 송신 스레드 C 개가 send_batch(64 개, sendmmsg) 로
+//  - udp-latency : --rate 로 일정하게 보낸 데이터그램의 단방향 지연 (페이로드의 송신 시각 -> 수신 콜백)
+//                  과 커널 수신 -> 콜백 대기 시간 (SO_TIMESTAMPNS)
+//
+// 출력 항목:
+//  msgs        : 받은 메시지 수 (udp: 받은 데이터그램, tcp-rtt: 왕복 수)
+//  MB/s, msg/s : 받은 쪽 기준 처리량
+//  cpu us/msg  : 측정 구간 프로세스 CPU 시간(user+sys) / 받은 메시지 수 (송수신 양쪽 몫 포함)
+//  loss %      : udp 보낸 것 대비 못 받은 비율
+//  p50/p99/p99.9/max us : 지연 백분위 (tcp-rtt: 왕복, udp-latency: 단방향), 그 외 시나리오는 0
+//  queue p99 us: udp-latency 의 커널 -> 콜백 대기 p99
+//
+// 사용법:
+//   j2_network_loopback_benchmark [--scenario NAME[,NAME...]|all] [--sizes S[,S...]] [--conns C[,C...]]
+//                                 [--duration SEC] [--rate MSG_PER_SEC] [--csv|--json]
+//     --scenario : 위 시나리오 이름 목록 (기본: all)
+//     --sizes    : 메시지 크기 목록, 바이트 (기본: 64,1024; udp 는 65507 까지)
+//     --conns    : 연결/송신 스레드 수 목록 (기본: 1,4; udp-latency 는 항상 1)
+//     --duration : 시나리오당 측정 시간 초 (기본: 2)
+//     --rate     : udp-latency 송신 속도 (기본: 10000 msg/s)
+//     --csv      : 결과를 CSV 로 출력
+//     --json     : 결과를 한 줄에 JSON 객체 하나씩 출력
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <streambuf>
+
+#include <j2_library/j2_library.hpp>
+
+#include "bench_util.hpp"
+
+#ifdef __linux__
+
+#include <sys/socket.h>
+#include <sys/resource.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+namespace {
+
+    using j2::network::latency_histogram;
+    using j2::network::socket_options;
+    using j2::network::tcp::framing;
+    using j2::network::tcp::tcp_client;
+    using j2::network::tcp::tcp_server;
+    using j2::network::udp::datagram_batch;
+    using j2::network::udp::send_buffer;
+    using j2::network::udp::udp_receiver;
+    using j2::network::udp::udp_thread_sender;
+    using j2_bench::bench_server;
+    using j2_bench::cpu_us;
+    using j2_bench::null_buffer;
+    using j2_bench::wait_until;
+
+    struct result {
+        std::string scenario;
+        std::size_t size = 0;
+        std::size_t conns = 0;
+        double seconds = 0;
+        std::uint64_t msgs = 0;
+        double mbPerSec = 0;
+        double msgsPerSec = 0;
+        double cpuUsPerMsg = 0;
+        double lossPct = 0;
+        double p50Us = 0;
+        double p99Us = 0;
+        double p999Us = 0;
+        double maxUs = 0;
+        double queueP99Us = 0;
+    };
+
+    std::int64_t wall_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    // 처리량/CPU 항목 채우기
+    void finish(result& r, std::uint64_t msgs, double seconds, double cpu) {
+        r.msgs = msgs;
+        r.seconds = seconds;
+        if (seconds > 0) {
+            r.msgsPerSec = static_cast<double>(msgs) / seconds;
+            r.mbPerSec = static_cast<double>(msgs) * static_cast<double>(r.size) / seconds / (1024.0 * 1024.0);
+        }
+        r.cpuUsPerMsg = msgs > 0 ? cpu / static_cast<double>(msgs) : 0;
+    }
+
+    void fill_latency(result& r, const latency_histogram& h) {
+        r.p50Us = static_cast<double>(h.percentile(0.50)) / 1e3;
+        r.p99Us = static_cast<double>(h.percentile(0.99)) / 1e3;
+        r.p999Us = static_cast<double>(h.percentile(0.999)) / 1e3;
+        r.maxUs = static_cast<double>(h.max()) / 1e3;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // TCP
+
+    // Epoll 서버 + 길이 접두 프레임 tcp_client C 개. echo 가 true 면 서버가 받은 메시지를 되돌려줌.
+    struct tcp_fixture {
+        bench_server server;
+        std::vector<std::unique_ptr<tcp_client>> clients;
+        std::atomic<std::uint64_t> serverMsgs{ 0 };
+        std::vector<std::unique_ptr<std::atomic<std::uint64_t>>> echoes; // 클라이언트별 받은 echo 수
+        null_buffer sink;
+        std::streambuf* saved = nullptr;
+
+        bool start(std::size_t conns, bool echo) {
+            const framing f = framing::length_prefix();
+            server.setBackend(tcp_server::Backend::Epoll);
+            server.setSocketOptions(socket_options::low_latency());
+            server.setFraming(f);
+            server.setOnMessageCallback([this, echo, f](int fd, std::string_view msg) {
+                serverMsgs.fetch_add(1, std::memory_order_relaxed);
+                if (echo) {
+                    std::string out;
+                    f.encode(out, msg);
+                    server.sendToClient(fd, out);
+                }
+                });
+            if (server.start("127.0.0.1", 0) != tcp_server::StartResult::Success) {
+                std::cerr << "server start failed\n";
+                return false;
+            }
+
+            // tcp_client 는 접속 시도마다 stdout 에 출력하므로 측정 중에는 버림
+            saved = std::cout.rdbuf(&sink);
+            std::atomic<std::size_t> connects{ 0 };
+            for (std::size_t i = 0; i < conns; ++i) {
+                auto c = std::make_unique<tcp_client>(socket_options::low_latency());
+                auto counter = std::make_unique<std::atomic<std::uint64_t>>(0);
+                auto* n = counter.get();
+                c->setServer("127.0.0.1", server.port());
+                c->set_framing(f);
+                c->set_on_connect([&connects] { ++connects; });
+                c->set_on_message([n](std::string_view) { n->fetch_add(1, std::memory_order_release); });
+                c->start();
+                clients.push_back(std::move(c));
+                echoes.push_back(std::move(counter));
+            }
+            const bool ok = wait_until([&] { return connects.load() >= conns && server.getClientCount() >= conns; }, 10);
+            if (!ok) std::cerr << "connect failed\n";
+            return ok;
+        }
+
+        ~tcp_fixture() {
+            for (auto& c : clients) c->stop();
+            if (saved != nullptr) std::cout.rdbuf(saved);
+            server.quit();
+        }
+    };
+
+    result tcp_stream(std::size_t size, std::size_t conns, double duration) {
+        result r{ "tcp-stream", size, conns };
+        tcp_fixture fx;
+        if (!fx.start(conns, false)) return r;
+
+        std::string frame;
+        framing::length_prefix().encode(frame, std::string(size, 'x'));
+
+        std::atomic<bool> running{ true };
+        std::atomic<std::uint64_t> sent{ 0 };
+        const double cpu0 = cpu_us();
+        const auto t0 = std::chrono::steady_clock::now();
+        std::vector<std::thread> senders;
+        for (auto& c : fx.clients) {
+            senders.emplace_back([&, client = c.get()] {
+                while (running.load(std::memory_order_relaxed)) {
+                    if (client->send_data(frame) != static_cast<int>(frame.size())) break;
+                    sent.fetch_add(1, std::memory_order_relaxed);
+                }
+                });
+        }
+        std::this_thread::sleep_for(std::chrono::duration<double>(duration));
+        running = false;
+        for (auto& t : senders) t.join();
+        wait_until([&] { return fx.serverMsgs.load() >= sent.load(); }, 10);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        finish(r, fx.serverMsgs.load(), seconds, cpu_us() - cpu0);
+        return r;
+    }
+
+    result tcp_rtt(std::size_t size, std::size_t conns, double duration) {
+        result r{ "tcp-rtt", size, conns };
+        tcp_fixture fx;
+        if (!fx.start(conns, true)) return r;
+
+        std::string frame;
+        framing::length_prefix().encode(frame, std::string(size, 'p'));
+
+        latency_histogram rtt;
+        std::atomic<std::uint64_t> rounds{ 0 };
+        const double cpu0 = cpu_us();
+        const auto t0 = std::chrono::steady_clock::now();
+        const auto end = t0 + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(duration));
+        std::vector<std::thread> pingers;
+        for (std::size_t i = 0; i < fx.clients.size(); ++i) {
+            pingers.emplace_back([&, i] {
+                auto& client = *fx.clients[i];
+                auto& echoed = *fx.echoes[i];
+                std::uint64_t expected = echoed.load();
+                while (std::chrono::steady_clock::now() < end) {
+                    const auto s = std::chrono::steady_clock::now();
+                    if (client.send_data(frame) != static_cast<int>(frame.size())) break;
+                    ++expected;
+                    while (echoed.load(std::memory_order_acquire) < expected) {
+                        if (std::chrono::steady_clock::now() > end + std::chrono::seconds(5)) return;
+                        std::this_thread::yield();
+                    }
+                    rtt.record(static_cast<std::uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s).count()));
+                    rounds.fetch_add(1, std::memory_order_relaxed);
+                }
+                });
+        }
+        for (auto& t : pingers) t.join();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        finish(r, rounds.load(), seconds, cpu_us() - cpu0);
+        fill_latency(r, rtt);
+        return r;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // UDP
+
+    struct udp_fixture {
+        udp_receiver receiver;
+        std::atomic<std::uint64_t> received{ 0 };
+
+        bool start(bool timestamps, udp_receiver::BatchCallback extra = nullptr) {
+            socket_options opts;
+            opts.receive_buffer = 8 * 1024 * 1024;
+            receiver.setSocketOptions(opts);
+            receiver.setBatchMode(64, udp_receiver::MAX_DATAGRAM_SIZE);
+            receiver.setEnableKernelTimestamps(timestamps);
+            receiver.setOnBatchCallback([this, extra](const datagram_batch& batch) {
+                received.fetch_add(batch.size(), std::memory_order_relaxed);
+                if (extra) extra(batch);
+                });
+            if (!receiver.startUnicast("127.0.0.1", 0)) {
+                std::cerr << "receiver start failed\n";
+                return false;
+            }
+            return true;
+        }
+    };
+
+    result udp_stream(bool batched, std::size_t size, std::size_t conns, double duration) {
+        result r{ batched ? "udp-batch" : "udp-send", size, conns };
+        udp_fixture fx;
+        if (!fx.start(false)) return r;
+        const std::uint16_t port = fx.receiver.getLocalPort();
+
+        std::atomic<bool> running{ true };
+        std::atomic<std::uint64_t> sent{ 0 };
+        const double cpu0 = cpu_us();
+        const auto t0 = std::chrono::steady_clock::now();
+        std::vector<std::thread> senders;
+        for (std::size_t c = 0; c < conns; ++c) {
+            senders.emplace_back([&] {
+                udp_thread_sender sender;
+                sender.setServer("127.0.0.1", port);
+                if (!sender.create()) return;
+                const std::string payload(size, 'u');
+                std::vector<send_buffer> batch(64, send_buffer{ payload.data(), payload.size() });
+                std::uint64_t local = 0;
+                while (running.load(std::memory_order_relaxed)) {
+                    if (batched) {
+                        const int n = sender.send_batch(batch);
+                        if (n > 0) local += static_cast<std::uint64_t>(n);
+                    }
+                    else if (sender.send_data(payload) == static_cast<ssize_t>(payload.size())) {
+                        ++local;
+                    }
+                }
+                sent += local;
+                });
+        }
+        std::this_thread::sleep_for(std::chrono::duration<double>(duration));
+        running = false;
+        for (auto& t : senders) t.join();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        // 수신 버퍼에 남은 것까지 (더 늘지 않을 때까지)
+        std::uint64_t last = 0;
+        do {
+            last = fx.received.load();
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        } while (fx.received.load() != last);
+        const double cpu = cpu_us() - cpu0;
+        fx.receiver.quit();
+
+        finish(r, fx.received.load(), seconds, cpu);
+        if (sent.load() > 0) {
+            r.lossPct = 100.0 * static_cast<double>(sent.load() - std::min(sent.load(), fx.received.load())) /
+                static_cast<double>(sent.load());
+        }
+        return r;
+    }
+
+    result udp_latency(std::size_t size, double duration, double rate) {
+        result r{ "udp-latency", std::max<std::size_t>(size, sizeof(std::int64_t)), 1 };
+        latency_histogram oneWay;
+        udp_fixture fx;
+        const bool ok = fx.start(true, [&oneWay](const datagram_batch& batch) {
+            const std::int64_t now = wall_ns();
+            for (const auto& d : batch) {
+                if (d.size < sizeof(std::int64_t)) continue;
+                std::int64_t sentAt = 0;
+                std::memcpy(&sentAt, d.data, sizeof(sentAt));
+                oneWay.record(static_cast<std::uint64_t>(std::max<std::int64_t>(0, now - sentAt)));
+            }
+            });
+        if (!ok) return r;
+
+        udp_thread_sender sender;
+        sender.setServer("127.0.0.1", fx.receiver.getLocalPort());
+        if (!sender.create()) return r;
+
+        std::string payload(r.size, 'l');
+        const auto gap = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(1.0 / std::max(rate, 1.0)));
+        std::uint64_t sent = 0;
+        const double cpu0 = cpu_us();
+        const auto t0 = std::chrono::steady_clock::now();
+        const auto end = t0 + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(duration));
+        for (auto next = t0; next < end; next += gap) {
+            // 정해진 시각까지 회전 대기 (sleep 의 깨어남 지연이 측정에 섞이지 않도록)
+            while (std::chrono::steady_clock::now() < next) {
+            }
+            const std::int64_t now = wall_ns();
+            std::memcpy(payload.data(), &now, sizeof(now));
+            if (sender.send_data(payload) == static_cast<ssize_t>(payload.size())) ++sent;
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        wait_until([&] { return fx.received.load() >= sent; }, 1);
+        const double cpu = cpu_us() - cpu0;
+        fx.receiver.quit();
+
+        finish(r, fx.received.load(), seconds, cpu);
+        if (sent > 0) {
+            r.lossPct = 100.0 * static_cast<double>(sent - std::min(sent, fx.received.load())) / static_cast<double>(sent);
+        }
+        fill_latency(r, oneWay);
+        r.queueP99Us = static_cast<double>(fx.receiver.getKernelDelayHistogram().percentile(0.99)) / 1e3;
+        return r;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // 출력
+
+    enum class format { table, csv, json };
+
+    void print_header(format fmt) {
+        if (fmt == format::json) return;
+        if (fmt == format::csv) {
+            std::cout << "scenario,size,conns,seconds,msgs,mb_per_s,msgs_per_s,cpu_us_per_msg,loss_pct,"
+                "p50_us,p99_us,p999_us,max_us,queue_p99_us\n";
+            return;
+        }
+        std::cout << std::left << std::setw(12) << "scenario"
+            << std::right << std::setw(7) << "size"
+            << std::setw(6) << "conns"
+            << std::setw(11) << "msgs"
+            << std::setw(10) << "MB/s"
+            << std::setw(11) << "msg/s"
+            << std::setw(11) << "cpu us/msg"
+            << std::setw(8) << "loss %"
+            << std::setw(9) << "p50 us"
+            << std::setw(9) << "p99 us"
+            << std::setw(10) << "p99.9 us"
+            << std::setw(9) << "max us"
+            << std::setw(10) << "queue p99" << "\n";
+    }
+
+    void print_result(const result& r, format fmt) {
+        if (fmt == format::csv) {
+            std::cout << r.scenario << "," << r.size << "," << r.conns << ","
+                << std::fixed << std::setprecision(3) << r.seconds << "," << r.msgs << ","
+                << r.mbPerSec << "," << r.msgsPerSec << "," << r.cpuUsPerMsg << "," << r.lossPct << ","
+                << r.p50Us << "," << r.p99Us << "," << r.p999Us << "," << r.maxUs << "," << r.queueP99Us << "\n";
+            return;
+        }
+        if (fmt == format::json) {
+            std::cout << std::fixed << std::setprecision(3)
+                << "{\"scenario\":\"" << r.scenario << "\",\"size\":" << r.size << ",\"conns\":" << r.conns
+                << ",\"seconds\":" << r.seconds << ",\"msgs\":" << r.msgs
+                << ",\"mb_per_s\":" << r.mbPerSec << ",\"msgs_per_s\":" << r.msgsPerSec
+                << ",\"cpu_us_per_msg\":" << r.cpuUsPerMsg << ",\"loss_pct\":" << r.lossPct
+                << ",\"p50_us\":" << r.p50Us << ",\"p99_us\":" << r.p99Us << ",\"p999_us\":" << r.p999Us
+                << ",\"max_us\":" << r.maxUs << ",\"queue_p99_us\":" << r.queueP99Us << "}\n";
+            return;
+        }
+        std::cout << std::left << std::setw(12) << r.scenario
+            << std::right << std::setw(7) << r.size
+            << std::setw(6) << r.conns
+            << std::setw(11) << r.msgs
+            << std::fixed << std::setprecision(1)
+            << std::setw(10) << r.mbPerSec
+            << std::setw(11) << std::setprecision(0) << r.msgsPerSec
+            << std::setw(11) << std::setprecision(3) << r.cpuUsPerMsg
+            << std::setw(8) << std::setprecision(2) << r.lossPct
+            << std::setprecision(1)
+            << std::setw(9) << r.p50Us
+            << std::setw(9) << r.p99Us
+            << std::setw(10) << r.p999Us
+            << std::setw(9) << r.maxUs
+            << std::setw(10) << r.queueP99Us << "\n";
+    }
+
+    std::vector<std::size_t> parse_list(const char* arg) {
+        std::vector<std::size_t> out;
+        std::stringstream ss(arg);
+        std::string item;
+        while (std::getline(ss, item, ',')) out.push_back(std::strtoull(item.c_str(), nullptr, 10));
+        return out;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::vector<std::string> allScenarios = { "tcp-stream", "tcp-rtt", "udp-send", "udp-batch", "udp-latency" };
+    std::vector<std::string> scenarios = allScenarios;
+    std::vector<std::size_t> sizes = { 64, 1024 };
+    std::vector<std::size_t> conns = { 1, 4 };
+    double duration = 2.0;
+    double rate = 10000.0;
+    format fmt = format::table;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        if (a == "--scenario" && i + 1 < argc) {
+            std::string list = argv[++i];
+            if (list != "all") {
+                scenarios.clear();
+                std::stringstream ss(list);
+                std::string item;
+                while (std::getline(ss, item, ',')) scenarios.push_back(item);
+            }
+        }
+        else if (a == "--sizes" && i + 1 < argc) sizes = parse_list(argv[++i]);
+        else if (a == "--conns" && i + 1 < argc) conns = parse_list(argv[++i]);
+        else if (a == "--duration" && i + 1 < argc) duration = std::strtod(argv[++i], nullptr);
+        else if (a == "--rate" && i + 1 < argc) rate = std::strtod(argv[++i], nullptr);
+        else if (a == "--csv") fmt = format::csv;
+        else if (a == "--json") fmt = format::json;
+        else {
+            std::cerr << "usage: j2_network_loopback_benchmark [--scenario NAME[,NAME...]|all] [--sizes S[,S...]]"
+                " [--conns C[,C...]] [--duration SEC] [--rate MSG_PER_SEC] [--csv|--json]\n"
+                "  scenarios: tcp-stream, tcp-rtt, udp-send, udp-batch, udp-latency\n";
+            return 1;
+        }
+    }
+    for (const auto& s : scenarios) {
+        if (std::find(allScenarios.begin(), allScenarios.end(), s) == allScenarios.end()) {
+            std::cerr << "unknown scenario: " << s << "\n";
+            return 1;
+        }
+    }
+
+    if (fmt == format::table) {
+        std::cout << "duration: " << duration << " s per run, hardware threads: "
+            << std::thread::hardware_concurrency() << "\n\n";
+    }
+    print_header(fmt);
+    for (const auto& s : scenarios) {
+        for (std::size_t size : sizes) {
+            if (s.rfind("udp", 0) == 0 && size > 65507) {
+                std::cerr << "skipping " << s << " size " << size << " (> 65507)\n";
+                continue;
+            }
+            if (s == "udp-latency") {
+                print_result(udp_latency(size, duration, rate), fmt);
+                continue;
+            }
+            for (std::size_t c : conns) {
+                c = std::max<std::size_t>(c, 1);
+                if (s == "tcp-stream") print_result(tcp_stream(size, c, duration), fmt);
+                else if (s == "tcp-rtt") print_result(tcp_rtt(size, c, duration), fmt);
+                else if (s == "udp-send") print_result(udp_stream(false, size, c, duration), fmt);
+                else if (s == "udp-batch") print_result(udp_stream(true, size, c, duration), fmt);
+            }
+        }
+    }
+    return 0;
+}
+
+#else // !__linux__
+
+int main() {
+    std::cerr << "j2_network_loopback_benchmark requires Linux (sendmmsg, SO_TIMESTAMPNS, getrusage)\n";
+    return 0;
+}
+
+#endif // __linux__
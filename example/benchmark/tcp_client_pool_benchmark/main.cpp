@@ -0,0 +1,296 @@
+// tcp_client N 개 vs tcp_client_pool 벤치마크 (연결당 스레드 vs 단일 이벤트 루프)
+//
+// loopback 으로 Epoll tcp_server(echo) 를 띄우고 같은 프로세스에서 N 개의 아웃바운드 연결을 만든 뒤 측정한다.
+//  - connect ms : N 개 연결이 모두 on_connect 될 때까지
+//  - threads    : 연결 유지 중 프로세스 스레드 수 (/proc/self/status, 서버 루프 포함)
+//  - rss MB     : 연결 유지 중 증가한 RSS
+//  - echo ms    : 모든 연결이 32 바이트를 보내고 echo 를 모두 받을 때까지 (라운드 평균)
+//  - cpu us/msg : echo 라운드 동안 프로세스 CPU 시간(user+sys) / 메시지 수 (서버 몫 포함, 양쪽 동일)
+//  - stop ms    : stop() 으로 전체 연결을 닫을 때까지 (tcp_client 는 병렬로 stop, 재접속 대기 1초 포함)
+//
+// 사용법:
+//   j2_tcp_client_pool_benchmark [--clients N[,N...]] [--mode clients|pool|all] [--rounds R]
+//                                [--thread-max M] [--csv]
+//     --clients    : 연결 수 목록 (기본: 100,1000)
+//     --mode       : clients = tcp_client N 개, pool = tcp_client_pool 1 개 (기본: all)
+//     --rounds     : echo 라운드 수 (기본: 20)
+//     --thread-max : tcp_client 방식을 측정할 최대 연결 수 (기본: 2000, 스레드 생성 한도 보호)
+//     --csv        : 결과를 CSV 로 출력
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+#include <streambuf>
+
+#include <j2_library/j2_library.hpp>
+
+#include "bench_util.hpp"
+
+#ifdef __linux__
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+namespace {
+
+    using j2::network::tcp::tcp_server;
+    using j2::network::tcp::tcp_client;
+    using j2::network::tcp::tcp_client_pool;
+    using j2_bench::bench_server;
+    using j2_bench::cpu_us;
+    using j2_bench::ms_since;
+    using j2_bench::null_buffer;
+    using j2_bench::raise_fd_limit;
+    using j2_bench::status_value;
+    using j2_bench::wait_until;
+
+    struct result {
+        std::string mode;
+        std::size_t clients = 0;
+        std::size_t connected = 0;
+        double connectMs = 0;
+        long threads = 0;
+        double rssMb = 0;
+        double echoMs = 0;
+        double cpuUsPerMsg = 0;
+        double stopMs = 0;
+    };
+
+    // 클라이언트 쪽 공통 인터페이스 (측정 대상 두 방식)
+    class client_set {
+    public:
+        virtual ~client_set() = default;
+        virtual void start(std::uint16_t port, std::size_t count, std::atomic<std::size_t>& connects,
+            std::atomic<std::size_t>& bytes) = 0;
+        virtual bool send_all(const std::string& msg) = 0;
+        virtual void stop() = 0;
+    };
+
+    class thread_clients : public client_set {
+    public:
+        void start(std::uint16_t port, std::size_t count, std::atomic<std::size_t>& connects,
+            std::atomic<std::size_t>& bytes) override {
+            for (std::size_t i = 0; i < count; ++i) {
+                auto c = std::make_unique<tcp_client>();
+                c->setServer("127.0.0.1", port);
+                c->set_on_connect([&] { ++connects; });
+                c->set_on_receive([&](const std::string& msg) { bytes += msg.size(); });
+                c->start();
+                clients.push_back(std::move(c));
+            }
+        }
+        bool send_all(const std::string& msg) override {
+            for (auto& c : clients) {
+                if (c->send_data(msg) != static_cast<int>(msg.size())) return false;
+            }
+            return true;
+        }
+        // stop() 은 재접속 대기(1초)가 끝나야 반환하므로 병렬로 멈춤
+        void stop() override {
+            std::vector<std::thread> stoppers;
+            stoppers.reserve(clients.size());
+            for (auto& c : clients) stoppers.emplace_back([&c] { c->stop(); });
+            for (auto& t : stoppers) t.join();
+        }
+
+    private:
+        std::vector<std::unique_ptr<tcp_client>> clients;
+    };
+
+    class pool_clients : public client_set {
+    public:
+        void start(std::uint16_t port, std::size_t count, std::atomic<std::size_t>& connects,
+            std::atomic<std::size_t>& bytes) override {
+            for (std::size_t i = 0; i < count; ++i) {
+                const int id = pool.add("127.0.0.1", port);
+                pool.set_on_connect(id, [&] { ++connects; });
+                pool.set_on_receive(id, [&](const std::string& msg) { bytes += msg.size(); });
+                ids.push_back(id);
+            }
+            pool.start();
+        }
+        bool send_all(const std::string& msg) override {
+            for (int id : ids) {
+                if (pool.send_data(id, msg) != static_cast<int>(msg.size())) return false;
+            }
+            return true;
+        }
+        void stop() override {
+            pool.stop();
+        }
+
+    private:
+        tcp_client_pool pool;
+        std::vector<int> ids;
+    };
+
+    result run_one(bool usePool, std::size_t count, unsigned rounds) {
+        result r;
+        r.mode = usePool ? "pool" : "clients";
+        r.clients = count;
+
+        bench_server server;
+        server.setBackend(tcp_server::Backend::Epoll);
+        server.setOnReceiveCallback([&](int fd, const std::string& msg) { server.sendToClient(fd, msg); });
+        if (server.start("127.0.0.1", 0) != tcp_server::StartResult::Success) {
+            std::cerr << "server start failed\n";
+            return r;
+        }
+
+        const long rssBefore = status_value("VmRSS:");
+        std::atomic<std::size_t> connects{ 0 };
+        std::atomic<std::size_t> bytes{ 0 };
+        std::unique_ptr<client_set> clients;
+        if (usePool) clients = std::make_unique<pool_clients>();
+        else clients = std::make_unique<thread_clients>();
+
+        // tcp_client 는 접속 시도마다 stdout 에 출력하므로 측정 중에는 버림
+        null_buffer sink;
+        std::streambuf* saved = std::cout.rdbuf(&sink);
+
+        auto t0 = std::chrono::steady_clock::now();
+        clients->start(server.port(), count, connects, bytes);
+        wait_until([&] { return connects.load() >= count && server.getClientCount() >= count; });
+        r.connectMs = ms_since(t0);
+        r.connected = connects.load();
+        r.threads = status_value("Threads:");
+        r.rssMb = static_cast<double>(status_value("VmRSS:") - rssBefore) / 1024.0;
+
+        static const std::string msg = "j2-tcp-client-pool-benchmark-msg";
+        const double cpu0 = cpu_us();
+        double echoTotal = 0;
+        unsigned done = 0;
+        for (; done < rounds; ++done) {
+            const std::size_t expected = bytes.load() + count * msg.size();
+            t0 = std::chrono::steady_clock::now();
+            if (!clients->send_all(msg) || !wait_until([&] { return bytes.load() >= expected; }, 10)) {
+                std::cerr << "echo round failed\n";
+                break;
+            }
+            echoTotal += ms_since(t0);
+        }
+        const double cpu = cpu_us() - cpu0;
+        r.echoMs = done > 0 ? echoTotal / done : 0;
+        r.cpuUsPerMsg = done > 0 ? cpu / (static_cast<double>(done) * count) : 0;
+
+        t0 = std::chrono::steady_clock::now();
+        clients->stop();
+        r.stopMs = ms_since(t0);
+        std::cout.rdbuf(saved);
+
+        clients.reset();
+        server.quit();
+        return r;
+    }
+
+    void print_header(bool csv) {
+        if (csv) {
+            std::cout << "mode,clients,connected,connect_ms,threads,rss_mb,echo_ms,cpu_us_per_msg,stop_ms\n";
+            return;
+        }
+        std::cout << std::left << std::setw(9) << "mode"
+            << std::right << std::setw(9) << "clients"
+            << std::setw(12) << "connect ms"
+            << std::setw(9) << "threads"
+            << std::setw(9) << "rss MB"
+            << std::setw(10) << "echo ms"
+            << std::setw(12) << "cpu us/msg"
+            << std::setw(10) << "stop ms" << "\n";
+    }
+
+    void print_result(const result& r, bool csv) {
+        if (csv) {
+            std::cout << r.mode << "," << r.clients << "," << r.connected << ","
+                << std::fixed << std::setprecision(3) << r.connectMs << "," << r.threads << ","
+                << r.rssMb << "," << r.echoMs << "," << r.cpuUsPerMsg << "," << r.stopMs << "\n";
+            return;
+        }
+        std::cout << std::left << std::setw(9) << r.mode
+            << std::right << std::setw(9) << r.connected
+            << std::fixed << std::setprecision(1)
+            << std::setw(12) << r.connectMs
+            << std::setw(9) << r.threads
+            << std::setw(9) << r.rssMb
+            << std::setw(10) << std::setprecision(2) << r.echoMs
+            << std::setw(12) << r.cpuUsPerMsg
+            << std::setw(10) << std::setprecision(1) << r.stopMs << "\n";
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> counts = { 100, 1000 };
+    std::string mode = "all";
+    unsigned rounds = 20;
+    std::size_t threadMax = 2000;
+    bool csv = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        if (a == "--clients" && i + 1 < argc) {
+            counts.clear();
+            std::stringstream ss(argv[++i]);
+            std::string item;
+            while (std::getline(ss, item, ',')) counts.push_back(std::strtoull(item.c_str(), nullptr, 10));
+        }
+        else if (a == "--mode" && i + 1 < argc) mode = argv[++i];
+        else if (a == "--rounds" && i + 1 < argc) rounds = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        else if (a == "--thread-max" && i + 1 < argc) threadMax = std::strtoull(argv[++i], nullptr, 10);
+        else if (a == "--csv") csv = true;
+        else {
+            std::cerr << "usage: j2_tcp_client_pool_benchmark [--clients N[,N...]] [--mode clients|pool|all]"
+                " [--rounds R] [--thread-max M] [--csv]\n";
+            return 1;
+        }
+    }
+
+    // 연결 1개당 fd 2개 (클라이언트 + 서버 쪽) 와 여유분
+    const std::size_t fdLimit = raise_fd_limit();
+    const std::size_t maxClients = fdLimit > 128 ? (fdLimit - 128) / 2 : 1;
+    if (!csv) {
+        std::cout << "fd limit: " << fdLimit << " (max " << maxClients << " clients), echo rounds: "
+            << rounds << "\n\n";
+    }
+    for (auto& n : counts) {
+        if (n > maxClients) {
+            std::cerr << n << " clients exceed the fd limit, using " << maxClients << "\n";
+            n = maxClients;
+        }
+    }
+
+    print_header(csv);
+    for (std::size_t n : counts) {
+        if (mode == "all" || mode == "clients") {
+            if (n <= threadMax) {
+                print_result(run_one(false, n, rounds), csv);
+            }
+            else if (!csv) {
+                std::cout << "clients  " << std::setw(9) << n << "  skipped (> --thread-max)\n";
+            }
+        }
+        if (mode == "all" || mode == "pool") {
+            print_result(run_one(true, n, rounds), csv);
+        }
+    }
+    return 0;
+}
+
+#else // !__linux__
+
+int main() {
+    std::cerr << "j2_tcp_client_pool_benchmark requires Linux (epoll, /proc)\n";
+    return 0;
+}
+
+#endif // __linux__
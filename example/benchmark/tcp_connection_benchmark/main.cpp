@@ -0,0 +1,293 @@
+// tcp_server 접속 수 확장성 벤치마크 (Thread 백엔드 vs Epoll 백엔드)
+//
+// loopback 으로 tcp_server 를 띄우고 같은 프로세스에서 클라이언트 N 개를 접속시킨 뒤 다음을 측정한다.
+//  - connect ms : N 개 접속 후 서버가 모두 on_connect 할 때까지
+//  - echo ms    : 모든 클라이언트가 32 바이트를 보내고 echo 를 모두 받을 때까지 (1 라운드)
+//  - threads    : 접속 유지 중 프로세스 스레드 수 (/proc/self/status)
+//  - rss MB     : 접속 유지 중 증가한 RSS
+//  - close ms   : 클라이언트 전체 종료 후 서버가 모두 on_close 할 때까지
+//
+// 사용법:
+//   j2_tcp_connection_benchmark [--clients N[,N...]] [--backend thread|epoll|sharded|all] [--loops K]
+//                               [--connectors C] [--rounds R] [--thread-max M] [--csv]
+//     --clients    : 접속 수 목록 (기본: 1000,10000)
+//     --backend    : 측정할 백엔드 (기본: all)
+//                    sharded = Epoll + SO_REUSEPORT 리스너 루프별 분산 + 코어 고정
+//     --loops      : Epoll 루프 스레드 수 (기본: 1, sharded 는 최소 하드웨어 스레드 수)
+//     --connectors : 동시에 접속하는 클라이언트 스레드 수 (기본: 1, 접속 폭주 재현용)
+//     --rounds     : echo 라운드 수, 결과는 평균 (기본: 10)
+//     --thread-max : Thread 백엔드를 측정할 최대 접속 수 (기본: 2000, 스레드 생성 한도 보호)
+//     --csv        : 결과를 CSV 로 출력
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+
+#include <j2_library/j2_library.hpp>
+
+#include "bench_util.hpp"
+
+#ifdef __linux__
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <unistd.h>
+
+namespace {
+
+    using j2::network::tcp::tcp_server;
+    using j2_bench::bench_server;
+    using j2_bench::ms_since;
+    using j2_bench::raise_fd_limit;
+    using j2_bench::status_value;
+    using j2_bench::wait_until;
+
+    struct result {
+        std::string backend;
+        std::size_t clients = 0;
+        std::size_t connected = 0;
+        double connectMs = 0;
+        double echoMs = 0;
+        long threads = 0;
+        double rssMb = 0;
+        double closeMs = 0;
+    };
+
+    int connect_to(std::uint16_t port) {
+        int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons(port);
+        if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+            ::close(fd);
+            return -1;
+        }
+        int one = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        return fd;
+    }
+
+    // 모든 클라이언트가 보낸 뒤 poll 로 모든 echo 를 받음
+    bool echo_round(const std::vector<int>& clients) {
+        // NUL 없는 텍스트 (Thread 백엔드는 수신 데이터를 C 문자열로 전달)
+        static const std::string msg = "j2-tcp-connection-benchmark-echo";
+        for (int fd : clients) {
+            if (::send(fd, msg.data(), msg.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(msg.size())) return false;
+        }
+
+        std::vector<pollfd> pfds;
+        pfds.reserve(clients.size());
+        for (int fd : clients) pfds.push_back(pollfd{ fd, POLLIN, 0 });
+        std::vector<std::size_t> received(clients.size(), 0);
+        std::size_t done = 0;
+        char buf[256];
+
+        while (done < clients.size()) {
+            int n = ::poll(pfds.data(), pfds.size(), 5000);
+            if (n <= 0) return false;
+            for (std::size_t i = 0; i < pfds.size(); ++i) {
+                if (pfds[i].fd < 0 || !(pfds[i].revents & POLLIN)) continue;
+                ssize_t r = ::recv(pfds[i].fd, buf, sizeof(buf), 0);
+                if (r <= 0) return false;
+                received[i] += static_cast<std::size_t>(r);
+                if (received[i] >= msg.size()) {
+                    pfds[i].fd = -1; // 이 클라이언트는 완료
+                    ++done;
+                }
+            }
+        }
+        return true;
+    }
+
+    result run_one(tcp_server::Backend backend, bool sharded, unsigned loops, std::size_t count,
+        unsigned connectors, unsigned rounds) {
+        result r;
+        r.backend = sharded ? "sharded" : backend == tcp_server::Backend::Epoll ? "epoll" : "thread";
+        r.clients = count;
+
+        const long rssBefore = status_value("VmRSS:");
+
+        bench_server server;
+        server.setBackend(backend, loops);
+        server.setAcceptSharding(sharded);
+        std::atomic<std::size_t> connects{ 0 };
+        std::atomic<std::size_t> closes{ 0 };
+        server.setOnConnectCallback([&](int, const std::string&) { ++connects; });
+        server.setOnCloseCallback([&](int, const std::string&) { ++closes; });
+        server.setOnReceiveCallback([&](int fd, const std::string& msg) { server.sendToClient(fd, msg); });
+
+        if (server.start("127.0.0.1", 0) != tcp_server::StartResult::Success) {
+            std::cerr << "server start failed\n";
+            return r;
+        }
+        const std::uint16_t port = server.port();
+
+        // connectors 개 스레드가 나누어 접속
+        std::vector<std::vector<int>> parts(connectors);
+        std::vector<std::thread> pool;
+        auto t0 = std::chrono::steady_clock::now();
+        for (unsigned c = 0; c < connectors; ++c) {
+            pool.emplace_back([&, c] {
+                for (std::size_t i = c; i < count; i += connectors) {
+                    int fd = connect_to(port);
+                    if (fd < 0) {
+                        std::cerr << "connect failed (fd limit?)\n";
+                        break;
+                    }
+                    parts[c].push_back(fd);
+                }
+            });
+        }
+        for (auto& t : pool) t.join();
+        std::vector<int> clients;
+        clients.reserve(count);
+        for (auto& part : parts) clients.insert(clients.end(), part.begin(), part.end());
+        wait_until([&] { return connects.load() >= clients.size(); });
+        r.connectMs = ms_since(t0);
+        r.connected = clients.size();
+
+        double echoTotal = 0;
+        for (unsigned k = 0; k < rounds; ++k) {
+            t0 = std::chrono::steady_clock::now();
+            if (!echo_round(clients)) {
+                std::cerr << "echo round failed\n";
+                break;
+            }
+            echoTotal += ms_since(t0);
+        }
+        r.echoMs = rounds > 0 ? echoTotal / rounds : 0;
+
+        r.threads = status_value("Threads:");
+        r.rssMb = static_cast<double>(status_value("VmRSS:") - rssBefore) / 1024.0;
+
+        t0 = std::chrono::steady_clock::now();
+        for (int fd : clients) ::close(fd);
+        wait_until([&] { return closes.load() >= clients.size(); });
+        r.closeMs = ms_since(t0);
+
+        server.quit();
+        return r;
+    }
+
+    void print_header(bool csv) {
+        if (csv) {
+            std::cout << "backend,clients,connected,connect_ms,echo_ms,threads,rss_mb,close_ms\n";
+            return;
+        }
+        std::cout << std::left << std::setw(9) << "backend"
+            << std::right << std::setw(9) << "clients"
+            << std::setw(12) << "connect ms"
+            << std::setw(10) << "echo ms"
+            << std::setw(9) << "threads"
+            << std::setw(9) << "rss MB"
+            << std::setw(10) << "close ms" << "\n";
+    }
+
+    void print_result(const result& r, bool csv) {
+        if (csv) {
+            std::cout << r.backend << "," << r.clients << "," << r.connected << ","
+                << std::fixed << std::setprecision(3) << r.connectMs << "," << r.echoMs << ","
+                << r.threads << "," << r.rssMb << "," << r.closeMs << "\n";
+            return;
+        }
+        std::cout << std::left << std::setw(9) << r.backend
+            << std::right << std::setw(9) << r.connected
+            << std::fixed << std::setprecision(1)
+            << std::setw(12) << r.connectMs
+            << std::setw(10) << std::setprecision(2) << r.echoMs
+            << std::setw(9) << r.threads
+            << std::setw(9) << std::setprecision(1) << r.rssMb
+            << std::setw(10) << r.closeMs << "\n";
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> counts = { 1000, 10000 };
+    std::string backend = "all";
+    unsigned loops = 1;
+    unsigned connectors = 1;
+    unsigned rounds = 10;
+    std::size_t threadMax = 2000;
+    bool csv = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        if (a == "--clients" && i + 1 < argc) {
+            counts.clear();
+            std::stringstream ss(argv[++i]);
+            std::string item;
+            while (std::getline(ss, item, ',')) counts.push_back(std::strtoull(item.c_str(), nullptr, 10));
+        }
+        else if (a == "--backend" && i + 1 < argc) backend = argv[++i];
+        else if (a == "--loops" && i + 1 < argc) loops = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        else if (a == "--connectors" && i + 1 < argc) connectors = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        else if (a == "--rounds" && i + 1 < argc) rounds = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        else if (a == "--thread-max" && i + 1 < argc) threadMax = std::strtoull(argv[++i], nullptr, 10);
+        else if (a == "--csv") csv = true;
+        else {
+            std::cerr << "usage: j2_tcp_connection_benchmark [--clients N[,N...]] [--backend thread|epoll|sharded|all]"
+                " [--loops K] [--connectors C] [--rounds R] [--thread-max M] [--csv]\n";
+            return 1;
+        }
+    }
+
+    // 클라이언트 1개당 fd 2개 (클라이언트 + 서버 쪽) 와 여유분
+    const std::size_t fdLimit = raise_fd_limit();
+    const std::size_t maxClients = fdLimit > 128 ? (fdLimit - 128) / 2 : 1;
+    if (connectors == 0) connectors = 1;
+    const unsigned shardLoops = std::max(loops, std::max(1u, std::thread::hardware_concurrency()));
+    if (!csv) {
+        std::cout << "fd limit: " << fdLimit << " (max " << maxClients << " clients), epoll loops: " << loops
+            << " (sharded: " << shardLoops << "), connectors: " << connectors
+            << ", echo rounds: " << rounds << "\n\n";
+    }
+    for (auto& n : counts) {
+        if (n > maxClients) {
+            std::cerr << n << " clients exceed the fd limit, using " << maxClients << "\n";
+            n = maxClients;
+        }
+    }
+
+    print_header(csv);
+    for (std::size_t n : counts) {
+        if (backend == "all" || backend == "thread") {
+            if (n <= threadMax) {
+                print_result(run_one(tcp_server::Backend::Thread, false, 1, n, connectors, rounds), csv);
+            }
+            else if (!csv) {
+                std::cout << "thread   " << std::setw(9) << n << "  skipped (> --thread-max)\n";
+            }
+        }
+        if (backend == "all" || backend == "epoll") {
+            print_result(run_one(tcp_server::Backend::Epoll, false, loops, n, connectors, rounds), csv);
+        }
+        if (backend == "all" || backend == "sharded") {
+            print_result(run_one(tcp_server::Backend::Epoll, true, shardLoops, n, connectors, rounds), csv);
+        }
+    }
+    return 0;
+}
+
+#else // !__linux__
+
+int main() {
+    std::cerr << "j2_tcp_connection_benchmark requires Linux (epoll, /proc)\n";
+    return 0;
+}
+
+#endif // __linux__
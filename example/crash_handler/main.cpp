@@ -2,7 +2,9 @@
 #include <iostream>
 #include <string>
 #include <filesystem>
+#include <spdlog/spdlog.h>
 #include "j2_library/system/crash_handler.hpp" // 프로젝트 경로에 맞춰 수정
+#include "j2_library/log/flight_recorder.hpp"
 
 int crash_test_function() {
     // 의도적으로 크래시를 유도하는 함수
@@ -42,9 +44,20 @@ int main() {
         // 또는 서버로 크래시 내용을 전송하는 로직도 구현할 수 있습니다.
         });
 
+    // 2. 플라이트 레코더 설정 (선택)
+    // trace 로그를 파일에 쓰지 않고 스레드별 메모리 링 버퍼에만 보관하다가,
+    // 크래시 시 아래 경로로 덤프합니다. (logger_manager 에서는 FLIGHT_RECORDER_ENABLE=true)
+    j2::system::CrashHandler::set_flight_recorder_dump_path("flight_recorder.dump");
+    auto recorder = std::make_shared<spdlog::logger>("flight",
+        std::make_shared<j2::log::flight_recorder_sink>());
+    recorder->set_level(spdlog::level::trace);
+    for (int i = 0; i < 10; ++i) {
+        recorder->trace("step {} before crash", i);
+    }
+
     std::cout << "Crash handler initialized. Triggering a crash in 3 seconds..." << std::endl;
 
-    // 2. 의도적인 크래시 유도 (Null Pointer Dereference)
+    // 3. 의도적인 크래시 유도 (Null Pointer Dereference)
     // 실제 상황에서는 잘못된 메모리 접근 시 즉시 핸들러가 호출됩니다.
 
     std::cout << "Accessing invalid memory now..." << std::endl;
@@ -0,0 +1,94 @@
+// 로그 시간 인덱스 검색 도구
+//
+// 사용법:
+//   j2_log_query <base_log_path> [--from "YYYY-mm-dd HH:MM:SS"] [--to "YYYY-mm-dd HH:MM:SS"]
+//                [--level warn] [--grep text] [--threads N] [--max N] [--utc]
+//
+// 예) logs/all.log 와 회전된 보관 파일에서 5분 구간의 error 이상 로그 검색
+//   j2_log_query logs/all.log --from "2026-01-01 12:00:00" --to "2026-01-01 12:05:00" --level error
+//
+// INDEX_ENABLE=true 로 기록된 파일은 인덱스(*.idx)로 필요한 구간만 읽는다.
+
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <cstdlib>
+
+#include <j2_library/j2_library.hpp>
+
+static void print_usage() {
+    std::cerr
+        << "usage: j2_log_query <base_log_path> [--from \"YYYY-mm-dd HH:MM:SS\"] [--to \"YYYY-mm-dd HH:MM:SS\"]\n"
+        << "                    [--level trace|debug|info|warn|error|critical] [--grep text]\n"
+        << "                    [--threads N] [--max N] [--utc]\n";
+}
+
+// "YYYY-mm-dd HH:MM:SS" → epoch ns (로그 줄 시각 해석기를 재사용)
+static bool parse_time_arg(const std::string& s, bool utc, std::int64_t& ns) {
+    std::string bracketed = "[" + s + ".000]";
+    return j2::log::log_query::parseLineTime(bracketed.c_str(), bracketed.size(), utc, ns);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        print_usage();
+        return 1;
+    }
+
+    const std::string basePath = argv[1];
+    std::string fromArg;
+    std::string toArg;
+    j2::log::log_query_options opt;
+
+    for (int i = 2; i < argc; ++i) {
+        std::string a = argv[i];
+        auto next = [&](std::string& out) {
+            if (i + 1 >= argc) return false;
+            out = argv[++i];
+            return true;
+        };
+        std::string v;
+        if (a == "--from" && next(v)) fromArg = v;
+        else if (a == "--to" && next(v)) toArg = v;
+        else if (a == "--level" && next(v)) opt.minLevel = spdlog::level::from_str(v);
+        else if (a == "--grep" && next(v)) opt.contains = v;
+        else if (a == "--threads" && next(v)) opt.threads = static_cast<unsigned>(std::strtoul(v.c_str(), nullptr, 10));
+        else if (a == "--max" && next(v)) opt.maxResults = static_cast<std::size_t>(std::strtoull(v.c_str(), nullptr, 10));
+        else if (a == "--utc") opt.utc = true;
+        else {
+            print_usage();
+            return 1;
+        }
+    }
+
+    if (!fromArg.empty() && !parse_time_arg(fromArg, opt.utc, opt.fromNs)) {
+        std::cerr << "invalid --from: " << fromArg << "\n";
+        return 1;
+    }
+    if (!toArg.empty()) {
+        if (!parse_time_arg(toArg, opt.utc, opt.toNs)) {
+            std::cerr << "invalid --to: " << toArg << "\n";
+            return 1;
+        }
+        opt.toNs += 999999999LL; // 초 단위 입력이므로 해당 초의 끝까지 포함
+    }
+
+    const auto t0 = std::chrono::steady_clock::now();
+    j2::log::log_query_stats stats;
+    const auto hits = j2::log::log_query::run(basePath, opt, &stats);
+    const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - t0).count();
+
+    std::string lastFile;
+    for (const auto& h : hits) {
+        if (h.file != lastFile) {
+            std::cout << "==> " << h.file << " <==\n";
+            lastFile = h.file;
+        }
+        std::cout << h.line << "\n";
+    }
+
+    std::cerr << hits.size() << " lines, " << stats.files << " files, scanned "
+        << stats.scannedBytes << " / " << stats.totalBytes << " bytes, " << ms << " ms\n";
+    return 0;
+}
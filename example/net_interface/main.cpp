@@ -23,34 +23,42 @@ int main() {
     // 2. 이후 실시간 모니터링으로 넘어갑니다. 
     std::cout << "Starting Network Interface Monitor..." << std::endl;
 
-    auto prev_data = j2if::InterfaceManager::get_interfaces();
+    // rtnetlink 덤프 한 번으로 전체 카운터를 읽고, 직전 샘플 대비 속도를 계산
+    j2if::InterfaceMonitor monitor;
+    monitor.sample();
+
+    // 링크 up/down 은 폴링 없이 이벤트로 수신
+    monitor.start_link_events([](const j2if::LinkEvent& ev) {
+        std::cout << get_current_timestamp() << " Link " << ev.name
+            << (ev.removed ? " removed" : (ev.is_running ? " up" : " down")) << std::endl;
+    });
 
     while (true) {
         std::this_thread::sleep_for(std::chrono::seconds(1));
-        auto curr_data = j2if::InterfaceManager::get_interfaces();
+        auto samples = monitor.sample();
 
         // 매 출력 시 상단에 현재 시간 표시
         std::cout << "\n" << get_current_timestamp() << " Network Status:" << std::endl;
         std::cout << std::setw(15) << "Interface"
-            << std::setw(18) << "IP Address"
             << std::setw(15) << "RX (KB/s)"
-            << std::setw(15) << "TX (KB/s)" << std::endl;
-        std::cout << std::string(65, '-') << std::endl;
-
-        for (size_t i = 0; i < curr_data.size(); ++i) {
-            if (i >= prev_data.size()) break;
-
-            // 초당 속도 계산
-            double rx_kb = (curr_data[i].stats.rx_bytes - prev_data[i].stats.rx_bytes) / 1024.0;
-            double tx_kb = (curr_data[i].stats.tx_bytes - prev_data[i].stats.tx_bytes) / 1024.0;
-
-            std::cout << std::setw(15) << curr_data[i].name
-                << std::setw(18) << curr_data[i].ip_address
+            << std::setw(15) << "TX (KB/s)"
+            << std::setw(12) << "RX pkt/s"
+            << std::setw(12) << "TX pkt/s"
+            << std::setw(8) << "drops"
+            << std::setw(8) << "errors" << std::endl;
+        std::cout << std::string(85, '-') << std::endl;
+
+        for (const auto& s : samples) {
+            std::cout << std::setw(15) << s.name
                 << std::fixed << std::setprecision(2)
-                << std::setw(15) << rx_kb
-                << std::setw(15) << tx_kb << std::endl;
+                << std::setw(15) << s.rates.rx_bytes_per_sec / 1024.0
+                << std::setw(15) << s.rates.tx_bytes_per_sec / 1024.0
+                << std::setprecision(0)
+                << std::setw(12) << s.rates.rx_packets_per_sec
+                << std::setw(12) << s.rates.tx_packets_per_sec
+                << std::setw(8) << (s.rates.rx_dropped + s.rates.tx_dropped)
+                << std::setw(8) << (s.rates.rx_errors + s.rates.tx_errors) << std::endl;
         }
-        prev_data = curr_data;
     }
 
     return 0;
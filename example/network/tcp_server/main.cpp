@@ -33,7 +33,10 @@ int main() {
     // IPv4 tcp server 
     j2::network::tcp::tcp_server server_ipv4;
 
-    // set callbacks 
+    // serve clients from one epoll loop instead of a thread per client (Linux; falls back elsewhere)
+    server_ipv4.setBackend(j2::network::tcp::tcp_server::Backend::Epoll, 1);
+
+    // set callbacks
     server_ipv4.setOnConnectCallback(
         [&handler](int client_socket, const std::string& message) {
             handler.onConnect(client_socket, "[IPv4] " + message);
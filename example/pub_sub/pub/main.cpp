@@ -26,8 +26,6 @@ int main() {
     person.name = "John Doe";
     person.age  = 30;
     person.tags = {"developer", "cpp", "json"};
-        
-    nlohmann::json json_data = person; // Serialize to JSON
 
     j2::network::udp::udp_sender sender; // udp sender
 
@@ -41,14 +39,17 @@ int main() {
         return 1;
     }
 
+    // Person -> MessagePack (binary JSON) datagrams; smaller than json.dump() text
+    j2::network::udp::udp_typed_publisher<Person> publisher(sender);
+
     while (true)
     {
         // wait for 5 second
         std::this_thread::sleep_for(std::chrono::seconds(5));
 
-        // send serialized JSON string over UDP
-        sender.send_data(json_data.dump());
-        // NOTE: Care must be taken to ensure that the size of json does not exceed 65 KB. The maximum size of UDP packets is usually 65,507 bytes.
+        // send serialized Person over UDP
+        publisher.publish(person);
+        // NOTE: Care must be taken to ensure that the encoded size does not exceed 65 KB. The maximum size of UDP packets is usually 65,507 bytes.
 
         std::cout << get_current_time_string() << " sent data " << std::endl;
     }
@@ -13,28 +13,20 @@
 
 std::string get_current_time_string();
 
-// Callable class used instead of lambda for receiver callback
+// Callable class used instead of lambda for subscriber callback
 class ReceiveCallback {
 public:
-    void operator()(const std::string& data, const std::string& sender_ip, uint16_t sender_port) const
+    void operator()(const Person& person, const std::string& sender_ip, uint16_t sender_port) const
     {
-        try {
-            auto json_data = nlohmann::json::parse(data);
-            Person person = json_data.get<Person>(); // Deserialize JSON to Person struct
-
-            std::cout << get_current_time_string()
-                << " Received from " << sender_ip << ":" << sender_port
-                << " - Name: " << person.name
-                << ", Age: "   << (person.age ? std::to_string(*person.age) : "Unknown")
-                << ", Tags: ";
-            for (const auto& tag : person.tags) {
-                std::cout << tag << " ";
-            }
-            std::cout << std::endl;
-        }
-        catch (const std::exception& e) {
-            std::cerr << get_current_time_string() << " Failed to parse JSON data: " << e.what() << std::endl;
+        std::cout << get_current_time_string()
+            << " Received from " << sender_ip << ":" << sender_port
+            << " - Name: " << person.name
+            << ", Age: "   << (person.age ? std::to_string(*person.age) : "Unknown")
+            << ", Tags: ";
+        for (const auto& tag : person.tags) {
+            std::cout << tag << " ";
         }
+        std::cout << std::endl;
     }
 };
 
@@ -51,8 +43,14 @@ int main() {
     std::string ip = "127.0.0.1"; // loopback address
     uint16_t port = 54000;
 
+    // MessagePack datagrams -> Person (see udp_typed_publisher in the publisher example)
+    j2::network::udp::udp_typed_subscriber<Person> subscriber(receiver);
+
     // Register callable object instead of lambda
-    receiver.setOnReceiveCallback(ReceiveCallback{});
+    subscriber.setOnReceiveCallback(ReceiveCallback{});
+    subscriber.setOnErrorCallback([](const std::string&, const std::string& sender_ip, uint16_t sender_port) {
+        std::cerr << get_current_time_string() << " Failed to decode data from " << sender_ip << ":" << sender_port << std::endl;
+    });
 
     if (!receiver.startUnicast(ip, port)) {
         std::cerr << "Failed to start UDP receiver on " << ip << ":" << port << std::endl;
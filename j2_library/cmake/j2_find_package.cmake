@@ -244,6 +244,25 @@ endif()
 # curl }}
 ###########################################################
 
+###########################################################
+# zlib {{
+#
+# 선택: 있으면 회전된 로그 파일을 gzip 으로 압축 보관 (log_archiver)
+#       없으면 압축 없이 보관 용량(바이트) 정책만 적용
+
+find_package(ZLIB QUIET)
+
+if (ZLIB_FOUND)
+  message(STATUS "Found ZLIB (log archive compression enabled)")
+  set(J2_HAVE_ZLIB ON)
+else()
+  message(WARNING "ZLIB not found; rotated log files are archived without compression")
+  set(J2_HAVE_ZLIB OFF)
+endif()
+
+# zlib }}
+###########################################################
+
 
 ###########################################################
 # googletest {{
@@ -47,6 +47,20 @@ function(j2_link_lib)
             endif()
         endif()
 
+        # zlib 라이브러리 링크 (선택, 로그 압축 보관용)
+        if (J2_HAVE_ZLIB AND TARGET ZLIB::ZLIB)
+            target_link_libraries(${_target} PRIVATE ZLIB::ZLIB)
+            target_compile_definitions(${_target} PRIVATE J2_HAVE_ZLIB=1)
+        endif()
+
+        # librt (shm_open/shm_unlink, glibc < 2.34 에서 필요)
+        if (UNIX AND NOT APPLE)
+            find_library(J2_RT_LIBRARY rt)
+            if (J2_RT_LIBRARY)
+                target_link_libraries(${_target} PRIVATE ${J2_RT_LIBRARY})
+            endif()
+        endif()
+
         # googletest 라이브러리 링크 추가
         # if (GTest_FOUND)
         #   target_link_libraries(${_target} PUBLIC GTest::gtest GTest::gtest_main)
@@ -54,6 +54,7 @@
 
 // -- json components --
 #include "j2_library/json/json.hpp"
+#include "j2_library/json/json_binary.hpp"
 
 // -- logging components --
 #include "j2_library/log/log.hpp" 
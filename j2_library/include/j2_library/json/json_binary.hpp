@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "j2_library/export.hpp"
+#include "j2_library/json/json.hpp"
+
+namespace j2::json {
+
+    //--------------------------------------------------------------
+    // 바이너리 직렬화 (MessagePack / CBOR, nlohmann 내장 인코더 사용)
+    // - 텍스트 json(dump/parse) 대비 페이로드가 작고 숫자 변환(문자열 <-> 수) 비용이 없음
+    // - encode 는 out 을 비우고 다시 채우므로, 같은 버퍼를 재사용하면 메시지마다 할당하지 않음
+    // - decode 는 예외를 던지지 않음 (실패 시 false)
+    //--------------------------------------------------------------
+    enum class binary_format {
+        msgpack,
+        cbor,
+    };
+
+    void J2LIB_API encode(const nj& j, binary_format format, std::vector<std::uint8_t>& out);
+    std::vector<std::uint8_t> J2LIB_API encode(const nj& j, binary_format format = binary_format::msgpack);
+
+    bool J2LIB_API decode(const void* data, std::size_t size, binary_format format, nj& out) noexcept;
+    inline bool decode(const std::vector<std::uint8_t>& data, binary_format format, nj& out) noexcept {
+        return decode(data.data(), data.size(), format, out);
+    }
+
+    //--------------------------------------------------------------
+    // 타입 버전: to_json/from_json 이 정의된 T 를 직접 인코딩/디코딩 (예외 없음)
+    //--------------------------------------------------------------
+    template <class T>
+    inline bool encode_value(const T& value, binary_format format, std::vector<std::uint8_t>& out) noexcept {
+        try {
+            encode(nj(value), format, out);
+            return true;
+        }
+        catch (...) {
+            out.clear();
+            return false;
+        }
+    }
+
+    template <class T>
+    inline bool decode_value(const void* data, std::size_t size, binary_format format, T& out) noexcept {
+        nj j;
+        if (!decode(data, size, format, j)) return false;
+        try {
+            j.get_to(out);
+            return true;
+        }
+        catch (...) {
+            return false;
+        }
+    }
+
+} // namespace j2::json
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+#include <spdlog/common.h>
+#include <spdlog/sinks/sink.h>
+#include <spdlog/details/log_msg.h>
+
+#include "j2_library/export.hpp"
+
+// 플라이트 레코더 (크래시 직전 로그 보존용 메모리 링 버퍼)
+//
+// 스레드마다 고정 크기 링 버퍼를 하나씩 두고 최근 N개의 로그 메시지를 항상 기록한다.
+// 기록은 해당 스레드만 수행하므로 락이 없고, 파일 I/O 도 없다.
+// 크래시 시 j2::system::CrashHandler 가 시그널 핸들러 안에서 dumpToFile() 로
+// 모든 링을 파일에 기록한다. (open/write/close 만 사용하는 async-signal-safe 경로)
+//
+// 주의: 로거 레벨(LOGGER_LEVEL)이 trace 보다 높으면 trace 메시지는 싱크까지 오지 않는다.
+namespace j2::log {
+
+    class J2LIB_API flight_recorder {
+    public:
+        // 메시지 1건당 보관하는 최대 바이트 (초과분은 잘림)
+        static constexpr std::size_t SLOT_TEXT_SIZE = 232;
+
+        // 스레드당 링 버퍼 슬롯 개수 설정 (이후 새로 할당되는 링부터 적용)
+        static void setSlotsPerThread(std::size_t slots);
+        static std::size_t slotsPerThread();
+
+        // 현재 스레드의 링 버퍼에 1건 기록 (락 없음, 최초 1회만 링 할당)
+        static void record(spdlog::level::level_enum level,
+            std::int64_t epoch_ns,
+            const char* text,
+            std::size_t len) noexcept;
+
+        // 모든 스레드의 링 버퍼를 fd 에 기록 (async-signal-safe)
+        // 반환값: 기록한 메시지 개수
+        static std::size_t dump(int fd) noexcept;
+
+        // path 파일을 새로 만들어 dump() 결과를 기록 (async-signal-safe)
+        static bool dumpToFile(const char* path) noexcept;
+    };
+
+    // 모든 메시지를 flight_recorder 로 보내는 spdlog 싱크
+    // 포맷팅을 하지 않으므로 패턴/포매터 설정은 무시된다.
+    class J2LIB_API flight_recorder_sink final : public spdlog::sinks::sink {
+    public:
+        flight_recorder_sink();
+
+        void log(const spdlog::details::log_msg& msg) override;
+        void flush() override;
+        void set_pattern(const std::string& pattern) override;
+        void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override;
+    };
+
+} // namespace j2::log
@@ -2,5 +2,9 @@
 
 #include "j2_library/export.hpp"
 #include "j2_library/log/logger_manager.hpp"
-
- 
+#include "j2_library/log/rotating_archive_sink.hpp"
+#include "j2_library/log/log_archiver.hpp"
+#include "j2_library/log/flight_recorder.hpp"
+#include "j2_library/log/log_index.hpp"
+#include "j2_library/log/log_query.hpp"
+#include "j2_library/log/network_sink.hpp"
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <cstdint>
+
+#include "j2_library/export.hpp"
+#include "j2_library/log/rotating_archive_sink.hpp"
+
+// 회전된 로그 파일 보관 관리자
+//
+// rotating_archive_sink 의 회전 훅으로부터 파일 경로를 받아
+// 우선순위를 낮춘 백그라운드 스레드에서 gzip 압축(zlib 사용 가능 시) 후
+// 보관 용량(압축된 바이트 합계) 정책에 따라 오래된 보관 파일을 삭제한다.
+// 보관 파일의 시간 인덱스(*.idx)는 압축 후에도 유지하고, 보관 파일 삭제 시 함께 삭제한다.
+// 로깅 스레드는 큐에 경로를 넣는 작업만 수행한다.
+namespace j2::log {
+
+    class J2LIB_API log_archiver : public std::enable_shared_from_this<log_archiver> {
+    public:
+        // 베이스 파일별 보관 정책
+        struct policy {
+            bool compress = true;               // gzip 압축 여부 (zlib 미사용 빌드에서는 무시)
+            std::uint64_t maxArchiveBytes = 0;  // 보관 파일 합계 최대 바이트 (0 이면 무제한)
+            std::size_t maxArchiveFiles = 0;    // 보관 파일 최대 개수 (0 이면 무제한)
+        };
+
+        log_archiver();
+        ~log_archiver();
+
+        log_archiver(const log_archiver&) = delete;
+        log_archiver& operator=(const log_archiver&) = delete;
+
+        // 백그라운드 스레드 시작/중지
+        // stop() 은 처리 중인 작업 1건만 마치고 반환한다. 남은 보관 파일은
+        // 다음 실행 시 setPolicy() 의 정리 작업에서 다시 처리된다.
+        void start();
+        void stop();
+
+        // 베이스 파일(예: logs/all.log)의 보관 정책 등록/갱신
+        // 등록 시 남아 있는 미압축 보관 파일 압축 및 용량 정리 작업을 1회 예약한다.
+        void setPolicy(const std::string& basePath, const policy& p);
+
+        // 회전된 파일을 작업 큐에 추가 (즉시 반환)
+        void enqueue(const std::string& basePath, const std::string& rotatedPath);
+
+        // rotating_archive_sink 에 넘겨줄 훅 생성
+        // 싱크가 archiver 보다 오래 살아도 안전하도록 weak_ptr 로 참조한다.
+        rotate_hook makeHook(const std::string& basePath);
+
+        // 대기 중인 작업이 모두 끝날 때까지 대기 (테스트/종료 처리용)
+        void waitIdle();
+
+        // 현재 보관 중인 파일들의 바이트 합계
+        std::uint64_t archivedBytes(const std::string& basePath) const;
+
+        // zlib 압축 지원 빌드 여부
+        static bool compressionAvailable();
+
+        // src 를 gzip 으로 압축하여 dst 에 기록 (성공 시 true)
+        static bool gzipFile(const std::string& src, const std::string& dst);
+
+    private:
+        struct job {
+            std::string basePath;
+            std::string rotatedPath; // 비어 있으면 정리(sweep) 작업
+        };
+
+        void workerLoop();
+        void process(const job& j);
+        void compressOne(const std::string& rotatedPath, const policy& p);
+        void enforceRetention(const std::string& basePath, const policy& p);
+        void sweep(const std::string& basePath, const policy& p);
+        static void lowerCurrentThreadPriority();
+
+        std::map<std::string, policy> policies_;
+        std::deque<job> jobs_;
+        bool busy_ = false;
+        mutable std::mutex mu_;
+        std::condition_variable cv_;
+        std::condition_variable idleCv_;
+        std::atomic<bool> running_{ false };
+        std::thread worker_;
+    };
+
+} // namespace j2::log
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstddef>
+#include <cstdint>
+
+#include <spdlog/common.h>
+
+#include "j2_library/export.hpp"
+
+// 로그 파일 시간 인덱스 (희소 사이드 인덱스)
+//
+// 로그 파일(예: logs/all.log) 옆에 logs/all.log.idx 를 두고
+// 약 N KB 마다 블록 1개의 요약(시간 범위, 바이트 구간, 포함된 레벨)을 기록한다.
+// log_query 는 이 인덱스를 이진 탐색하여 필요한 바이트 구간만 읽는다.
+//
+// 인덱스 파일 형식 (리틀 엔디언 호스트 기준, 고정 크기 레코드)
+//  헤더 16 바이트 : "J2LIDX01"(8) + 블록 간격(uint64)
+//  레코드 32 바이트: log_index_entry
+namespace j2::log {
+
+    struct log_index_entry {
+        std::int64_t firstNs = 0;    // 블록 첫 메시지 시각 (epoch ns)
+        std::int64_t lastNs = 0;     // 블록 마지막 메시지 시각 (epoch ns)
+        std::uint64_t offset = 0;    // 블록 시작 바이트 오프셋
+        std::uint32_t length = 0;    // 블록 바이트 길이 (메시지 경계 단위)
+        std::uint32_t levelMask = 0; // 블록에 포함된 레벨 비트 (1 << level)
+    };
+
+    static_assert(sizeof(log_index_entry) == 32, "log_index_entry must be 32 bytes");
+
+    class J2LIB_API log_index_writer {
+    public:
+        log_index_writer() = default;
+        ~log_index_writer();
+
+        log_index_writer(const log_index_writer&) = delete;
+        log_index_writer& operator=(const log_index_writer&) = delete;
+
+        // 인덱스 파일 열기
+        // 인자:
+        //  indexPath: 인덱스 파일 경로 (index_path_of() 사용)
+        //  interval: 블록 1개의 목표 바이트 크기
+        //  startOffset: 로그 파일의 현재 크기 (이어 쓰기 시작 위치)
+        //  truncate: true 이면 기존 인덱스를 지우고 새로 시작
+        bool open(const std::string& indexPath,
+            std::size_t interval,
+            std::uint64_t startOffset,
+            bool truncate);
+
+        // 대기 중인 블록을 기록하고 파일 닫기
+        void close();
+
+        bool isOpen() const { return fp_ != nullptr; }
+
+        // 로그 메시지 1건 반영 (offset 위치에 size 바이트 기록됨)
+        // 블록이 interval 이상 차면 레코드 1개를 기록한다.
+        void add(std::int64_t epochNs,
+            spdlog::level::level_enum level,
+            std::uint64_t offset,
+            std::size_t size);
+
+        void flush();
+
+        // 로그 파일 경로 → 인덱스 파일 경로 (x.log / x.log.gz → x.log.idx)
+        static std::string index_path_of(const std::string& logPath);
+
+        // 인덱스 파일 읽기 (형식이 다르거나 없으면 false, 마지막 불완전 레코드는 무시)
+        static bool read(const std::string& indexPath,
+            std::vector<log_index_entry>& out);
+
+    private:
+        void writePending();
+
+        std::FILE* fp_ = nullptr;
+        std::size_t interval_ = 0;
+        log_index_entry pending_{};
+        bool hasPending_ = false;
+    };
+
+} // namespace j2::log
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+
+#include <spdlog/common.h>
+
+#include "j2_library/export.hpp"
+#include "j2_library/log/log_index.hpp"
+
+// 시간 인덱스 기반 로그 검색
+//
+// 베이스 파일(예: logs/all.log)과 회전된 보관 파일들을 대상으로
+//  1) 파일별 인덱스(*.idx)를 이진 탐색하여 시간 범위/레벨에 해당하는 블록만 고르고
+//  2) 고른 바이트 구간만 mmap(Windows 는 파일 읽기) 하여
+//  3) 레벨/부분 문자열 조건으로 줄 단위 필터링을 파일별로 병렬 수행한다.
+// 인덱스가 없거나 인덱스가 덮지 못하는 구간(인덱스 도입 전 내용, 기록 중인 마지막 블록)은 모두 검사한다.
+// .gz 보관 파일은 zlib 사용 빌드에서만 검색한다. (압축 해제하며 필요한 구간만 읽음)
+//
+// 줄 판별 규칙 (기본 PATTERN_FILE "[%Y-%m-%d %H:%M:%S.%e] [%l] ..." 기준)
+//  - 레벨: 줄 안의 "[trace]" "[debug]" "[info]" "[warning]" "[error]" "[critical]" 토큰
+//  - 시각: 줄 맨 앞의 "[YYYY-mm-dd HH:MM:SS.mmm]" (해석 실패 시 블록 시간 범위로만 판단)
+namespace j2::log {
+
+    struct log_query_options {
+        std::int64_t fromNs = std::numeric_limits<std::int64_t>::min(); // 시작 시각 (epoch ns, 포함)
+        std::int64_t toNs = std::numeric_limits<std::int64_t>::max();   // 끝 시각 (epoch ns, 포함)
+        spdlog::level::level_enum minLevel = spdlog::level::trace;      // 최소 레벨
+        std::string contains;                                           // 포함해야 할 문자열 (비어 있으면 조건 없음)
+        bool utc = false;               // 줄 앞 시각 해석 기준 (TIME_MODE=utc 이면 true)
+        unsigned threads = 0;           // 병렬 검색 스레드 수 (0 이면 하드웨어 스레드 수)
+        std::size_t maxResults = 0;     // 최대 결과 개수 (0 이면 무제한)
+    };
+
+    struct log_query_hit {
+        std::string file;               // 로그 파일 경로
+        std::uint64_t offset = 0;       // 줄 시작 바이트 오프셋 (압축 해제 기준)
+        std::string line;               // 줄 내용 (개행 제외)
+    };
+
+    struct log_query_stats {
+        std::size_t files = 0;          // 검색 대상 파일 수
+        std::uint64_t totalBytes = 0;   // 대상 파일 크기 합계 (디스크 기준)
+        std::uint64_t scannedBytes = 0; // 실제로 읽은 바이트
+    };
+
+    class J2LIB_API log_query {
+    public:
+        // basePath 와 그 보관 파일들에서 조건에 맞는 줄 검색
+        // 결과는 오래된 파일 → 최신 파일, 파일 내 오프셋 순서로 정렬된다.
+        static std::vector<log_query_hit> run(const std::string& basePath,
+            const log_query_options& options,
+            log_query_stats* stats = nullptr);
+
+        // 검색 대상 파일 목록 (오래된 파일 → 최신 파일, 마지막이 basePath)
+        static std::vector<std::string> listFiles(const std::string& basePath);
+
+        // 구간 선택 (테스트/도구용)
+        // 인덱스 entries 와 파일 크기로부터 검사해야 할 [begin, end) 구간 목록을 만든다.
+        struct range {
+            std::uint64_t begin = 0;
+            std::uint64_t end = 0;
+            bool exactTime = false; // true 이면 구간 전체가 시간 범위 안 (줄 시각 검사 생략)
+        };
+        static std::vector<range> selectRanges(const std::vector<log_index_entry>& entries,
+            std::uint64_t fileSize,
+            const log_query_options& options);
+
+        // 줄 맨 앞 "[YYYY-mm-dd HH:MM:SS.mmm]" 시각 해석 (실패 시 false)
+        static bool parseLineTime(const char* line, std::size_t len, bool utc, std::int64_t& epochNs);
+    };
+
+} // namespace j2::log
@@ -38,6 +38,11 @@
 #include "j2_library/export.hpp"
 #include "j2_library/ini/ini_parser.hpp"
 #include "j2_library/network/network.hpp"
+#include "j2_library/log/rotating_archive_sink.hpp"
+#include "j2_library/log/log_archiver.hpp"
+#include "j2_library/log/flight_recorder.hpp"
+#include "j2_library/log/log_index.hpp"
+#include "j2_library/log/network_sink.hpp"
 
 // INI 기반 spdlog 구성/리로드/디스크 감시/UDP 알림을 제공하는 로거 매니저
 namespace j2::log {
@@ -85,7 +90,17 @@ namespace j2::log {
             std::size_t old_allMaxSize,
             std::size_t old_allMaxFiles,
             std::size_t old_alertMaxSize,
-            std::size_t old_alertMaxFiles);
+            std::size_t old_alertMaxFiles,
+            bool old_archiveEnable,
+            bool old_indexEnable,
+            std::size_t old_indexInterval,
+            bool old_flightRecorderEnable,
+            bool old_netSinkEnable,
+            const network_sink::options& old_netSinkOptions);
+        spdlog::sink_ptr makeFileSink(const std::string& path,
+            std::size_t maxSize,
+            std::size_t maxFiles);
+        void applyArchivePolicy();
         static void ensureParentDir(const std::string& path);
         bool toBool(const std::string& val, bool default_val) const;
         std::string toLower(const std::string& s) const;
@@ -136,6 +151,26 @@ namespace j2::log {
         std::size_t alertMaxSize_ = 100 * 1024 * 1024; // 경고 이상 로그용 로그 파일 크기 (디폴트 100 MB) 
         std::size_t alertMaxFiles_ = 10; // 경고 이상 로그용 로그 백업 파일 개수
 
+        // 회전 파일 보관(압축) 정책
+        //  ARCHIVE_ENABLE=true 이면 *_MAX_FILES 대신 *_ARCHIVE_MAX_BYTES(보관 파일 바이트 합계)로 보관량을 제한
+        bool archiveEnable_ = false; // 회전 파일 보관 관리 사용 여부 (hard-reload)
+        bool archiveCompress_ = true; // 회전 파일 gzip 압축 여부 (zlib 필요)
+        std::uint64_t allArchiveMaxBytes_ = 1024ull * 1024ull * 1024ull; // 모든 로그 보관 파일 합계 (디폴트 1 GB)
+        std::uint64_t alertArchiveMaxBytes_ = 1024ull * 1024ull * 1024ull; // 경고 로그 보관 파일 합계 (디폴트 1 GB)
+
+        // 로그 파일 시간 인덱스 (log_query 검색용 *.idx 사이드 파일)
+        bool indexEnable_ = false; // 시간 인덱스 기록 여부 (hard-reload)
+        std::size_t indexInterval_ = 64 * 1024; // 인덱스 블록 크기 (디폴트 64 KB)
+
+        // 플라이트 레코더 (크래시 시 CrashHandler 가 덤프하는 스레드별 메모리 링 버퍼)
+        bool flightRecorderEnable_ = false; // 플라이트 레코더 싱크 사용 여부 (hard-reload)
+        std::size_t flightRecorderSlots_ = 256; // 스레드당 보관 메시지 개수
+
+        // 네트워크 로그 전송 (중앙 수집기로 UDP datagram / TCP 프레임 일괄 전송)
+        bool netSinkEnable_ = false; // 네트워크 싱크 사용 여부 (hard-reload)
+        network_sink::options netSinkOptions_; // 프로토콜/주소/묶음/버퍼 크기 (hard-reload)
+        spdlog::level::level_enum netSinkMin_ = spdlog::level::info; // 네트워크 싱크 최소 레벨 (soft-reload)
+
         // 디스크 감시(단일)
         bool        diskGuardEnable_ = true;
         std::string diskRoot_;
@@ -154,9 +189,14 @@ namespace j2::log {
         // 로거/싱크
         std::shared_ptr<spdlog::logger> logger_;
         std::shared_ptr<spdlog::sinks::stdout_color_sink_mt> consoleSink_;
-        std::shared_ptr<spdlog::sinks::rotating_file_sink_mt> allSink_;
-        std::shared_ptr<spdlog::sinks::rotating_file_sink_mt> alertsSink_;
+        spdlog::sink_ptr allSink_; // rotating_file_sink_mt 또는 rotating_archive_sink
+        spdlog::sink_ptr alertsSink_; // rotating_file_sink_mt 또는 rotating_archive_sink
         std::shared_ptr<spdlog::sinks::dist_sink_mt> distSink_;
+        spdlog::sink_ptr flightSink_; // flight_recorder_sink (FLIGHT_RECORDER_ENABLE=true 일 때)
+        std::shared_ptr<network_sink> netSink_; // NET_SINK_ENABLE=true 일 때
+
+        // 회전 파일 압축/정리 백그라운드 스레드 (ARCHIVE_ENABLE=true 일 때 생성)
+        std::shared_ptr<log_archiver> archiver_;
 
         // 공통 상태
         std::filesystem::file_time_type lastWriteTime_{};
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+#include <condition_variable>
+
+#include <spdlog/sinks/base_sink.h>
+
+#include "j2_library/export.hpp"
+#include "j2_library/network/network.hpp"
+
+// 네트워크 로그 전송 싱크 (중앙 수집기로 일괄 전송)
+//
+// 로깅 스레드는 포맷팅한 레코드를 메모리 버퍼에 덧붙이기만 하고 바로 반환한다.
+// 별도 전송 스레드가 버퍼를 통째로 교환해 가져가서
+//  - UDP: 레코드 경계를 지키며 maxBatchBytes 이하의 큰 datagram 으로 묶어 udp_sender 로 전송
+//  - TCP: 같은 방식으로 묶은 뒤 [4 바이트 길이(big-endian)][페이로드] 프레임으로 tcp_client 로 전송
+// 묶음은 크기(maxBatchBytes) 또는 시간(flushIntervalMs) 중 먼저 도달한 조건으로 전송된다.
+//
+// 버퍼는 maxQueueBytes 로 제한되며, 가득 차면 새 레코드를 버리고 개수를 집계한다.
+// 버려진 레코드가 있으면 다음 묶음 앞에 "[network_sink] dropped N records (M bytes)" 줄을 넣는다.
+// TCP 가 연결되지 않은 동안의 묶음도 버린 것으로 집계한다.
+namespace j2::log {
+
+    class J2LIB_API network_sink final : public spdlog::sinks::base_sink<std::mutex> {
+    public:
+        enum class transport { udp, tcp };
+
+        struct options {
+            transport protocol = transport::udp;
+            std::string host;                       // 수집기 IP (IPv4/IPv6)
+            std::uint16_t port = 0;                 // 수집기 포트
+            std::size_t maxBatchBytes = 60000;      // 묶음 1개의 최대 바이트 (UDP datagram 크기)
+            unsigned flushIntervalMs = 200;         // 묶음이 차지 않아도 전송하는 주기
+            std::size_t maxQueueBytes = 4 * 1024 * 1024; // 전송 대기 버퍼 최대 바이트
+        };
+
+        struct stats {
+            std::uint64_t queuedRecords = 0;    // 버퍼에 들어간 레코드
+            std::uint64_t droppedRecords = 0;   // 버퍼 초과/미연결로 버린 레코드
+            std::uint64_t droppedBytes = 0;
+            std::uint64_t sentRecords = 0;      // 전송한 레코드
+            std::uint64_t sentBatches = 0;      // 전송한 묶음(datagram/프레임)
+            std::uint64_t sentBytes = 0;
+            std::uint64_t sendFailures = 0;     // 전송 실패한 묶음
+        };
+
+        explicit network_sink(const options& opt);
+        ~network_sink() override;
+
+        network_sink(const network_sink&) = delete;
+        network_sink& operator=(const network_sink&) = delete;
+
+        const options& getOptions() const { return opt_; }
+        stats getStats() const;
+
+    protected:
+        void sink_it_(const spdlog::details::log_msg& msg) override;
+        // 전송 스레드를 깨우기만 하고 기다리지 않는다.
+        void flush_() override;
+
+    private:
+        // 전송 대기 레코드 (버퍼 1개에 이어 붙이고 레코드 길이만 따로 보관)
+        struct pending {
+            std::string data;
+            std::vector<std::uint32_t> lengths;
+            void clear() { data.clear(); lengths.clear(); }
+        };
+
+        void shipLoop();
+        void ship(const pending& p);
+        void sendBatch(std::string& batch, std::uint64_t records);
+
+        options opt_;
+
+        std::unique_ptr<j2::network::udp::udp_sender> udp_;
+        std::unique_ptr<j2::network::tcp::tcp_client> tcp_;
+
+        mutable std::mutex queueMu_;
+        std::condition_variable queueCv_;
+        pending queue_;      // 로깅 스레드가 채우는 버퍼
+        pending shipping_;   // 전송 스레드가 비우는 버퍼 (교환하여 재사용)
+        bool flushRequested_ = false;
+        bool stop_ = false;
+
+        std::string batch_;  // 전송 스레드 전용 묶음 버퍼
+        std::uint64_t unreportedDrops_ = 0;
+        std::uint64_t unreportedDropBytes_ = 0;
+
+        std::atomic<std::uint64_t> queuedRecords_{ 0 };
+        std::atomic<std::uint64_t> droppedRecords_{ 0 };
+        std::atomic<std::uint64_t> droppedBytes_{ 0 };
+        std::atomic<std::uint64_t> sentRecords_{ 0 };
+        std::atomic<std::uint64_t> sentBatches_{ 0 };
+        std::atomic<std::uint64_t> sentBytes_{ 0 };
+        std::atomic<std::uint64_t> sendFailures_{ 0 };
+
+        std::thread shipper_;
+    };
+
+} // namespace j2::log
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <string>
+#include <mutex>
+#include <cstdint>
+#include <functional>
+
+#include <spdlog/sinks/base_sink.h>
+#include <spdlog/details/file_helper.h>
+
+#include "j2_library/export.hpp"
+#include "j2_library/log/log_index.hpp"
+
+// 크기 기반 회전 파일 싱크 (회전 훅 지원)
+//
+// spdlog::sinks::rotating_file_sink_mt 는 all.1.log, all.2.log ... 처럼 이름을 밀어내며
+// 백업 "개수"로만 보관량을 제한한다. 이 싱크는 회전 시 현재 파일을
+// 고유한 이름(all.20260101-120000-000001.log)으로 한 번만 rename 하고 훅을 호출한다.
+// 압축/삭제 같은 무거운 작업은 훅을 받은 쪽(log_archiver)이 별도 스레드에서 처리한다.
+// index_interval 을 지정하면 파일 옆에 시간 인덱스(all.log.idx)를 함께 기록하고
+// 회전 시 인덱스도 같은 이름(all.20260101-120000-000001.log.idx)으로 옮긴다.
+namespace j2::log {
+
+    // 회전 직후(싱크 락 보유 상태, 로깅 스레드)에서 호출되는 훅
+    // 인자: 회전되어 보관된 파일 경로
+    // 주의: 로깅 스레드를 막지 않도록 큐에 넣는 정도의 가벼운 작업만 수행할 것
+    using rotate_hook = std::function<void(const std::string& rotated_path)>;
+
+    class J2LIB_API rotating_archive_sink final
+        : public spdlog::sinks::base_sink<std::mutex> {
+    public:
+        // 인자:
+        //  base_filename: 현재 기록 중인 파일 경로 (예: logs/all.log)
+        //  max_size: 회전 기준 파일 크기 (바이트)
+        //  hook: 회전 직후 호출할 훅 (nullptr 허용)
+        //  index_interval: 시간 인덱스 블록 크기 (바이트, 0 이면 인덱스 미사용)
+        rotating_archive_sink(std::string base_filename,
+            std::size_t max_size,
+            rotate_hook hook = nullptr,
+            std::size_t index_interval = 0);
+
+        // 현재 기록 중인 파일 경로
+        const std::string& filename() const;
+
+        // 회전 파일 이름 생성
+        // 예: logs/all.log, seq=1 → logs/all.20260101-120000-000001.log
+        static std::string make_rotated_name(const std::string& base_filename,
+            std::uint64_t seq);
+
+        // path 가 base_filename 으로부터 회전된 보관 파일인지 판별
+        // (logs/all.*.log, logs/all.*.log.gz. spdlog 기본 백업 이름 all.1.log 도 포함)
+        static bool is_rotated_name_of(const std::string& base_filename,
+            const std::string& path);
+
+    protected:
+        void sink_it_(const spdlog::details::log_msg& msg) override;
+        void flush_() override;
+
+    private:
+        void rotate_();
+
+        std::string base_filename_;
+        std::size_t max_size_ = 0;
+        std::size_t current_size_ = 0;
+        std::uint64_t seq_ = 0;
+        spdlog::details::file_helper file_helper_;
+        rotate_hook hook_;
+        std::size_t index_interval_ = 0;
+        std::uint64_t write_offset_ = 0; // 실제 파일 내 쓰기 위치 (rename 실패 시 current_size_ 와 다름)
+        log_index_writer index_;
+    };
+
+} // namespace j2::log
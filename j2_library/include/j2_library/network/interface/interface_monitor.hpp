@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "j2_library/export.hpp"
+
+namespace j2::network::interface {
+
+struct J2LIB_API InterfaceCounters {
+    uint64_t rx_bytes = 0;
+    uint64_t tx_bytes = 0;
+    uint64_t rx_packets = 0;
+    uint64_t tx_packets = 0;
+    uint64_t rx_errors = 0;
+    uint64_t tx_errors = 0;
+    uint64_t rx_dropped = 0;
+    uint64_t tx_dropped = 0;
+};
+
+// 직전 샘플 대비 변화량 (첫 샘플 / 새로 나타난 인터페이스는 0)
+struct J2LIB_API InterfaceRates {
+    double rx_bytes_per_sec = 0;
+    double tx_bytes_per_sec = 0;
+    double rx_packets_per_sec = 0;
+    double tx_packets_per_sec = 0;
+    uint64_t rx_errors = 0;   // 구간 동안 증가한 개수
+    uint64_t tx_errors = 0;
+    uint64_t rx_dropped = 0;
+    uint64_t tx_dropped = 0;
+};
+
+struct J2LIB_API InterfaceSample {
+    int index = 0;             // ifindex
+    std::string name;
+    bool is_up = false;        // 관리 상태 (IFF_UP)
+    bool is_running = false;   // 링크 상태 (IFF_RUNNING)
+    InterfaceCounters counters;
+    InterfaceRates rates;
+};
+
+struct J2LIB_API LinkEvent {
+    int index = 0;
+    std::string name;
+    bool is_up = false;
+    bool is_running = false;
+    bool removed = false;      // 인터페이스 삭제 (RTM_DELLINK)
+};
+
+class J2LIB_API InterfaceMonitor {
+public:
+    using LinkCallback = std::function<void(const LinkEvent&)>;
+
+    InterfaceMonitor() = default;
+    ~InterfaceMonitor();
+
+    InterfaceMonitor(const InterfaceMonitor&) = delete;
+    InterfaceMonitor& operator=(const InterfaceMonitor&) = delete;
+
+    /**
+        * @brief 모든 인터페이스의 누적 카운터와 직전 sample() 대비 초당 속도를 가져옵니다.
+        * Linux 는 rtnetlink RTM_GETLINK 덤프 한 번(IFLA_STATS64)으로 전체를 읽고 소켓/버퍼를 재사용하며,
+        * 그 외 플랫폼은 InterfaceManager::get_interfaces() 의 바이트 카운터만 사용합니다.
+        */
+    std::vector<InterfaceSample> sample();
+
+    /**
+        * @brief 링크 up/down 이벤트를 폴링 없이 구독합니다 (Linux, RTMGRP_LINK).
+        * 상태(is_up/is_running)가 바뀌었거나 인터페이스가 삭제되었을 때만 별도 스레드에서 콜백을 호출합니다.
+        */
+    bool start_link_events(LinkCallback cb);
+    void stop_link_events();
+
+private:
+    struct previous {
+        InterfaceCounters counters;
+        std::chrono::steady_clock::time_point time;
+    };
+
+    void link_event_loop(int fd, std::unordered_map<int, LinkEvent> known);
+
+    std::mutex sample_mutex;
+    int dump_fd = -1;
+    uint32_t dump_seq = 0;
+    std::vector<char> dump_buffer;
+    std::unordered_map<std::string, previous> previous_samples;   // 이름별 직전 샘플
+
+    std::thread event_thread;
+    std::atomic<bool> events_running{ false };
+    LinkCallback on_link;
+};
+
+} // namespace j2::network::interface
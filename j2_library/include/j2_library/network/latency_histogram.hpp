@@ -0,0 +1,50 @@
+#pragma once
+
+#include "j2_library/export.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace j2::network {
+
+// Lock-free histogram of nanosecond latencies: log2 buckets split into 8 linear sub-buckets
+// (values are kept to within 12.5%). record() is wait-free and may be called from any thread;
+// the summary getters read the counters without stopping writers.
+//
+//   latency_histogram h;
+//   h.record(elapsed_ns);
+//   h.percentile(0.99);   // ns
+class J2LIB_API latency_histogram {
+public:
+    static constexpr std::size_t SUB_BUCKETS = 8;
+    static constexpr std::size_t BUCKET_COUNT = 41 * SUB_BUCKETS; // up to 2^43 ns (~2.4 h)
+
+    void record(std::uint64_t ns);
+    void reset();
+
+    std::uint64_t count() const;
+    std::uint64_t min() const;     // 0 when empty
+    std::uint64_t max() const;
+    double mean() const;
+
+    // Lower bound of the bucket holding the p-th value (p in [0, 1]); 0 when empty
+    std::uint64_t percentile(double p) const;
+
+    // "count=1000 mean=12.3us p50=10.2us p99=40.9us p99.9=81.9us max=95.1us"
+    std::string to_string() const;
+
+private:
+    static std::size_t bucket_of(std::uint64_t ns);
+    static std::uint64_t bucket_floor(std::size_t index);
+
+    std::array<std::atomic<std::uint64_t>, BUCKET_COUNT> buckets{};
+    std::atomic<std::uint64_t> total{ 0 };
+    std::atomic<std::uint64_t> sum{ 0 };
+    std::atomic<std::uint64_t> lowest{ UINT64_MAX };
+    std::atomic<std::uint64_t> highest{ 0 };
+};
+
+} // namespace j2::network
@@ -18,17 +18,36 @@
 //     using asio_error_code_t = boost::system::error_code;
 // #endif
 
+// Socket tuning profile (TCP_NODELAY, buffers, keepalive, ...) shared by the TCP/UDP classes
+#include "j2_library/network/socket_options.hpp"
+
+// Lock-free latency histogram (percentiles) used by the network measurements
+#include "j2_library/network/latency_histogram.hpp"
+
 // TCP-related utilities and type definitions
+#include "j2_library/network/tcp/tcp_framing.hpp"
+#include "j2_library/network/tcp/connection_stats.hpp"
 #include "j2_library/network/tcp/tcp_server.hpp"
 #include "j2_library/network/tcp/tcp_client.hpp"
+#include "j2_library/network/tcp/tcp_client_pool.hpp"
 
 // UDP-related utilities and type definitions
 #include "j2_library/network/udp/udp_receiver.hpp"
+#include "j2_library/network/udp/udp_receiver_group.hpp"
 #include "j2_library/network/udp/udp_sender.hpp"
+#include "j2_library/network/udp/udp_recorder.hpp"
+#include "j2_library/network/udp/udp_replayer.hpp"
+#include "j2_library/network/udp/udp_typed_pubsub.hpp"
+
+// Same-host pub/sub over a shared-memory ring (Linux)
+#include "j2_library/network/shm/shm_publisher.hpp"
+#include "j2_library/network/shm/shm_subscriber.hpp"
 
 // Rest API (libcurl 사용)
+#include "j2_library/network/rest/rest_session.hpp"
 #include "j2_library/network/rest/curl_get_client.hpp"
 #include "j2_library/network/rest/curl_post_client.hpp"
+#include "j2_library/network/rest/curl_async_client.hpp"
 
 // FTP/SFTP 클라이언트 구현 (libcurl 사용)    
 #include "j2_library/network/ftp/ftp_client.hpp" 
@@ -37,7 +56,8 @@
 #include "j2_library/network/downloader/downloader.hpp" 
 
 // 네트워크 인터페이스 정보 및 통계 조회
-#include "j2_library/network/interface/network_interface.hpp" 
+#include "j2_library/network/interface/network_interface.hpp"
+#include "j2_library/network/interface/interface_monitor.hpp" 
 
 
 
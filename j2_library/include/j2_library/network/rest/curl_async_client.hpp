@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include <curl/curl.h>
+
+#include "j2_library/export.hpp"
+#include "j2_library/network/rest/curl_get_client.hpp"
+#include "j2_library/network/rest/curl_post_client.hpp"
+#include "j2_library/network/rest/rest_session.hpp"
+
+namespace j2::network::rest {
+
+// curl_multi 기반 비동기 REST 클라이언트
+//  - 이벤트 루프 스레드 하나가 모든 요청을 동시에 처리 (요청당 스레드 없음)
+//  - get_async/post_async 는 즉시 반환하고 future 또는 콜백(이벤트 루프 스레드에서 호출)으로 결과 전달
+//  - 전체/호스트별 동시 요청 수 상한: 초과분은 대기열에서 순서대로 시작 (타임아웃은 시작 시점부터)
+//  - 결과는 기존 curl_get_client::response / curl_post_client::response 이며 각 classify() 로 분류
+//
+//   curl_async_client client;
+//   std::vector<std::future<curl_async_client::get_response>> futures;
+//   for (const auto& url : urls) futures.push_back(client.get_async(url));
+//   for (auto& f : futures) { auto r = f.get(); ... curl_get_client::classify(r) ... }
+class J2LIB_API curl_async_client
+{
+public:
+    using get_response = curl_get_client::response;
+    using post_response = curl_post_client::response;
+    using query_params = curl_get_client::query_params;
+    using headers = curl_get_client::headers;
+
+    using get_callback = std::function<void(get_response)>;
+    using post_callback = std::function<void(post_response)>;
+
+    static constexpr std::size_t default_max_total = 64;
+    static constexpr std::size_t default_max_per_host = 8;
+
+    curl_async_client();
+    ~curl_async_client(); // 미완료 요청은 취소되어 오류 응답으로 완료됨
+
+    curl_async_client(const curl_async_client&) = delete;
+    curl_async_client& operator=(const curl_async_client&) = delete;
+
+    // 이후 요청에 적용되는 설정
+    void set_headers(const headers& new_headers);
+    void set_timeout_ms(long timeout_ms);
+    void set_ignore_ssl_errors(bool ignore);
+
+    // 동시 요청 상한 (0 이면 무제한). 호스트는 URL 의 "host[:port]" 기준
+    void set_max_concurrency(std::size_t total, std::size_t per_host);
+
+    // rest_session 연결 시 해당 세션의 easy 핸들/DNS/TLS 세션을 사용 (nullptr 이면 해제)
+    void set_session(rest_session* session);
+
+    // url: "http://host:port/path" (query_params 는 URL 인코딩되어 뒤에 붙음)
+    std::future<get_response> get_async(const std::string& url, const query_params& params = {});
+    void get_async(const std::string& url, const query_params& params, get_callback cb);
+
+    // body 를 그대로 전송 (Content-Type 등은 set_headers 로 지정)
+    std::future<post_response> post_async(const std::string& url, const std::string& body);
+    void post_async(const std::string& url, const std::string& body, post_callback cb);
+
+    std::size_t pending() const; // 대기 중 + 진행 중 요청 수
+
+private:
+    struct job;
+
+    void submit(std::unique_ptr<job> j);
+    void event_loop();
+    void admit_pending();
+    bool start_job(job& j);
+    void finish_job(CURL* curl, CURLcode code);
+    void complete(job& j, CURLcode code, const std::string& error);
+    void wakeup();
+
+    static size_t write_callback(char* ptr, size_t size, size_t nmemb, void* userdata);
+    static size_t header_callback(char* buffer, size_t size, size_t nitems, void* userdata);
+
+    CURLM* multi_ = nullptr;
+
+    mutable std::mutex mutex_;                    // 아래 설정/대기열 보호
+    headers headers_;
+    long timeout_ms_ = 30000;                     // 30 seconds
+    bool ignore_ssl_errors_ = false;
+    rest_session* session_ = nullptr;
+    std::size_t max_total_ = default_max_total;
+    std::size_t max_per_host_ = default_max_per_host;
+    std::deque<std::unique_ptr<job>> queue_;
+    std::size_t in_flight_ = 0;
+    std::unordered_map<std::string, std::size_t> per_host_;   // 호스트별 진행 중 요청 수
+
+    // 이벤트 루프 스레드 전용
+    std::unordered_map<CURL*, std::unique_ptr<job>> active_;
+
+    std::atomic<bool> running_{ true };
+    std::thread loop_thread_;
+};
+
+} // namespace j2::network::rest
@@ -10,6 +10,7 @@
 #include <curl/curl.h>
 
 #include "j2_library/export.hpp"
+#include "j2_library/network/rest/rest_session.hpp"
 
 namespace j2::network::rest {
 
@@ -90,6 +91,10 @@ public:
     // SSL 인증서 오류 무시 여부 설정
     void set_ignore_ssl_errors(bool ignore);
 
+    // 공유 세션 연결 (nullptr 이면 해제). 연결 중에는 세션 풀의 easy 핸들로 요청하여
+    // 다른 클라이언트와 easy 핸들(keep-alive 연결 포함)/DNS/TLS 세션을 공유합니다. 예: set_session(&rest_session::instance())
+    void set_session(rest_session* session);
+
     // POST 요청 실행 (예외 발생 가능)
     response post(const std::string& body);
 
@@ -112,6 +117,8 @@ private:
 
     bool ignore_ssl_errors_ = false;
 
+    rest_session* session_ = nullptr;
+
     static void global_init();
     static size_t write_callback(char* ptr, size_t size, size_t nmemb, void* userdata);
     static size_t header_callback(char* buffer, size_t size, size_t nitems, void* userdata);
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include <curl/curl.h>
+
+#include "j2_library/export.hpp"
+
+namespace j2::network::rest {
+
+// 여러 REST 클라이언트가 함께 쓰는 curl 세션
+//  - CURLSH 공유 핸들: DNS 캐시, TLS 세션(재개)
+//  - easy 핸들 풀: 요청마다 curl_easy_init 하지 않고 반납된 핸들을 재사용.
+//    keep-alive 연결은 각 easy 핸들이 자기 연결 캐시에 들고 있으므로 핸들과 함께 재사용됩니다.
+// 같은 몇몇 호스트로 반복 요청할 때, 클라이언트 객체를 새로 만들어도 TCP/TLS 핸드셰이크를 다시 하지 않습니다.
+//
+// 연결 캐시(CURL_LOCK_DATA_CONNECT)는 공유하지 않습니다: libcurl 은 여러 스레드가 동시에 쓰는
+// 공유 연결 캐시를 지원하지 않습니다. 핸들 하나는 한 번에 한 스레드만 쓰므로 연결도 그렇습니다.
+//
+//   curl_get_client client;
+//   client.set_session(&rest_session::instance());
+//
+// 스레드 안전: 여러 스레드의 클라이언트가 같은 세션을 동시에 사용할 수 있습니다.
+// 세션은 연결된 모든 클라이언트보다 오래 살아 있어야 합니다.
+class J2LIB_API rest_session
+{
+public:
+    // 풀에서 빌린 easy 핸들. 소멸 시 curl_easy_reset 후 풀로 반납 (연결/캐시는 유지)
+    class J2LIB_API easy_handle
+    {
+    public:
+        easy_handle() = default;
+        ~easy_handle();
+
+        easy_handle(easy_handle&& other) noexcept;
+        easy_handle& operator=(easy_handle&& other) noexcept;
+        easy_handle(const easy_handle&) = delete;
+        easy_handle& operator=(const easy_handle&) = delete;
+
+        CURL* get() const { return curl_; }
+        explicit operator bool() const { return curl_ != nullptr; }
+
+    private:
+        friend class rest_session;
+        easy_handle(rest_session* session, CURL* curl) : session_(session), curl_(curl) {}
+
+        rest_session* session_ = nullptr;
+        CURL* curl_ = nullptr;
+    };
+
+    static constexpr std::size_t default_max_idle_handles = 16;
+
+    explicit rest_session(std::size_t max_idle_handles = default_max_idle_handles);
+    ~rest_session();
+
+    rest_session(const rest_session&) = delete;
+    rest_session& operator=(const rest_session&) = delete;
+
+    // 프로세스 전역 세션
+    static rest_session& instance();
+
+    // 공유 핸들이 설정된 easy 핸들을 빌림 (예외 발생 가능: curl_easy_init 실패)
+    easy_handle acquire();
+
+    // 풀에 남겨 둘 최대 유휴 핸들 수 (초과분은 반납 시 정리)
+    void set_max_idle_handles(std::size_t count);
+
+    std::size_t idle_handles() const;
+    std::size_t created_handles() const;   // 지금까지 새로 만든 easy 핸들 수
+
+private:
+    void release(CURL* curl) noexcept;
+
+    static void lock_callback(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr);
+    static void unlock_callback(CURL* handle, curl_lock_data data, void* userptr);
+
+    CURLSH* share_ = nullptr;
+    std::mutex share_locks_[CURL_LOCK_DATA_LAST];   // curl_lock_data 별 잠금
+
+    mutable std::mutex pool_mutex_;
+    std::vector<CURL*> idle_;
+    std::size_t max_idle_ = default_max_idle_handles;
+    std::size_t created_ = 0;
+};
+
+} // namespace j2::network::rest
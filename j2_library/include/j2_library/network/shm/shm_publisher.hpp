@@ -0,0 +1,51 @@
+#pragma once
+
+#include "j2_library/export.hpp"
+#include "j2_library/network/ethernet.hpp"
+#include "j2_library/network/shm/shm_ring.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace j2::network::shm {
+
+    // Publishes messages into a named shared-memory ring (see shm_ring.hpp), the same-host
+    // counterpart of udp_sender: no kernel copies, no 64 KB datagram limit (messages up to half
+    // the ring). One publisher per segment; send_data is thread-safe within the process.
+    //
+    //   shm_publisher pub;
+    //   pub.create("/j2_person", 16 << 20);
+    //   pub.send_data(json.dump());
+    class J2LIB_API shm_publisher {
+    public:
+        static constexpr std::size_t DEFAULT_CAPACITY = 4 * 1024 * 1024;
+
+        shm_publisher() = default;
+        ~shm_publisher();
+
+        shm_publisher(const shm_publisher&) = delete;
+        shm_publisher& operator=(const shm_publisher&) = delete;
+
+        // Creates the segment; fails if the name already exists. With unlink_on_stop the name is
+        // removed by stop(). mode: permission bits (default owner only; 0660 to share with a group)
+        bool create(const std::string& name, std::size_t capacity = DEFAULT_CAPACITY, bool unlink_on_stop = true,
+            unsigned mode = 0600);
+
+        // Returns the payload size, or -1 when not created or the message is larger than
+        // max_message_size()
+        ssize_t send_data(const void* data, std::size_t size);
+        ssize_t send_data(const std::string& data);
+
+        std::size_t max_message_size() const { return segment.max_message_size(); }
+        void stop();
+
+    private:
+        shm_segment segment;
+        std::mutex send_mutex;
+        std::uint64_t next_seq = 0;
+        bool unlink_on_stop = true;
+    };
+
+}  // namespace j2::network::shm
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "j2_library/export.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace j2::network::shm {
+
+    // Layout of a shared-memory pub/sub segment (POSIX shm_open name, e.g. "/j2_prices").
+    //
+    // One publisher appends variable-size records to a byte ring; any number of subscribers read
+    // it independently, each with its own position. There is no back pressure: a subscriber that
+    // falls more than a ring behind loses the overwritten records (they are counted) and resumes
+    // at the current write position. Writes are checked seqlock-style: the publisher advances `reserve_pos`
+    // before overwriting old bytes and `write_pos` after the record is complete, and a reader
+    // keeps a record only if `reserve_pos` shows that its bytes were not reused while copying.
+    //
+    // Record: u64 sequence number, u32 payload size, u32 flags (WRAP_RECORD: skip to the start of
+    // the ring), payload, padded to 16 bytes so a record header always fits before the end of the
+    // ring. Sequence gaps give the drop count. Idle subscribers sleep on a futex on `notify_seq`.
+    struct ring_header {
+        static constexpr std::uint64_t MAGIC = 0x4a32534d52494e47ull; // "J2SMRING"
+        static constexpr std::uint32_t VERSION = 1;
+
+        std::uint64_t magic;
+        std::uint32_t version;
+        std::uint32_t header_size;
+        std::uint64_t capacity;                      // ring bytes, power of two
+
+        alignas(64) std::atomic<std::uint64_t> reserve_pos;  // publisher may be writing below this
+        alignas(64) std::atomic<std::uint64_t> write_pos;    // end of the last complete record
+        alignas(64) std::atomic<std::uint32_t> notify_seq;   // futex word, bumped per publish
+        std::atomic<std::uint32_t> waiters;                  // subscribers sleeping on notify_seq
+    };
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "shared-memory atomics must be lock free");
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "shared-memory atomics must be lock free");
+
+    struct record_header {
+        std::uint64_t seq;
+        std::uint32_t size;
+        std::uint32_t flags;
+    };
+    static_assert(sizeof(record_header) == 16, "record header layout");
+    constexpr std::uint32_t WRAP_RECORD = 1;
+
+    constexpr std::size_t record_span(std::size_t payload) {
+        return (sizeof(record_header) + payload + 15) & ~std::size_t{ 15 };
+    }
+
+    // Mapping of a segment: created (and initialized) by the publisher, opened by subscribers.
+    // Linux only; elsewhere create/open fail.
+    class J2LIB_API shm_segment {
+    public:
+        shm_segment() = default;
+        ~shm_segment();
+
+        shm_segment(const shm_segment&) = delete;
+        shm_segment& operator=(const shm_segment&) = delete;
+
+        // capacity is rounded up to a power of two (at least 4 KB). Fails if the name already
+        // exists: it may belong to a live publisher (remove a stale one with unlink()).
+        // mode: permission bits of the new object (default owner only)
+        bool create(const std::string& name, std::size_t capacity, unsigned mode = 0600);
+        bool open(const std::string& name);
+        void close();
+        void unlink();   // remove the name; existing mappings stay valid
+
+        bool is_open() const { return header_ != nullptr; }
+        ring_header* header() const { return header_; }
+        std::byte* data() const { return data_; }
+        std::size_t capacity() const { return header_ ? static_cast<std::size_t>(header_->capacity) : 0; }
+        // Largest payload one record may carry (half the ring)
+        std::size_t max_message_size() const { return capacity() / 2 - sizeof(record_header); }
+
+        // Futex helpers on notify_seq (cross-process, no FUTEX_PRIVATE_FLAG)
+        void notify_all();
+        void wait(std::uint32_t seen, int timeout_ms);
+
+    private:
+        std::string name_;
+        void* map_ = nullptr;
+        std::size_t map_size_ = 0;
+        ring_header* header_ = nullptr;
+        std::byte* data_ = nullptr;
+    };
+
+}  // namespace j2::network::shm
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "j2_library/export.hpp"
+#include "j2_library/network/shm/shm_ring.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace j2::network::shm {
+
+    // Receives the messages of a shm_publisher on a background thread, the same-host counterpart
+    // of udp_receiver. Starts with the next message published after start(). Each message is
+    // copied once out of the ring into a reusable buffer; the view is valid during the callback.
+    class J2LIB_API shm_subscriber {
+    public:
+        using Callback = std::function<void(std::string_view)>;
+
+        shm_subscriber() = default;
+        ~shm_subscriber();
+
+        shm_subscriber(const shm_subscriber&) = delete;
+        shm_subscriber& operator=(const shm_subscriber&) = delete;
+
+        void setOnReceiveCallback(Callback cb);
+
+        // Fails if the publisher has not created the segment yet
+        bool start(const std::string& name);
+        void quit();
+
+        // Messages overwritten before this subscriber could read them
+        std::uint64_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+    protected:
+        void receiveLoop(std::uint64_t read_pos);
+
+        shm_segment segment;
+        Callback on_receive;
+        std::thread receiver_thread;
+        std::atomic<bool> is_running{ false };
+        std::atomic<std::uint64_t> dropped{ 0 };
+        std::vector<char> buffer;
+    };
+
+}  // namespace j2::network::shm
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "j2_library/export.hpp"
+
+#include <optional>
+
+namespace j2::network {
+
+// Socket tuning shared by tcp_server, tcp_client, tcp_client_pool, udp_sender and udp_receiver.
+// Options left unset keep the system default. TCP-only options are skipped on UDP sockets and
+// options the platform does not have are ignored.
+//
+//   auto opts = j2::network::socket_options::low_latency();
+//   opts.send_buffer = 1 << 20;
+//   j2::network::tcp::tcp_client client(opts);
+struct J2LIB_API socket_options {
+    std::optional<bool> tcp_nodelay;               // TCP_NODELAY: disable Nagle
+    std::optional<bool> tcp_quickack;              // TCP_QUICKACK (Linux): re-armed after every read
+    std::optional<int> send_buffer;                // SO_SNDBUF bytes (Linux doubles it, capped by wmem_max)
+    std::optional<int> receive_buffer;             // SO_RCVBUF bytes (capped by rmem_max)
+    std::optional<int> busy_poll_us;               // SO_BUSY_POLL (Linux; above net.core.busy_poll needs CAP_NET_ADMIN)
+    std::optional<bool> keepalive;                 // SO_KEEPALIVE
+    std::optional<int> keepalive_idle_s;           // TCP_KEEPIDLE: idle time before the first probe
+    std::optional<int> keepalive_interval_s;       // TCP_KEEPINTVL
+    std::optional<int> keepalive_count;            // TCP_KEEPCNT: unanswered probes before the drop
+    std::optional<unsigned> tcp_user_timeout_ms;   // TCP_USER_TIMEOUT (Linux): max time data may stay unacknowledged
+    std::optional<int> priority;                   // SO_PRIORITY (Linux; 0..6 without CAP_NET_ADMIN)
+
+    // Small messages, fast reaction: no Nagle, immediate ACKs, high queueing priority and quick
+    // dead-peer detection (keepalive 5s/1s/3, 5s user timeout)
+    static socket_options low_latency();
+    // Large transfers: Nagle on, 4 MB socket buffers, lenient keepalive (60s/10s/5)
+    static socket_options bulk_throughput();
+
+    // Apply to a socket (the type is read with SO_TYPE). Every option is attempted; failures
+    // are reported on std::cerr and make the result false.
+    bool apply(int fd) const;
+
+    // TCP_QUICKACK is cleared by the kernel; call after reads when tcp_quickack is set
+    void rearm_quickack(int fd) const;
+};
+
+} // namespace j2::network
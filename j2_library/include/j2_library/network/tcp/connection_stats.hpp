@@ -0,0 +1,103 @@
+#pragma once
+
+#include "j2_library/export.hpp"
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace j2::network::tcp {
+
+// Snapshot of one TCP connection: application counters kept by tcp_server / tcp_client plus the
+// kernel's view sampled on demand with getsockopt(TCP_INFO) and the SIOCOUTQ/SIOCINQ ioctls.
+// Kernel fields stay zero (tcp_info_valid == false) where TCP_INFO is not available.
+struct J2LIB_API connection_stats {
+    int socket = -1;
+
+    // Application level (what was handed to / delivered by the library)
+    std::uint64_t bytes_in = 0;
+    std::uint64_t bytes_out = 0;
+    std::uint64_t messages_in = 0;
+    std::uint64_t messages_out = 0;
+    std::uint64_t app_queued_bytes = 0;    // tcp_server Epoll send queue, not yet written
+
+    // Kernel level
+    bool tcp_info_valid = false;
+    std::uint8_t state = 0;                // TCP_ESTABLISHED, ...
+    std::uint32_t rtt_us = 0;              // smoothed round trip time
+    std::uint32_t rtt_var_us = 0;
+    std::uint32_t rto_us = 0;
+    std::uint32_t snd_cwnd = 0;            // congestion window (segments)
+    std::uint32_t snd_mss = 0;
+    std::uint32_t unacked = 0;             // segments in flight
+    std::uint32_t lost = 0;
+    std::uint32_t retransmits = 0;         // segments currently being retransmitted
+    std::uint32_t total_retrans = 0;       // retransmissions over the connection's lifetime
+    std::uint32_t send_queue_bytes = 0;    // written but not yet acknowledged by the peer
+    std::uint32_t recv_queue_bytes = 0;    // received but not yet read
+
+    // Fill the kernel fields for `fd` (one getsockopt and two ioctls). Returns tcp_info_valid.
+    bool sample(int fd);
+
+    // One line, for logs: "fd=7 rtt=0.05ms/0.02ms rto=204ms cwnd=10 ..."
+    std::string to_string() const;
+};
+
+// Per-connection application counters, updated on the I/O path with relaxed atomics
+struct J2LIB_API traffic_counters {
+    std::atomic<std::uint64_t> bytes_in{ 0 };
+    std::atomic<std::uint64_t> bytes_out{ 0 };
+    std::atomic<std::uint64_t> messages_in{ 0 };
+    std::atomic<std::uint64_t> messages_out{ 0 };
+
+    void received(std::size_t bytes) { bytes_in.fetch_add(bytes, std::memory_order_relaxed); }
+    void delivered(std::size_t messages) { messages_in.fetch_add(messages, std::memory_order_relaxed); }
+    void sent(std::size_t bytes) {
+        bytes_out.fetch_add(bytes, std::memory_order_relaxed);
+        messages_out.fetch_add(1, std::memory_order_relaxed);
+    }
+    void reset();
+    void copy_to(connection_stats& out) const;
+};
+
+// Background thread that collects stats every `interval` and hands them to a sink
+// (default: one to_string() line per connection on std::cout).
+class J2LIB_API stats_dumper {
+public:
+    using Source = std::function<std::vector<connection_stats>()>;
+    using Sink = std::function<void(const std::vector<connection_stats>&)>;
+
+    stats_dumper() = default;
+    ~stats_dumper();
+
+    stats_dumper(const stats_dumper&) = delete;
+    stats_dumper& operator=(const stats_dumper&) = delete;
+
+    bool start(std::chrono::milliseconds interval, Source source, Sink sink = nullptr);
+    // May be called from the sink: the thread then exits after the sink returns and is joined
+    // by the next start(), stop() from another thread, or the destructor. The dumper may also be
+    // destroyed from its sink (the thread is detached and exits on its own).
+    void stop();
+    bool is_running() const;
+
+protected:
+    // Co-owned by the thread, so the loop never touches a destroyed dumper
+    struct loop_state {
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool stopping = false;
+    };
+
+    std::thread thread;
+    std::shared_ptr<loop_state> state;
+};
+
+} // namespace j2::network::tcp
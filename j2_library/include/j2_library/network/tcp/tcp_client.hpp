@@ -2,6 +2,9 @@
 
 #include "j2_library/export.hpp"
 #include "j2_library/network/ethernet.hpp"
+#include "j2_library/network/tcp/tcp_framing.hpp"
+#include "j2_library/network/tcp/connection_stats.hpp"
+#include "j2_library/network/socket_options.hpp"
 
 #include <string>
 #include <functional>
@@ -15,6 +18,7 @@
 #include <sstream>
 #include <cstring> // for memset
 #include <cstdint>
+#include <string_view>
 
 namespace j2::network::tcp {
 
@@ -22,6 +26,8 @@ class J2LIB_API tcp_client {
 public:
     using Callback = std::function<void()>;
     using ReceiveCallback = std::function<void(const std::string&)>;
+    // Complete message (see set_framing). The view is only valid during the call.
+    using MessageCallback = std::function<void(std::string_view)>;
 
 protected:
     std::string server_ip;
@@ -34,17 +40,27 @@ protected:
 #endif
     std::thread client_thread;
     std::atomic<bool> stop_flag;
+    std::atomic<bool> connected; // socket_fd published; written under send_mutex
     std::mutex send_mutex;
     Callback on_connect;
     Callback on_close;
     ReceiveCallback on_receive;
+    MessageCallback on_message;
+    frame_decoder decoder; // receive buffer, reused across reads and reconnects
+    socket_options options;
+    traffic_counters traffic; // current connection, reset on connect
+    stats_dumper stats_dump;
 
     static constexpr int BUFFER_SIZE = 1024;
 
 public:
     tcp_client();
+    explicit tcp_client(const socket_options& options);
     ~tcp_client();
 
+    // Applied to every socket before it connects (set before start())
+    void set_socket_options(const socket_options& options);
+
     // address_family: AF_INET (default) or AF_INET6
     void setServer(const std::string& ip, unsigned short port, int address_family = AF_INET);
 
@@ -52,13 +68,32 @@ public:
     void set_on_close(Callback cb);
     void set_on_receive(ReceiveCallback cb);
 
+    // Split the byte stream into messages before delivery (default: framing::none()).
+    // Set before start(). Messages go to on_message when set, otherwise to on_receive.
+    // A message that violates the framing closes the connection.
+    void set_framing(const framing& f);
+    void set_on_message(MessageCallback cb);
+
     bool start(std::chrono::seconds sleep_time = std::chrono::seconds(1));
     void stop();
     int send_data(const std::string& data);
+    // Write all `size` bytes, retrying partial writes. If the connection fails partway it is
+    // closed (and reconnected by the client thread), so the peer never sees a truncated frame
+    // followed by the next one. Returns false when not connected or on failure.
+    bool send_all(const char* data, std::size_t size);
     void close_connection();
     bool is_connected() const;
 
+    // Byte/message counters of the current connection plus a TCP_INFO sample (RTT, retransmits,
+    // kernel send/receive queue depth) taken now
+    connection_stats get_stats();
+    // Dump get_stats() every `interval` from a background thread until stop_stats_dump() or
+    // stop() (default sink: one line on std::cout)
+    bool start_stats_dump(std::chrono::milliseconds interval, stats_dumper::Sink sink = nullptr);
+    void stop_stats_dump();
+
 protected:
+    void close_connection_locked(); // send_mutex held
     void connect_to_server(std::chrono::seconds sleep_time = std::chrono::seconds(1));
     void receive_loop();
 };
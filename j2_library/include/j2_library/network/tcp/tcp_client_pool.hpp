@@ -0,0 +1,149 @@
+#pragma once
+
+#include "j2_library/export.hpp"
+#include "j2_library/network/ethernet.hpp"
+#include "j2_library/network/tcp/tcp_framing.hpp"
+#include "j2_library/network/tcp/tcp_client.hpp"
+#include "j2_library/network/socket_options.hpp"
+
+#include <string>
+#include <string_view>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <deque>
+#include <vector>
+#include <unordered_map>
+#include <map>
+#include <random>
+#include <cstddef>
+
+namespace j2::network::tcp {
+
+// Many outbound TCP connections served by one event loop thread (epoll on Linux).
+//
+// Each connection is identified by the id returned from add() and has its own callbacks of the
+// same types as tcp_client. Connects are non-blocking and give up after connect_timeout; a failed,
+// timed-out or dropped connection is retried with exponential backoff (initial_backoff, doubled up
+// to max_backoff, with +-20% jitter).
+// Sends never block: what the socket does not take is queued and flushed when it drains.
+// Callbacks run on the loop thread.
+//
+// Other platforms fall back to one tcp_client (and thread) per connection.
+class J2LIB_API tcp_client_pool {
+public:
+    using Callback = tcp_client::Callback;
+    using ReceiveCallback = tcp_client::ReceiveCallback;
+    using MessageCallback = tcp_client::MessageCallback;
+
+protected:
+    struct entry {
+        int id = -1;
+        std::string server_ip;
+        unsigned short server_port = 0;
+        int address_family = AF_INET;
+
+        Callback on_connect;
+        Callback on_close;
+        ReceiveCallback on_receive;
+        MessageCallback on_message;
+        frame_decoder decoder;
+
+        // Shared with send_data() callers, guarded by mutex
+        std::mutex mutex;
+        int fd = -1;
+        bool connected = false;
+        std::deque<std::string> queue;     // unsent data; the front may be partly sent
+        std::size_t front_offset = 0;
+        bool want_write = false;
+
+        // Loop thread only
+        bool connecting = false;
+        std::chrono::milliseconds backoff{ 0 };
+        std::chrono::steady_clock::time_point next_attempt{};
+        std::chrono::steady_clock::time_point connect_deadline{};
+
+        std::unique_ptr<tcp_client> fallback; // platforms without epoll
+    };
+
+    mutable std::mutex entries_mutex;
+    std::unordered_map<int, std::shared_ptr<entry>> entries;
+    int next_id = 0;
+
+    std::chrono::milliseconds initial_backoff{ 100 };
+    std::chrono::milliseconds max_backoff{ 30000 };
+    std::chrono::milliseconds connect_timeout{ 10000 };
+    socket_options options;
+
+    std::thread loop_thread;
+    std::atomic<bool> running{ false };
+    int epoll_fd = -1;
+    int wake_fd = -1;
+    std::mutex command_mutex;
+    std::vector<int> to_connect;           // start(id) / start() requests for the loop
+    std::vector<int> to_remove;
+    std::multimap<std::chrono::steady_clock::time_point, int> retries; // loop thread only
+    std::multimap<std::chrono::steady_clock::time_point, int> deadlines; // loop thread only
+    std::minstd_rand jitter;
+
+public:
+    tcp_client_pool();
+    ~tcp_client_pool();
+
+    tcp_client_pool(const tcp_client_pool&) = delete;
+    tcp_client_pool& operator=(const tcp_client_pool&) = delete;
+
+    // Backoff between connection attempts (set before start())
+    void set_backoff(std::chrono::milliseconds initial, std::chrono::milliseconds max);
+    // A connect still pending after this long is abandoned and retried with backoff; 0 waits for
+    // the kernel to give up (set before start())
+    void set_connect_timeout(std::chrono::milliseconds timeout);
+    // Applied to every connection's socket before it connects (set before start())
+    void set_socket_options(const socket_options& options);
+
+    // Register a server and return its connection id (-1 when ip/port are empty).
+    // Registered connections are opened by start(); one added while running waits for start(id).
+    // address_family: AF_INET (default) or AF_INET6
+    int add(const std::string& ip, unsigned short port, int address_family = AF_INET);
+    // Closes the connection (on_close is called if it was established) and forgets the id
+    void remove(int id);
+
+    // Per-connection callbacks and framing. Set them before the connection is started.
+    void set_on_connect(int id, Callback cb);
+    void set_on_close(int id, Callback cb);
+    void set_on_receive(int id, ReceiveCallback cb);
+    void set_on_message(int id, MessageCallback cb);
+    void set_framing(int id, const framing& f);
+
+    bool start();
+    bool start(int id);
+    void stop();
+
+    // Returns data.size() once written or queued, -1 when the connection is not established
+    int send_data(int id, const std::string& data);
+    bool is_connected(int id) const;
+    std::size_t size() const;
+    std::size_t connected_count() const;
+
+protected:
+    std::shared_ptr<entry> find(int id) const;
+
+    void loop();
+    void wake();
+    void runCommands();
+    void connectEntry(entry& e);
+    void finishConnect(entry& e);
+    bool readEntry(entry& e);
+    bool flushEntry(entry& e);
+    void dropEntry(entry& e);
+    void scheduleRetry(entry& e);
+    void updateInterest(entry& e);
+    int nextTimeoutMs() const;
+    void retryDue();
+    void expireConnects();
+};
+
+} // namespace j2::network::tcp
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "j2_library/export.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace j2::network::tcp {
+
+// How a TCP byte stream is split into messages.
+//  None         : every received chunk is delivered as is (no framing)
+//  LengthPrefix : [length (prefix_bytes, big- or little-endian)][payload]
+//  Delimiter    : payload terminated by `delimiter` (the delimiter is not delivered)
+//  FixedSize    : every message is exactly `fixed_size` bytes
+struct J2LIB_API framing {
+    enum class Mode {
+        None,
+        LengthPrefix,
+        Delimiter,
+        FixedSize
+    };
+
+    Mode mode = Mode::None;
+    std::size_t prefix_bytes = 4;              // LengthPrefix: 1, 2, 4 or 8
+    bool big_endian = true;                    // LengthPrefix: byte order of the length
+    std::string delimiter = "\n";              // Delimiter
+    std::size_t fixed_size = 0;                // FixedSize
+    std::size_t max_message_size = 16 * 1024 * 1024; // larger messages are a protocol error
+
+    static framing none();
+    static framing length_prefix(std::size_t prefix_bytes = 4, bool big_endian = true);
+    static framing delimited(std::string delimiter = "\n");
+    static framing fixed(std::size_t size);
+
+    // Append one framed message (header/delimiter included) to `out`, for the sending side
+    void encode(std::string& out, std::string_view payload) const;
+};
+
+// Per-connection receive buffer that reassembles messages from TCP fragments.
+// The buffer grows to the largest message seen and is reused for the lifetime of the connection.
+//
+//   char* p = decoder.prepare();                  // writable space, at least min_free bytes
+//   int n = recv(fd, p, decoder.writable(), 0);
+//   decoder.commit(n);
+//   std::string_view msg;
+//   while (decoder.next(msg) == frame_decoder::Result::Message) { ... }
+//
+// A view returned by next() stays valid until the following prepare() or reset().
+class J2LIB_API frame_decoder {
+public:
+    enum class Result {
+        Message,   // `msg` holds one complete message
+        NeedMore,  // wait for more data
+        Error      // message exceeds max_message_size or the framing is invalid; drop the connection
+    };
+
+    explicit frame_decoder(const framing& f = framing(), std::size_t min_free = 16 * 1024);
+
+    const framing& getFraming() const { return frame; }
+
+    char* prepare();
+    std::size_t writable() const { return buffer.size() - tail; }
+    void commit(std::size_t n) { tail += n; }
+
+    Result next(std::string_view& msg);
+
+    std::size_t buffered() const { return tail - head; }
+    std::size_t capacity() const { return buffer.size(); }
+    void reset();
+
+protected:
+    framing frame;
+    std::size_t min_free;
+    std::vector<char> buffer;
+    std::size_t head = 0;   // first unconsumed byte
+    std::size_t tail = 0;   // end of received data
+    std::size_t scan = 0;   // Delimiter: bytes after head already searched
+};
+
+} // namespace j2::network::tcp
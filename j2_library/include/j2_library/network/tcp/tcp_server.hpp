@@ -2,6 +2,9 @@
 
 #include "j2_library/export.hpp"
 #include "j2_library/network/ethernet.hpp"
+#include "j2_library/network/tcp/tcp_framing.hpp"
+#include "j2_library/network/tcp/connection_stats.hpp"
+#include "j2_library/network/socket_options.hpp"
 
 #ifdef _WIN32
     #include <winsock2.h>
@@ -9,13 +12,26 @@
 #else
     #include <netdb.h>
     #include <unistd.h>
+    #include <csignal>
 #endif 
 
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <string_view>
+#include <unordered_map>
+#include <deque>
+#include <cstdint>
+
 namespace j2::network::tcp {
 
 class J2LIB_API tcp_server {
 public:
     using Callback = std::function<void(int, const std::string&)>;
+    // Complete message (see setFraming). The view is only valid during the call.
+    using MessageCallback = std::function<void(int, std::string_view)>;
+    // Immutable payload that can be queued to many clients without copying
+    using SharedBuffer = std::shared_ptr<const std::string>;
 
 protected:
     int server_socket;
@@ -25,16 +41,134 @@ protected:
     std::mutex send_mutex;
     std::vector<int> client_sockets;
 
+    // Thread backend: client handler threads are detached; quit() waits until they are done
+    std::mutex handler_mutex;
+    std::condition_variable handlers_done;
+    std::size_t active_handlers = 0;
+
     Callback on_connect;
     Callback on_receive;
     Callback on_close;
+    MessageCallback on_message;
+    framing frame;
+    socket_options options;
 
     static constexpr int BUFFER_SIZE = 1024;
 
+public:
+    // I/O model used for client connections.
+    //  Thread : one blocking thread per client (default, all platforms)
+    //  Epoll  : non-blocking sockets served by a few edge-triggered epoll loops (Linux only;
+    //           other platforms fall back to Thread)
+    enum class Backend {
+        Thread,
+        Epoll
+    };
+
+    // What a send does when the client's outbound queue would exceed the high watermark (Epoll only)
+    //  Reject     : the message is not queued and the send returns -1 (caller backs off)
+    //  Disconnect : the slow client is disconnected
+    enum class Overflow {
+        Reject,
+        Disconnect
+    };
+
+protected:
+    // One epoll event loop (one thread). Without accept sharding the first loop owns the listening
+    // socket and hands accepted clients to the loops round-robin; with sharding every loop has its
+    // own SO_REUSEPORT listener and keeps the clients it accepts.
+    struct event_loop {
+        int epoll_fd = -1;
+        int listen_fd = -1;                // listening socket served by this loop (-1: none)
+        int wake_fd = -1;                  // eventfd used to wake the loop (stop / new clients)
+        std::thread thread;
+        std::mutex pending_mutex;
+        std::vector<int> pending;          // accepted clients waiting to be registered
+        frame_decoder shared{ framing::none(), 64 * 1024 }; // receive buffer for all clients when not framed
+        std::unordered_map<int, frame_decoder> decoders; // per-client buffers when framed
+        std::unordered_map<int, std::shared_ptr<traffic_counters>> traffic; // clients of this loop
+    };
+
+#ifdef __linux__
+    // sendfile(2) has no MSG_NOSIGNAL: blocks SIGPIPE in the calling thread while alive and swallows
+    // one raised meanwhile, leaving the process-wide disposition untouched. One guard covers a whole
+    // file send or flush (tcp_server_sendfile.cpp).
+    class sigpipe_guard {
+    public:
+        sigpipe_guard();
+        ~sigpipe_guard();
+        sigpipe_guard(const sigpipe_guard&) = delete;
+        sigpipe_guard& operator=(const sigpipe_guard&) = delete;
+
+    private:
+        sigset_t pipe_set;
+        sigset_t old_set;
+        bool was_pending = false;
+        bool blocked = false;
+    };
+#endif
+
+    // File (or part of one) queued by sendFileToClient; the descriptor is closed with the last chunk
+    struct file_source {
+        int fd = -1;
+        explicit file_source(int file_fd) : fd(file_fd) {}
+        ~file_source();
+        file_source(const file_source&) = delete;
+        file_source& operator=(const file_source&) = delete;
+    };
+
+    // Outbound state of one epoll client. Sends write directly while the queue is empty;
+    // the rest is queued and flushed by the owning loop with one gathered write (writev-style
+    // sendmsg) when the socket becomes writable.
+    struct connection {
+        struct chunk {
+            SharedBuffer data;
+            std::size_t offset = 0;        // bytes of data already sent
+            std::shared_ptr<file_source> file;   // set: the chunk is sent from this file with sendfile
+            std::uint64_t file_offset = 0;
+            std::uint64_t file_remaining = 0;
+        };
+
+        int fd = -1;
+        int epoll_fd = -1;
+        std::mutex mutex;
+        std::deque<chunk> queue;
+        std::size_t queued_bytes = 0;      // buffered bytes (counted against the high watermark)
+        std::uint64_t queued_file_bytes = 0;
+        bool want_write = false;           // EPOLLOUT armed
+        bool closed = false;
+        std::shared_ptr<traffic_counters> traffic;
+    };
+
+    std::unordered_map<int, std::shared_ptr<connection>> connections; // guarded by send_mutex
+    std::unordered_map<int, std::shared_ptr<traffic_counters>> traffic; // every client, guarded by send_mutex
+    stats_dumper stats_dump;
+    std::size_t send_high_watermark = 4 * 1024 * 1024;
+    Overflow send_overflow = Overflow::Reject;
+
+    Backend backend = Backend::Thread;
+    unsigned loop_thread_count = 1;
+    std::vector<std::unique_ptr<event_loop>> loops;
+    std::size_t next_loop = 0;
+    bool accept_sharding = false;
+    bool pin_loops = false;
+
 public:
     tcp_server();
+    explicit tcp_server(const socket_options& options);
     ~tcp_server();
 
+    // Applied to the listening socket(s) and to every accepted client (set before start())
+    void setSocketOptions(const socket_options& options);
+
+    // Select the backend before start(). loop_threads is the number of epoll loops (Epoll only).
+    void setBackend(Backend backend, unsigned loop_threads = 1);
+    Backend getBackend() const;
+
+    // Epoll only, set before start(). With sharding, start() opens one SO_REUSEPORT listener per
+    // epoll loop so that the kernel spreads new connections over the loops (Linux; falls back to
+    // one listener if the extra listeners cannot be opened). pin_to_cores pins loop i to core i.
+    void setAcceptSharding(bool enable, bool pin_to_cores = true);
     enum class StartResult {
         Success,                // Server started successfully
         SocketCreationFailed,   // Socket creation failed. Could be a system resource issue.
@@ -48,16 +182,70 @@ public:
     void setOnReceiveCallback(Callback cb);
     void setOnCloseCallback(Callback cb);
 
+    // Split the byte stream into messages before delivery (default: framing::none()).
+    // Set before start(). Messages go to the message callback when set, otherwise to the
+    // receive callback as std::string. Oversized messages close the connection.
+    void setFraming(const framing& f);
+    void setOnMessageCallback(MessageCallback cb);
+
+    // Per-client outbound queue limit (Epoll only, set before start())
+    void setSendQueueLimit(std::size_t high_watermark, Overflow overflow = Overflow::Reject);
+    // Buffered bytes plus file bytes not yet sent (Epoll only)
+    std::size_t getQueuedBytes(int client_socket);
+
+    // Epoll backend: never blocks; returns the message size once written or queued.
     int sendToClient(int client_socket, const std::string& message); // If the return value is 0 or greater, it is success; if negative, it is failure
+    int sendToClient(int client_socket, SharedBuffer message);
+    // Epoll backend: the payload is copied once and shared by every client queue.
     std::vector<int> broadcastToClients(const std::string& message);
+
+    // Send `length` bytes of a regular file starting at `offset` (length 0: up to the end of the
+    // file) with sendfile(2), without copying through user space (Linux; other platforms read
+    // and send). Epoll backend: returns at once, the rest is sent by the owning loop as the
+    // socket drains, in order with other sends; file bytes do not count against the watermark.
+    // Thread backend: blocks until sent. The fd overload duplicates the descriptor; the caller
+    // keeps ownership. Returns the number of bytes scheduled or -1.
+    std::int64_t sendFileToClient(int client_socket, const std::string& path,
+        std::uint64_t offset = 0, std::uint64_t length = 0);
+    std::int64_t sendFileToClient(int client_socket, int file_fd,
+        std::uint64_t offset = 0, std::uint64_t length = 0);
     void closeClient(int client_socket);
     void quit();
 
+    // Application byte/message counters of a client plus a TCP_INFO sample (RTT, retransmits,
+    // kernel send/receive queue depth) taken now. Returns false for an unknown or just-closed client.
+    bool getConnectionStats(int client_socket, connection_stats& out);
+    std::vector<connection_stats> getAllConnectionStats();
+    // Dump getAllConnectionStats() every `interval` from a background thread until
+    // stopStatsDump() or quit() (default sink: one line per client on std::cout)
+    bool startStatsDump(std::chrono::milliseconds interval, stats_dumper::Sink sink = nullptr);
+    void stopStatsDump();
+
     std::vector<int> getClientSockets();
+    std::size_t getClientCount();
 
 protected:
     void acceptLoop();
     void clientHandler(int client_socket);
+    bool deliverMessages(int client_socket, frame_decoder& decoder, traffic_counters& counters);
+    std::shared_ptr<traffic_counters> findTraffic(int client_socket);
+
+    // Epoll backend (tcp_server_epoll.cpp)
+    bool startEpoll();
+    void stopEpoll();
+    void epollLoop(std::size_t index);
+    void acceptClients(event_loop& loop);
+    bool openShardListeners();
+    void adoptPendingClients(event_loop& loop);
+    bool readClient(event_loop& loop, int client_socket);
+    void closeEpollClient(event_loop& loop, int client_socket, const std::string& reason);
+    std::shared_ptr<connection> findConnection(int client_socket);
+    int queueSend(connection& c, std::string_view data, const SharedBuffer& owner);
+    bool flushConnection(connection& c);
+    std::int64_t queueFile(int client_socket, std::shared_ptr<file_source> file,
+        std::uint64_t offset, std::uint64_t length);
+    int sendFileChunk(int client_socket, connection::chunk& chunk); // with a sigpipe_guard alive
+    void updateInterest(connection& c);
 };
 
 } // namespace j2::network::tcp
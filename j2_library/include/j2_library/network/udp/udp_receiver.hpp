@@ -2,12 +2,50 @@
 
 #include "j2_library/export.hpp"
 #include "j2_library/network/ethernet.hpp"
+#include "j2_library/network/socket_options.hpp"
+#include "j2_library/network/latency_histogram.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
 
 namespace j2::network::udp {
 
+    // One received datagram in batch mode. `data` points into the receiver's buffer pool and is
+    // only valid during the batch callback.
+    struct datagram {
+        const std::byte* data = nullptr;
+        std::size_t size = 0;
+        bool truncated = false;            // larger than the pool buffer; the rest was dropped
+        sockaddr_storage from{};
+        socklen_t from_len = 0;
+        std::chrono::system_clock::time_point kernel_time{}; // with setEnableKernelTimestamps; epoch otherwise
+    };
+
+    // Contiguous view of the datagrams received by one recvmmsg call
+    struct datagram_batch {
+        const datagram* first = nullptr;
+        std::size_t count = 0;
+
+        const datagram* begin() const { return first; }
+        const datagram* end() const { return first + count; }
+        std::size_t size() const { return count; }
+        const datagram& operator[](std::size_t i) const { return first[i]; }
+    };
+
     class J2LIB_API udp_receiver {
+        friend class udp_receiver_group;
+
     public:
         using Callback = std::function<void(const std::string&, const std::string&, uint16_t)>;
+        using BatchCallback = std::function<void(const datagram_batch&)>;
+        // Receive callback with the time the kernel received the datagram (setEnableKernelTimestamps)
+        using TimestampedCallback = std::function<void(const std::string&, const std::string&, uint16_t,
+                                                       std::chrono::system_clock::time_point)>;
+
+        // Pool buffer sizes for setBatchMode
+        static constexpr std::size_t MTU_BUFFER_SIZE = 2048;
+        static constexpr std::size_t MAX_DATAGRAM_SIZE = 65536;
 
         enum class IpVersion { IPv4, IPv6 };
 
@@ -17,8 +55,17 @@ namespace j2::network::udp {
         std::thread receiver_thread;
 
         Callback on_receive;
+        BatchCallback on_batch;
+        TimestampedCallback on_receive_timestamped;
 
-        static constexpr int BUFFER_SIZE = 1024;
+        bool kernel_timestamps = false;
+        latency_histogram kernel_delay; // kernel receive -> callback
+
+        static constexpr int BUFFER_SIZE = 65536; // largest UDP payload, so that nothing is truncated
+
+        // Batch mode: buffers allocated once at start and reused for every recvmmsg call
+        std::size_t batch_size = 64;
+        std::size_t batch_buffer_size = MTU_BUFFER_SIZE;
 
         enum class UdpType { None, Unicast, Multicast, Broadcast };
         UdpType udpType;
@@ -29,13 +76,30 @@ namespace j2::network::udp {
         std::string any_address;
 
         bool enable_reuse_port;
+        bool enable_reuse_port_sharing = false;
+        int cpu_affinity = -1;
         IpVersion ip_version; // IPv4 or IPv6
+        socket_options options;
 
     public:
         udp_receiver(IpVersion version = IpVersion::IPv4);
+        udp_receiver(IpVersion version, const socket_options& options);
         ~udp_receiver();
 
+        // Applied when the socket is created, before bind (set before start*())
+        void setSocketOptions(const socket_options& options);
+
         void setEnableReusePort(bool enable);
+
+        // SO_REUSEPORT: sockets bound to the same address and port share the incoming datagrams
+        // (by flow hash, or by an attached steering program). Used by udp_receiver_group.
+        void setEnableReusePortSharing(bool enable);
+
+        // Pins the receive thread to a core when it starts (Linux; -1 = no pinning)
+        void setCpuAffinity(int core);
+
+        // Port actually bound (useful after binding port 0); 0 when not running
+        unsigned short getLocalPort() const;
         void setAnyAddress(const std::string anyAddr);
 
         // New: Set IP version (IPv4 or IPv6)
@@ -46,6 +110,24 @@ namespace j2::network::udp {
         bool startBroadcast(const unsigned short port);
 
         void setOnReceiveCallback(Callback cb);
+
+        // Batch mode: when a batch callback is set (before start*()), datagrams are received up to
+        // `batch_size` at a time with recvmmsg (Linux; one recvfrom per batch elsewhere) into a
+        // preallocated pool of `buffer_size` byte buffers and delivered without per-packet
+        // allocations or address formatting. The batch callback replaces the receive callback.
+        void setBatchMode(std::size_t batch_size = 64, std::size_t buffer_size = MTU_BUFFER_SIZE);
+        void setOnBatchCallback(BatchCallback cb);
+
+        // Kernel receive timestamps (SO_TIMESTAMPNS, Linux; set before start*()). Each datagram
+        // carries the time the kernel queued it, the timestamped callback receives it, and the
+        // time it waited before its callback ran is recorded in getKernelDelayHistogram().
+        // Timestamps are CLOCK_REALTIME, so they can be compared with sender-side wall clock time
+        // on the same host for one-way latency.
+        void setEnableKernelTimestamps(bool enable);
+        void setOnReceiveTimestampedCallback(TimestampedCallback cb);
+        const latency_histogram& getKernelDelayHistogram() const { return kernel_delay; }
+        void resetKernelDelayHistogram() { kernel_delay.reset(); }
+
         void quit();
 
     protected:
@@ -55,6 +137,8 @@ namespace j2::network::udp {
                    const bool enable_broadcast = false);
 
         void receiveLoop();
+        void receiveTimestampLoop();
+        void receiveBatchLoop();
     };
 
 }  // namespace j2::network::udp
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "j2_library/export.hpp"
+#include "j2_library/network/udp/udp_receiver.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace j2::network::udp {
+
+    // N udp_receivers bound to the same unicast address and port with SO_REUSEPORT, so that the
+    // kernel spreads incoming datagrams over N sockets and N receive threads instead of one.
+    // Callbacks get the index of the receiver (0..size()-1) that took the datagram; each index is
+    // only ever called from its own thread, so per-index state needs no locking.
+    class J2LIB_API udp_receiver_group {
+    public:
+        using Callback = std::function<void(std::size_t, const std::string&, const std::string&, uint16_t)>;
+        using BatchCallback = std::function<void(std::size_t, const datagram_batch&)>;
+
+        // How the kernel picks the socket for a datagram
+        enum class Steering {
+            KernelHash,    // default SO_REUSEPORT hash of the 4-tuple
+            ReceivingCpu,  // socket (cpu % size): keeps a flow on the core that took the interrupt
+            FlowHash       // socket (skb rxhash % size), classic BPF program
+        };
+
+        // count 0: one receiver per hardware thread
+        explicit udp_receiver_group(std::size_t count = 0,
+                                    udp_receiver::IpVersion version = udp_receiver::IpVersion::IPv4);
+        ~udp_receiver_group();
+
+        udp_receiver_group(const udp_receiver_group&) = delete;
+        udp_receiver_group& operator=(const udp_receiver_group&) = delete;
+
+        // Set before start()
+        void setSocketOptions(const socket_options& options);
+        void setPinToCores(bool enable);    // receiver i runs on core i % hardware threads
+        void setSteering(Steering steering);
+        void setBatchMode(std::size_t batch_size = 64, std::size_t buffer_size = udp_receiver::MTU_BUFFER_SIZE);
+        void setOnReceiveCallback(Callback cb);
+        void setOnBatchCallback(BatchCallback cb);
+
+        // Binds every receiver to ip:port (port 0 picks one port for the whole group).
+        // Fails, with nothing left running, if any receiver cannot be started. A steering program
+        // that cannot be attached only falls back to the kernel hash.
+        bool start(const std::string& ip, unsigned short port);
+        void quit();
+
+        std::size_t size() const { return receivers.size(); }
+        unsigned short getLocalPort() const;
+
+    protected:
+        std::vector<std::unique_ptr<udp_receiver>> receivers;
+        udp_receiver::IpVersion ip_version;
+        socket_options options;
+        bool pin_to_cores = false;
+        Steering steering = Steering::KernelHash;
+        std::size_t batch_size = 64;
+        std::size_t batch_buffer_size = udp_receiver::MTU_BUFFER_SIZE;
+        Callback on_receive;
+        BatchCallback on_batch;
+
+        bool attachSteering();
+    };
+
+}  // namespace j2::network::udp
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "j2_library/export.hpp"
+#include "j2_library/network/udp/udp_receiver.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace j2::network::udp {
+
+    // Recording file format (native byte order), laid out so that a mapped file can be walked
+    // in place:
+    //   file header    16 bytes: "J2UDPREC", u32 version (1), u32 record header size (32)
+    //   per datagram   32 bytes: u64 receive time (ns since the Unix epoch), u32 payload size,
+    //                            u16 address family, u16 source port, u8 source address[16]
+    //                  payload, zero-padded to a multiple of 8 bytes
+    struct recorded_datagram {
+        std::uint64_t time_ns = 0;
+        const std::byte* data = nullptr;   // points into the mapped file
+        std::size_t size = 0;
+        sockaddr_storage from{};
+    };
+
+    // Appends received datagrams to a recording file. The receive time is the kernel timestamp
+    // when the receiver has setEnableKernelTimestamps, the time of record() otherwise.
+    // Thread-safe, so one recorder can serve a udp_receiver_group.
+    //
+    //   udp_recorder recorder;
+    //   recorder.open("burst.j2rec");
+    //   recorder.attach(receiver);           // before receiver.start*()
+    class J2LIB_API udp_recorder {
+    public:
+        udp_recorder() = default;
+        ~udp_recorder();
+
+        udp_recorder(const udp_recorder&) = delete;
+        udp_recorder& operator=(const udp_recorder&) = delete;
+
+        bool open(const std::string& path);   // truncates an existing file
+        void flush();
+        void close();
+        bool is_open() const;
+
+        void record(const void* data, std::size_t size, const sockaddr_storage& from,
+                    std::chrono::system_clock::time_point time);
+        void record(const datagram_batch& batch);
+
+        // Records everything the receiver gets through a batch callback, then calls `next`
+        void attach(udp_receiver& receiver, udp_receiver::BatchCallback next = nullptr);
+
+        std::uint64_t count() const;
+        std::uint64_t bytes() const;
+
+    private:
+        void write_locked(const void* data, std::size_t size, const sockaddr_storage& from, std::uint64_t time_ns);
+
+        mutable std::mutex mutex;
+        std::FILE* file = nullptr;
+        std::vector<char> file_buffer;
+        std::uint64_t datagrams = 0;
+        std::uint64_t payload_bytes = 0;
+    };
+
+    // Read-only view of a recording file: mapped on POSIX, read into memory on Windows
+    class J2LIB_API udp_recording {
+    public:
+        udp_recording() = default;
+        ~udp_recording();
+
+        udp_recording(const udp_recording&) = delete;
+        udp_recording& operator=(const udp_recording&) = delete;
+
+        // False for a missing file or a bad header; a truncated last record is ignored
+        bool open(const std::string& path);
+        void close();
+
+        std::size_t size() const { return records.size(); }
+        bool empty() const { return records.empty(); }
+        const recorded_datagram& operator[](std::size_t i) const { return records[i]; }
+        std::vector<recorded_datagram>::const_iterator begin() const { return records.begin(); }
+        std::vector<recorded_datagram>::const_iterator end() const { return records.end(); }
+
+        // Time between the first and the last datagram
+        std::chrono::nanoseconds duration() const;
+
+    private:
+        const std::byte* base = nullptr;
+        std::size_t length = 0;
+        bool mapped = false;
+        std::vector<std::byte> contents;     // when not mapped
+        std::vector<recorded_datagram> records;
+    };
+
+}  // namespace j2::network::udp
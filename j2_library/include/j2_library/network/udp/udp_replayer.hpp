@@ -0,0 +1,55 @@
+#pragma once
+
+#include "j2_library/export.hpp"
+#include "j2_library/network/udp/udp_recorder.hpp"
+#include "j2_library/network/udp/udp_sender.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace j2::network::udp {
+
+    enum class replay_mode {
+        OriginalTiming,  // gaps between datagrams as recorded
+        Scaled,          // recorded gaps divided by `speed` (2.0 = twice as fast)
+        MaxRate          // no pacing, full batches back to back
+    };
+
+    struct replay_options {
+        replay_mode mode = replay_mode::OriginalTiming;
+        double speed = 1.0;            // Scaled only
+        std::size_t batch_size = 64;   // upper bound of datagrams per send_batch
+        std::size_t loops = 1;         // play the recording this many times
+    };
+
+    struct replay_stats {
+        std::uint64_t datagrams = 0;
+        std::uint64_t bytes = 0;
+        std::uint64_t failed = 0;      // datagrams send_batch could not send
+        double seconds = 0.0;
+
+        double datagrams_per_second() const { return seconds > 0 ? static_cast<double>(datagrams) / seconds : 0.0; }
+    };
+
+    // Replays a recording to the sender's server with send_batch. Datagrams that are due at the
+    // same time go out in one batch; the replayer sleeps until the next one is due.
+    //
+    //   udp_sender sender; sender.setServer("127.0.0.1", 5000); sender.create();
+    //   udp_recording rec; rec.open("burst.j2rec");
+    //   auto stats = udp_replayer(sender).replay(rec, { replay_mode::MaxRate });
+    class J2LIB_API udp_replayer {
+    public:
+        explicit udp_replayer(udp_sender& sender);
+
+        replay_stats replay(const udp_recording& recording, const replay_options& options = {});
+
+        // Ends a running replay() early (from another thread)
+        void stop();
+
+    private:
+        udp_sender& sender;
+        std::atomic<bool> stop_requested{ false };
+    };
+
+}  // namespace j2::network::udp
@@ -2,13 +2,48 @@
 
 #include "j2_library/export.hpp"
 #include "j2_library/network/ethernet.hpp"
+#include "j2_library/network/socket_options.hpp"
+#include <cstddef>
 #include <string>
+#include <vector>
+#include <list>
+#include <unordered_map>
 #include <atomic>
 #include <mutex>
 
 namespace j2::network::udp {
 
+// One outgoing datagram for send_batch. `data` only has to stay valid for the duration of the call.
+struct send_buffer {
+    const void* data = nullptr;
+    std::size_t size = 0;
+};
+
+// Destination address resolved once and reused for many sends, so that the per-packet path does
+// no address parsing or name lookup. Accepts numeric IPv4/IPv6 addresses and host names; a host
+// name is looked up (blocking) by the constructor, so build endpoints off the sending path and
+// rebuild them to follow a host that moves.
+class J2LIB_API udp_endpoint {
+public:
+    udp_endpoint() = default;
+    udp_endpoint(const std::string& ip, unsigned short port);
+
+    bool valid() const { return addr_len != 0; }
+    int family() const { return addr.ss_family; }
+
+    const sockaddr* data() const { return reinterpret_cast<const sockaddr*>(&addr); }
+    socklen_t size() const { return addr_len; }
+
+private:
+    friend class udp_sender;
+
+    sockaddr_storage addr{};
+    socklen_t addr_len = 0;
+};
+
 class J2LIB_API udp_sender {
+    friend class udp_endpoint;
+
 protected:
     std::string server_ip;
     unsigned short server_port;
@@ -22,19 +57,75 @@ protected:
     socklen_t server_addr_len = 0;
     std::atomic<bool> stop_flag;
     std::mutex send_mutex;
+    bool synchronized = true;      // false: sends do not take send_mutex (udp_thread_sender)
+    bool enable_gso = false;
+    std::size_t gso_rejected_segment = 0; // smallest segment size the route refused (0: none)
+    socket_options options;
+
+    // Bounded LRU of destinations parsed by send_data_to(data, ip, port), most recent first.
+    // Invalid addresses are kept too (as invalid endpoints) so they are not parsed and reported
+    // on every packet. Indexed by a hash of (ip, port); a colliding entry is simply parsed again.
+    struct cached_endpoint {
+        std::string ip;
+        unsigned short port = 0;
+        udp_endpoint endpoint;
+    };
+    std::size_t endpoint_cache_capacity = 256;
+    std::list<cached_endpoint> endpoint_lru;
+    std::unordered_map<std::size_t, std::list<cached_endpoint>::iterator> endpoint_index;
+
+    const udp_endpoint* resolve_cached(const std::string& ip, unsigned short port);
 
     static bool fill_sockaddr(const std::string& ip, unsigned short port, sockaddr_storage& addr, socklen_t& addr_len, int& family);
 
+    int send_mmsg(const send_buffer* buffers, std::size_t count);
+    int send_gso(const send_buffer* buffers, std::size_t count);
+
 public:
     udp_sender();
+    explicit udp_sender(const socket_options& options);
     ~udp_sender();
 
+    // Applied when the socket is created (set before create())
+    void set_socket_options(const socket_options& options);
+
     void setServer(const std::string& ip, unsigned short port);
     bool create();
     ssize_t send_data(const std::string& data);
+    ssize_t send_data(const void* data, std::size_t size);
+    // ip must be a numeric IPv4/IPv6 address; send to a host name through udp_endpoint
     ssize_t send_data_to(const std::string& data, const std::string& ip, unsigned short port);
+    ssize_t send_data_to(const std::string& data, const udp_endpoint& to);
+
+    // Fan-out: sends the same payload to every endpoint (sendmmsg on Linux). Returns the number
+    // of datagrams sent, or -1 if the first one failed.
+    int send_data_to_all(const send_buffer& data, const std::vector<udp_endpoint>& to);
+
+    // Size of the destination cache used by send_data_to(data, ip, port); 0 disables it
+    void set_endpoint_cache_capacity(std::size_t capacity);
+
+    // Sends every buffer as its own datagram to the server with as few syscalls as possible
+    // (sendmmsg on Linux, one sendto per datagram elsewhere). Returns the number of datagrams
+    // sent, or -1 if the socket is not created or the first one failed.
+    int send_batch(const send_buffer* buffers, std::size_t count);
+    int send_batch(const std::vector<send_buffer>& buffers);
+    int send_batch(const std::vector<std::string>& messages);
+
+    // UDP GSO (Linux UDP_SEGMENT): a batch whose datagrams all have the same size (the last one
+    // may be shorter) is handed to the kernel as one large send and split into datagrams there.
+    // Falls back to sendmmsg for other batches and when the kernel or route rejects it.
+    void set_enable_gso(bool enable);
+
     void set_multicast_ttl(int ttl);
     void stop();
 };
 
+// udp_sender for use by a single thread: sends do not take the send mutex. Give each sending
+// thread its own instance (and socket) instead of sharing one udp_sender.
+class J2LIB_API udp_thread_sender : public udp_sender {
+public:
+    udp_thread_sender();
+    explicit udp_thread_sender(const socket_options& options);
+};
+
 } // namespace j2::network::udp
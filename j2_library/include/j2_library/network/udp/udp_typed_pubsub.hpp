@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "j2_library/json/json_binary.hpp"
+#include "j2_library/network/udp/udp_receiver.hpp"
+#include "j2_library/network/udp/udp_sender.hpp"
+
+namespace j2::network::udp {
+
+// Publishes values of T (anything with nlohmann to_json) as binary JSON datagrams instead of
+// dump() text: smaller payloads and no number formatting. The output buffer is reused across
+// sends; the intermediate nlohmann::json of each value is still built (and allocated) per send.
+//
+//   udp_sender sender;  sender.setServer("127.0.0.1", 54000);  sender.create();
+//   udp_typed_publisher<Person> pub(sender);
+//   pub.publish(person);
+template <class T>
+class udp_typed_publisher {
+public:
+    explicit udp_typed_publisher(udp_sender& target,
+        j2::json::binary_format encoding = j2::json::binary_format::msgpack)
+        : sender(target), format(encoding) {}
+
+    // Returns the bytes sent, or -1 if T could not be encoded
+    ssize_t publish(const T& value) {
+        std::lock_guard<std::mutex> lock(buffer_mutex);
+        if (!j2::json::encode_value(value, format, buffer)) {
+            return -1;
+        }
+        return sender.send_data(buffer.data(), buffer.size());
+    }
+
+    // Size of the last encoded message (useful to stay below the 65,507-byte UDP limit)
+    std::size_t last_size() const {
+        std::lock_guard<std::mutex> lock(buffer_mutex);
+        return buffer.size();
+    }
+
+private:
+    udp_sender& sender;
+    j2::json::binary_format format;
+    mutable std::mutex buffer_mutex;
+    std::vector<std::uint8_t> buffer;
+};
+
+// Decodes the datagrams of a udp_typed_publisher<T> on the receiver thread and hands over T.
+// Datagrams that are not valid binary JSON for T go to the error callback (if any).
+template <class T>
+class udp_typed_subscriber {
+public:
+    using Callback = std::function<void(const T&, const std::string&, uint16_t)>;
+    using ErrorCallback = std::function<void(const std::string&, const std::string&, uint16_t)>;
+
+    explicit udp_typed_subscriber(udp_receiver& source,
+        j2::json::binary_format encoding = j2::json::binary_format::msgpack)
+        : receiver(source), format(encoding) {}
+
+    // Installs the receiver callback; call before receiver.start*()
+    void setOnReceiveCallback(Callback cb) {
+        on_receive = std::move(cb);
+        receiver.setOnReceiveCallback([this](const std::string& data, const std::string& ip, uint16_t port) {
+            // The receiver delivers from one thread, so the decoded value can be reused
+            if (j2::json::decode_value(data.data(), data.size(), format, value)) {
+                on_receive(value, ip, port);
+            }
+            else if (on_error) {
+                on_error(data, ip, port);
+            }
+            });
+    }
+
+    void setOnErrorCallback(ErrorCallback cb) { on_error = std::move(cb); }
+
+private:
+    udp_receiver& receiver;
+    j2::json::binary_format format;
+    Callback on_receive;
+    ErrorCallback on_error;
+    T value{};
+};
+
+} // namespace j2::network::udp
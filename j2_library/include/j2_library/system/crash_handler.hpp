@@ -29,6 +29,13 @@ namespace j2 {
              */
             static std::vector<std::string> get_stack_trace();
 
+            /**
+             * @brief 크래시 발생 시 플라이트 레코더(j2::log::flight_recorder) 링 버퍼를 덤프할 파일 경로를 설정합니다.
+             * @param path 덤프 파일 경로 (빈 문자열이면 덤프하지 않음, 최대 1023 바이트)
+             * @note 덤프는 콜 스택 수집보다 먼저, async-signal-safe 함수(open/write/close)만으로 수행됩니다.
+             */
+            static void set_flight_recorder_dump_path(const std::string& path);
+
         private:
             // OS별 네이티브 핸들러
 #ifdef _WIN32
@@ -43,7 +50,11 @@ namespace j2 {
             // C++ terminate 핸들러
             static void cxx_terminate_handler();
 
+            // 플라이트 레코더 덤프 (시그널 핸들러에서 호출 가능)
+            static void dump_flight_recorder() noexcept;
+
             static CrashCallback s_callback; // 등록된 콜백 함수
+            static char s_flight_dump_path[1024]; // 플라이트 레코더 덤프 경로 (시그널 핸들러에서 할당 없이 사용)
             static void handle_crash(const std::string& type, const std::string& reason);
         };
 
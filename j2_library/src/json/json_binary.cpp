@@ -0,0 +1,38 @@
+
+#include "j2_library/json/json_binary.hpp"
+
+namespace j2::json {
+
+    void encode(const nj& j, binary_format format, std::vector<std::uint8_t>& out) {
+        out.clear(); // capacity 는 유지 (버퍼 재사용)
+        if (format == binary_format::cbor) {
+            nj::to_cbor(j, out);
+        }
+        else {
+            nj::to_msgpack(j, out);
+        }
+    }
+
+    std::vector<std::uint8_t> encode(const nj& j, binary_format format) {
+        std::vector<std::uint8_t> out;
+        encode(j, format, out);
+        return out;
+    }
+
+    bool decode(const void* data, std::size_t size, binary_format format, nj& out) noexcept {
+        if (data == nullptr && size != 0) return false;
+        try {
+            const auto* first = static_cast<const std::uint8_t*>(data);
+            const auto* last = first + size;
+            // strict=true: 뒤에 남는 바이트가 있으면 실패, allow_exceptions=false: 실패 시 discarded
+            out = (format == binary_format::cbor)
+                ? nj::from_cbor(first, last, true, false)
+                : nj::from_msgpack(first, last, true, false);
+            return !out.is_discarded();
+        }
+        catch (...) {
+            return false;
+        }
+    }
+
+} // namespace j2::json
@@ -0,0 +1,266 @@
+#include "j2_library/log/flight_recorder.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+#include <spdlog/details/os.h>
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace j2::log {
+
+    namespace {
+
+        // 슬롯 1개. seq 는 seqlock 방식으로 사용한다.
+        //  0        : 비어 있음
+        //  2*n + 1  : n 번째 기록 작성 중
+        //  2*n + 2  : n 번째 기록 완료
+        struct slot {
+            std::atomic<std::uint64_t> seq{ 0 };
+            std::int64_t epoch_ns = 0;
+            std::uint16_t len = 0;
+            std::uint8_t level = 0;
+            char text[flight_recorder::SLOT_TEXT_SIZE];
+        };
+
+        // 스레드 1개 전용 링 버퍼. 스레드가 종료되면 in_use 를 내려 다른 스레드가 재사용한다.
+        // 시그널 핸들러가 언제든 순회할 수 있도록 링은 해제하지 않는다.
+        struct ring {
+            std::atomic<ring*> next{ nullptr };
+            std::atomic<bool> in_use{ false };
+            std::atomic<std::uint64_t> head{ 0 }; // 지금까지 기록한 개수
+            std::atomic<std::uint64_t> tid{ 0 };
+            std::size_t capacity = 0;
+            slot* slots = nullptr;
+        };
+
+        std::atomic<ring*> g_rings{ nullptr };
+        std::atomic<std::size_t> g_slots_per_thread{ 256 };
+
+        struct ring_holder {
+            ring* r = nullptr;
+            ~ring_holder() {
+                if (r) r->in_use.store(false, std::memory_order_release);
+            }
+        };
+
+        thread_local ring_holder t_holder;
+
+        ring* claim_ring() {
+            const std::size_t capacity = g_slots_per_thread.load(std::memory_order_relaxed);
+
+            // 종료된 스레드가 남긴 링 재사용
+            for (ring* r = g_rings.load(std::memory_order_acquire); r; r = r->next.load(std::memory_order_acquire)) {
+                if (r->capacity != capacity) continue;
+                bool expected = false;
+                if (r->in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                    for (std::size_t i = 0; i < r->capacity; ++i) {
+                        r->slots[i].seq.store(0, std::memory_order_relaxed);
+                    }
+                    r->head.store(0, std::memory_order_relaxed);
+                    r->tid.store(static_cast<std::uint64_t>(spdlog::details::os::thread_id()), std::memory_order_release);
+                    return r;
+                }
+            }
+
+            ring* r = new ring();
+            r->capacity = capacity;
+            r->slots = new slot[capacity];
+            r->in_use.store(true, std::memory_order_relaxed);
+            r->tid.store(static_cast<std::uint64_t>(spdlog::details::os::thread_id()), std::memory_order_relaxed);
+
+            ring* old_head = g_rings.load(std::memory_order_relaxed);
+            do {
+                r->next.store(old_head, std::memory_order_relaxed);
+            } while (!g_rings.compare_exchange_weak(old_head, r,
+                std::memory_order_release, std::memory_order_relaxed));
+            return r;
+        }
+
+        // ---- async-signal-safe 출력 헬퍼 (할당/locale/stdio 사용 안 함) ----
+
+        struct out_buf {
+            int fd;
+            char data[512];
+            std::size_t used = 0;
+
+            void flush() noexcept {
+                std::size_t off = 0;
+                while (off < used) {
+#ifdef _WIN32
+                    int n = _write(fd, data + off, static_cast<unsigned>(used - off));
+#else
+                    ssize_t n = ::write(fd, data + off, used - off);
+#endif
+                    if (n <= 0) break;
+                    off += static_cast<std::size_t>(n);
+                }
+                used = 0;
+            }
+
+            void put(const char* s, std::size_t n) noexcept {
+                while (n > 0) {
+                    if (used == sizeof(data)) flush();
+                    std::size_t chunk = sizeof(data) - used;
+                    if (chunk > n) chunk = n;
+                    std::memcpy(data + used, s, chunk);
+                    used += chunk;
+                    s += chunk;
+                    n -= chunk;
+                }
+            }
+
+            void put(const char* s) noexcept { put(s, std::strlen(s)); }
+
+            // width > 0 이면 앞을 0 으로 채움
+            void put_u64(std::uint64_t v, int width = 0) noexcept {
+                char tmp[24];
+                int i = 0;
+                do {
+                    tmp[i++] = static_cast<char>('0' + (v % 10));
+                    v /= 10;
+                } while (v > 0 && i < 20);
+                while (i < width && i < 20) tmp[i++] = '0';
+                char rev[24];
+                for (int k = 0; k < i; ++k) rev[k] = tmp[i - 1 - k];
+                put(rev, static_cast<std::size_t>(i));
+            }
+        };
+
+        const char* level_name(std::uint8_t level) noexcept {
+            static const char* const names[] = { "trace", "debug", "info", "warn", "error", "critical", "off" };
+            return level < 7 ? names[level] : "?";
+        }
+
+    } // anonymous namespace
+
+    void flight_recorder::setSlotsPerThread(std::size_t slots) {
+        g_slots_per_thread.store(slots > 0 ? slots : 1, std::memory_order_relaxed);
+    }
+
+    std::size_t flight_recorder::slotsPerThread() {
+        return g_slots_per_thread.load(std::memory_order_relaxed);
+    }
+
+    void flight_recorder::record(spdlog::level::level_enum level,
+        std::int64_t epoch_ns,
+        const char* text,
+        std::size_t len) noexcept
+    {
+        ring* r = t_holder.r;
+        if (!r) {
+            try {
+                r = claim_ring();
+            }
+            catch (...) {
+                return; // 메모리 부족 시 기록 생략
+            }
+            t_holder.r = r;
+        }
+
+        const std::uint64_t h = r->head.load(std::memory_order_relaxed);
+        slot& s = r->slots[h % r->capacity];
+
+        s.seq.store(2 * h + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        if (len > SLOT_TEXT_SIZE) len = SLOT_TEXT_SIZE;
+        s.epoch_ns = epoch_ns;
+        s.level = static_cast<std::uint8_t>(level);
+        s.len = static_cast<std::uint16_t>(len);
+        if (len > 0) std::memcpy(s.text, text, len);
+
+        s.seq.store(2 * h + 2, std::memory_order_release);
+        r->head.store(h + 1, std::memory_order_release);
+    }
+
+    std::size_t flight_recorder::dump(int fd) noexcept {
+        out_buf out{ fd, {}, 0 };
+        std::size_t total = 0;
+
+        out.put("===== j2 flight recorder dump (time: epoch seconds) =====\n");
+
+        for (ring* r = g_rings.load(std::memory_order_acquire); r; r = r->next.load(std::memory_order_acquire)) {
+            const std::uint64_t head = r->head.load(std::memory_order_acquire);
+            if (head == 0) continue;
+            const std::uint64_t first = head > r->capacity ? head - r->capacity : 0;
+
+            out.put("----- thread ");
+            out.put_u64(r->tid.load(std::memory_order_acquire));
+            out.put(r->in_use.load(std::memory_order_acquire) ? " -----\n" : " (exited) -----\n");
+
+            for (std::uint64_t i = first; i < head; ++i) {
+                const slot& s = r->slots[i % r->capacity];
+                const std::uint64_t seq1 = s.seq.load(std::memory_order_acquire);
+                if (seq1 != 2 * i + 2) continue; // 덮어쓰는 중이거나 비어 있음
+
+                char text[SLOT_TEXT_SIZE];
+                const std::int64_t ts = s.epoch_ns;
+                const std::uint8_t level = s.level;
+                std::size_t len = s.len;
+                if (len > SLOT_TEXT_SIZE) len = SLOT_TEXT_SIZE;
+                std::memcpy(text, s.text, len);
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (s.seq.load(std::memory_order_relaxed) != seq1) continue; // 읽는 도중 덮어씀
+
+                const std::uint64_t uts = ts > 0 ? static_cast<std::uint64_t>(ts) : 0;
+                out.put_u64(uts / 1000000000ull);
+                out.put(".");
+                out.put_u64(uts % 1000000000ull, 9);
+                out.put(" [");
+                out.put(level_name(level));
+                out.put("] ");
+                out.put(text, len);
+                out.put("\n");
+                ++total;
+            }
+        }
+
+        out.put("===== end of flight recorder dump =====\n");
+        out.flush();
+        return total;
+    }
+
+    bool flight_recorder::dumpToFile(const char* path) noexcept {
+        if (!path || !*path) return false;
+#ifdef _WIN32
+        int fd = _open(path, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+        if (fd < 0) return false;
+        dump(fd);
+        _close(fd);
+#else
+        int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0) return false;
+        dump(fd);
+        ::close(fd);
+#endif
+        return true;
+    }
+
+    flight_recorder_sink::flight_recorder_sink() {
+        set_level(spdlog::level::trace);
+    }
+
+    void flight_recorder_sink::log(const spdlog::details::log_msg& msg) {
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            msg.time.time_since_epoch()).count();
+        flight_recorder::record(msg.level, static_cast<std::int64_t>(ns),
+            msg.payload.data(), msg.payload.size());
+    }
+
+    void flight_recorder_sink::flush() {}
+
+    void flight_recorder_sink::set_pattern(const std::string&) {}
+
+    void flight_recorder_sink::set_formatter(std::unique_ptr<spdlog::formatter>) {}
+
+} // namespace j2::log
@@ -0,0 +1,303 @@
+#include "j2_library/log/log_archiver.hpp"
+
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+
+#include "j2_library/string/string_basic.hpp"
+
+#if defined(J2_HAVE_ZLIB)
+#include <zlib.h>
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#elif defined(__linux__)
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace j2::log {
+
+    namespace fs = std::filesystem;
+
+    namespace {
+        struct archive_entry {
+            fs::path path;
+            fs::file_time_type mtime;
+            std::uint64_t size = 0;
+        };
+
+        // basePath 로부터 회전된 보관 파일 목록 (최신 파일 우선)
+        std::vector<archive_entry> list_archives(const std::string& basePath) {
+            std::vector<archive_entry> out;
+            fs::path dir = fs::path(basePath).parent_path();
+            if (dir.empty()) dir = ".";
+
+            std::error_code ec;
+            for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+                if (!it->is_regular_file(ec)) continue;
+                const fs::path& p = it->path();
+                fs::path candidate = fs::path(basePath).parent_path() / p.filename();
+                if (!rotating_archive_sink::is_rotated_name_of(basePath, candidate.string())) continue;
+
+                archive_entry e;
+                e.path = p;
+                e.mtime = it->last_write_time(ec);
+                e.size = static_cast<std::uint64_t>(it->file_size(ec));
+                out.push_back(std::move(e));
+            }
+
+            std::sort(out.begin(), out.end(), [](const archive_entry& a, const archive_entry& b) {
+                if (a.mtime != b.mtime) return a.mtime > b.mtime;
+                return a.path.filename().string() > b.path.filename().string();
+                });
+            return out;
+        }
+    } // anonymous namespace
+
+    log_archiver::log_archiver() {}
+
+    log_archiver::~log_archiver() { stop(); }
+
+    void log_archiver::start() {
+        std::lock_guard<std::mutex> lk(mu_);
+        if (running_) return;
+        running_ = true;
+        worker_ = std::thread(&log_archiver::workerLoop, this);
+    }
+
+    void log_archiver::stop() {
+        {
+            std::lock_guard<std::mutex> lk(mu_);
+            if (!running_) return;
+            running_ = false;
+        }
+        cv_.notify_all();
+        if (worker_.joinable()) {
+            worker_.join();
+        }
+        idleCv_.notify_all();
+    }
+
+    void log_archiver::setPolicy(const std::string& basePath, const policy& p) {
+        {
+            std::lock_guard<std::mutex> lk(mu_);
+            policies_[basePath] = p;
+            jobs_.push_back(job{ basePath, std::string() });
+        }
+        cv_.notify_one();
+    }
+
+    void log_archiver::enqueue(const std::string& basePath, const std::string& rotatedPath) {
+        {
+            std::lock_guard<std::mutex> lk(mu_);
+            jobs_.push_back(job{ basePath, rotatedPath });
+        }
+        cv_.notify_one();
+    }
+
+    rotate_hook log_archiver::makeHook(const std::string& basePath) {
+        std::weak_ptr<log_archiver> weak = weak_from_this();
+        return [weak, basePath](const std::string& rotatedPath) {
+            if (auto self = weak.lock()) {
+                self->enqueue(basePath, rotatedPath);
+            }
+            };
+    }
+
+    void log_archiver::waitIdle() {
+        std::unique_lock<std::mutex> lk(mu_);
+        idleCv_.wait(lk, [this] { return !running_ || (jobs_.empty() && !busy_); });
+    }
+
+    std::uint64_t log_archiver::archivedBytes(const std::string& basePath) const {
+        std::uint64_t total = 0;
+        for (const auto& e : list_archives(basePath)) {
+            total += e.size;
+        }
+        return total;
+    }
+
+    bool log_archiver::compressionAvailable() {
+#if defined(J2_HAVE_ZLIB)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool log_archiver::gzipFile(const std::string& src, const std::string& dst) {
+#if defined(J2_HAVE_ZLIB)
+        std::ifstream in(src, std::ios::binary);
+        if (!in) return false;
+
+        gzFile out = gzopen(dst.c_str(), "wb6");
+        if (!out) return false;
+
+        std::vector<char> buf(256 * 1024);
+        bool ok = true;
+        while (in) {
+            in.read(buf.data(), static_cast<std::streamsize>(buf.size()));
+            std::streamsize n = in.gcount();
+            if (n <= 0) break;
+            if (gzwrite(out, buf.data(), static_cast<unsigned>(n)) != static_cast<int>(n)) {
+                ok = false;
+                break;
+            }
+        }
+        if (in.bad()) ok = false;
+        if (gzclose(out) != Z_OK) ok = false;
+
+        if (!ok) {
+            std::error_code ec;
+            fs::remove(dst, ec);
+        }
+        return ok;
+#else
+        (void)src;
+        (void)dst;
+        return false;
+#endif
+    }
+
+    // 압축은 로깅과 CPU 를 다투지 않도록 가장 낮은 우선순위에서 수행
+    void log_archiver::lowerCurrentThreadPriority() {
+#ifdef _WIN32
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_LOWEST);
+#elif defined(__linux__)
+        // Linux 에서 setpriority(PRIO_PROCESS, tid) 는 해당 스레드에만 적용된다.
+        setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 19);
+#endif
+    }
+
+    void log_archiver::workerLoop() {
+        lowerCurrentThreadPriority();
+
+        while (true) {
+            job j;
+            {
+                std::unique_lock<std::mutex> lk(mu_);
+                cv_.wait(lk, [this] { return !running_ || !jobs_.empty(); });
+                if (!running_) break;
+
+                j = std::move(jobs_.front());
+                jobs_.pop_front();
+                busy_ = true;
+            }
+
+            try {
+                process(j);
+            }
+            catch (const std::exception& e) {
+                std::cerr << "[log_archiver] " << e.what() << "\n";
+            }
+            catch (...) {
+            }
+
+            {
+                std::lock_guard<std::mutex> lk(mu_);
+                busy_ = false;
+            }
+            idleCv_.notify_all();
+        }
+    }
+
+    void log_archiver::process(const job& j) {
+        policy p;
+        {
+            std::lock_guard<std::mutex> lk(mu_);
+            auto it = policies_.find(j.basePath);
+            if (it != policies_.end()) p = it->second;
+        }
+
+        if (j.rotatedPath.empty()) {
+            sweep(j.basePath, p);
+        }
+        else {
+            compressOne(j.rotatedPath, p);
+        }
+        enforceRetention(j.basePath, p);
+    }
+
+    void log_archiver::compressOne(const std::string& rotatedPath, const policy& p) {
+        if (!p.compress || !compressionAvailable()) return;
+        if (j2::string::ends_with(rotatedPath, ".gz")) return;
+
+        std::error_code ec;
+        if (!fs::exists(rotatedPath, ec)) return; // 이미 용량 정리로 삭제된 경우
+
+        // 압축 중인 파일이 보관 파일로 집계되지 않도록 임시 이름에 먼저 기록
+        const std::string tmp = rotatedPath + ".gz.tmp";
+        if (!gzipFile(rotatedPath, tmp)) {
+            std::cerr << "[log_archiver] Failed to compress " << rotatedPath << "\n";
+            return;
+        }
+
+        // 압축 파일은 원본의 수정 시각을 유지하여 보관 순서를 보존
+        auto mtime = fs::last_write_time(rotatedPath, ec);
+        fs::rename(tmp, rotatedPath + ".gz", ec);
+        if (ec) {
+            fs::remove(tmp, ec);
+            return;
+        }
+        fs::last_write_time(rotatedPath + ".gz", mtime, ec);
+        fs::remove(rotatedPath, ec);
+    }
+
+    // 이전 실행에서 남은 미압축 보관 파일 처리 (예: 압축 도중 종료)
+    void log_archiver::sweep(const std::string& basePath, const policy& p) {
+        std::error_code ec;
+        fs::path dir = fs::path(basePath).parent_path();
+        if (dir.empty()) dir = ".";
+        for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+            std::string name = it->path().filename().string();
+            if (j2::string::ends_with(name, ".gz.tmp")) {
+                name.resize(name.size() - 7);
+                fs::path original = fs::path(basePath).parent_path() / name;
+                if (rotating_archive_sink::is_rotated_name_of(basePath, original.string())) {
+                    std::error_code rm_ec;
+                    fs::remove(it->path(), rm_ec);
+                }
+            }
+            else if (j2::string::ends_with(name, ".idx")) {
+                // 보관 파일이 사라진 인덱스 정리
+                name.resize(name.size() - 4);
+                fs::path original = fs::path(basePath).parent_path() / name;
+                if (rotating_archive_sink::is_rotated_name_of(basePath, original.string())) {
+                    std::error_code ex_ec;
+                    if (!fs::exists(original, ex_ec) && !fs::exists(original.string() + ".gz", ex_ec)) {
+                        fs::remove(it->path(), ex_ec);
+                    }
+                }
+            }
+        }
+
+        for (const auto& e : list_archives(basePath)) {
+            if (!running_) return;
+            compressOne(e.path.string(), p);
+        }
+    }
+
+    void log_archiver::enforceRetention(const std::string& basePath, const policy& p) {
+        if (p.maxArchiveBytes == 0 && p.maxArchiveFiles == 0) return;
+
+        std::uint64_t total = 0;
+        std::size_t count = 0;
+        for (const auto& e : list_archives(basePath)) {
+            total += e.size;
+            ++count;
+            if ((p.maxArchiveBytes > 0 && total > p.maxArchiveBytes) ||
+                (p.maxArchiveFiles > 0 && count > p.maxArchiveFiles)) {
+                std::error_code ec;
+                fs::remove(e.path, ec);
+                fs::remove(log_index_writer::index_path_of(e.path.string()), ec);
+            }
+        }
+    }
+
+} // namespace j2::log
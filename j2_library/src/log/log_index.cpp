@@ -0,0 +1,128 @@
+#include "j2_library/log/log_index.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+#include "j2_library/string/string_basic.hpp"
+
+namespace j2::log {
+
+    namespace {
+        constexpr char INDEX_MAGIC[8] = { 'J', '2', 'L', 'I', 'D', 'X', '0', '1' };
+    } // anonymous namespace
+
+    log_index_writer::~log_index_writer() { close(); }
+
+    bool log_index_writer::open(const std::string& indexPath,
+        std::size_t interval,
+        std::uint64_t startOffset,
+        bool truncate)
+    {
+        close();
+        interval_ = interval > 0 ? interval : 64 * 1024;
+        hasPending_ = false;
+        pending_ = log_index_entry{};
+        pending_.offset = startOffset;
+
+        // 기존 인덱스가 없거나 형식이 다르면 새로 작성
+        // 비정상 종료로 남은 불완전 레코드는 잘라내어 레코드 경계를 맞춤
+        if (!truncate) {
+            std::vector<log_index_entry> existing;
+            if (!read(indexPath, existing)) {
+                truncate = true;
+            }
+            else {
+                std::error_code ec;
+                std::filesystem::resize_file(indexPath,
+                    16 + existing.size() * sizeof(log_index_entry), ec);
+            }
+        }
+
+        fp_ = std::fopen(indexPath.c_str(), truncate ? "wb" : "ab");
+        if (!fp_) return false;
+
+        if (truncate) {
+            std::uint64_t iv = static_cast<std::uint64_t>(interval_);
+            std::fwrite(INDEX_MAGIC, 1, sizeof(INDEX_MAGIC), fp_);
+            std::fwrite(&iv, sizeof(iv), 1, fp_);
+            std::fflush(fp_);
+        }
+        return true;
+    }
+
+    void log_index_writer::close() {
+        if (!fp_) return;
+        writePending();
+        std::fclose(fp_);
+        fp_ = nullptr;
+    }
+
+    void log_index_writer::add(std::int64_t epochNs,
+        spdlog::level::level_enum level,
+        std::uint64_t offset,
+        std::size_t size)
+    {
+        if (!fp_) return;
+
+        if (!hasPending_) {
+            pending_.firstNs = epochNs;
+            pending_.lastNs = epochNs;
+            pending_.offset = offset;
+            pending_.length = 0;
+            pending_.levelMask = 0;
+            hasPending_ = true;
+        }
+
+        // 멀티 스레드 로깅에서는 시각이 약간 뒤섞일 수 있으므로 최소/최대로 유지
+        if (epochNs < pending_.firstNs) pending_.firstNs = epochNs;
+        if (epochNs > pending_.lastNs) pending_.lastNs = epochNs;
+        pending_.length += static_cast<std::uint32_t>(size);
+        pending_.levelMask |= (1u << static_cast<unsigned>(level));
+
+        if (pending_.length >= interval_) {
+            writePending();
+        }
+    }
+
+    void log_index_writer::flush() {
+        if (fp_) std::fflush(fp_);
+    }
+
+    void log_index_writer::writePending() {
+        if (!hasPending_ || !fp_) return;
+        std::fwrite(&pending_, sizeof(pending_), 1, fp_);
+        std::fflush(fp_);
+        hasPending_ = false;
+    }
+
+    std::string log_index_writer::index_path_of(const std::string& logPath) {
+        std::string p = logPath;
+        if (j2::string::ends_with(p, ".gz")) p.resize(p.size() - 3);
+        return p + ".idx";
+    }
+
+    bool log_index_writer::read(const std::string& indexPath,
+        std::vector<log_index_entry>& out)
+    {
+        out.clear();
+        std::FILE* fp = std::fopen(indexPath.c_str(), "rb");
+        if (!fp) return false;
+
+        char magic[8] = {};
+        std::uint64_t interval = 0;
+        bool ok = std::fread(magic, 1, sizeof(magic), fp) == sizeof(magic) &&
+            std::memcmp(magic, INDEX_MAGIC, sizeof(magic)) == 0 &&
+            std::fread(&interval, sizeof(interval), 1, fp) == 1;
+
+        if (ok) {
+            log_index_entry e;
+            while (std::fread(&e, sizeof(e), 1, fp) == 1) {
+                out.push_back(e);
+            }
+        }
+        std::fclose(fp);
+        return ok;
+    }
+
+} // namespace j2::log
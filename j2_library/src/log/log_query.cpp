@@ -0,0 +1,433 @@
+#include "j2_library/log/log_query.hpp"
+
+#include <ctime>
+#include <cstring>
+#include <atomic>
+#include <thread>
+#include <fstream>
+#include <algorithm>
+#include <filesystem>
+#include <string_view>
+#include <system_error>
+
+#include "j2_library/log/rotating_archive_sink.hpp"
+#include "j2_library/string/string_basic.hpp"
+
+#if defined(J2_HAVE_ZLIB)
+#include <zlib.h>
+#endif
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace j2::log {
+
+    namespace fs = std::filesystem;
+
+    namespace {
+
+        constexpr std::uint64_t UNKNOWN_SIZE = std::numeric_limits<std::uint64_t>::max();
+
+        // 레벨 토큰은 줄 앞부분에서만 찾는다 (메시지 본문의 "[error]" 오인 방지)
+        constexpr std::size_t LEVEL_SEARCH_BYTES = 96;
+
+        std::uint32_t required_level_mask(spdlog::level::level_enum minLevel) {
+            std::uint32_t mask = 0;
+            for (int l = static_cast<int>(minLevel); l < static_cast<int>(spdlog::level::off); ++l) {
+                mask |= (1u << l);
+            }
+            return mask;
+        }
+
+        // 줄 앞부분의 "[레벨]" 토큰 → 레벨 (없으면 -1)
+        int find_line_level(std::string_view line) {
+            static const std::vector<std::string> tokens = [] {
+                std::vector<std::string> t;
+                for (int l = 0; l < static_cast<int>(spdlog::level::off); ++l) {
+                    auto name = spdlog::level::to_string_view(static_cast<spdlog::level::level_enum>(l));
+                    t.push_back("[" + std::string(name.data(), name.size()) + "]");
+                }
+                return t;
+            }();
+
+            std::string_view head = line.substr(0, LEVEL_SEARCH_BYTES);
+            for (std::size_t l = 0; l < tokens.size(); ++l) {
+                if (head.find(tokens[l]) != std::string_view::npos) return static_cast<int>(l);
+            }
+            return -1;
+        }
+
+        // 줄 단위 필터 (블록 경계는 항상 메시지 시작이므로 구간별로 독립 처리)
+        class line_filter {
+        public:
+            line_filter(const log_query_options& o, bool exactTime)
+                : opt_(o)
+                , exactTime_(exactTime)
+                , checkLevel_(o.minLevel > spdlog::level::trace)
+            {}
+
+            bool accept(std::string_view line) {
+                // 시각 또는 레벨을 해석할 수 있는 줄은 새 메시지의 시작
+                // 해석할 수 없는 줄(여러 줄 메시지의 이어지는 줄)은 직전 메시지의 판정을 따른다.
+                std::int64_t ns = 0;
+                const bool hasTime = !exactTime_ &&
+                    log_query::parseLineTime(line.data(), line.size(), opt_.utc, ns);
+                const int level = (checkLevel_ || !exactTime_) ? find_line_level(line) : -1;
+
+                if (hasTime || level >= 0) {
+                    bool ok = true;
+                    if (hasTime) ok = ns >= opt_.fromNs && ns <= opt_.toNs;
+                    if (ok && checkLevel_) ok = level >= static_cast<int>(opt_.minLevel);
+                    recordOk_ = ok;
+                }
+
+                if (!recordOk_) return false;
+                if (!opt_.contains.empty() && line.find(opt_.contains) == std::string_view::npos) return false;
+                return true;
+            }
+
+        private:
+            const log_query_options& opt_;
+            bool exactTime_;
+            bool checkLevel_;
+            bool recordOk_ = true;
+        };
+
+        struct file_result {
+            std::vector<log_query_hit> hits;
+            std::uint64_t totalBytes = 0;
+            std::uint64_t scannedBytes = 0;
+        };
+
+        // 버퍼를 줄 단위로 나누어 필터링 (마지막 줄은 개행이 없어도 포함)
+        // 반환값: maxResults 에 도달하면 false
+        bool scan_buffer(const char* data, std::size_t len, std::uint64_t baseOffset,
+            const std::string& file, const log_query_options& opt, bool exactTime,
+            file_result& out)
+        {
+            line_filter filter(opt, exactTime);
+            std::size_t pos = 0;
+            while (pos < len) {
+                const char* nl = static_cast<const char*>(std::memchr(data + pos, '\n', len - pos));
+                std::size_t end = nl ? static_cast<std::size_t>(nl - data) : len;
+                std::size_t lineEnd = end;
+                if (lineEnd > pos && data[lineEnd - 1] == '\r') --lineEnd;
+
+                std::string_view line(data + pos, lineEnd - pos);
+                if (filter.accept(line)) {
+                    out.hits.push_back(log_query_hit{ file, baseOffset + pos, std::string(line) });
+                    if (opt.maxResults > 0 && out.hits.size() >= opt.maxResults) return false;
+                }
+                pos = end + 1;
+            }
+            return true;
+        }
+
+#ifndef _WIN32
+        // 필요한 구간만 mmap 하여 검색
+        void scan_plain_file(const std::string& file,
+            const std::vector<log_query::range>& ranges,
+            const log_query_options& opt, file_result& out)
+        {
+            int fd = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) return;
+
+            const std::uint64_t page = static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+            for (const auto& r : ranges) {
+                if (r.end <= r.begin) continue;
+                const std::uint64_t aligned = r.begin - (r.begin % page);
+                const std::size_t mapLen = static_cast<std::size_t>(r.end - aligned);
+
+                void* p = ::mmap(nullptr, mapLen, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(aligned));
+                if (p == MAP_FAILED) continue;
+                ::madvise(p, mapLen, MADV_SEQUENTIAL);
+
+                const char* data = static_cast<const char*>(p) + (r.begin - aligned);
+                const std::size_t len = static_cast<std::size_t>(r.end - r.begin);
+                out.scannedBytes += len;
+                const bool more = scan_buffer(data, len, r.begin, file, opt, r.exactTime, out);
+                ::munmap(p, mapLen);
+                if (!more) break;
+            }
+            ::close(fd);
+        }
+#else
+        // Windows: 필요한 구간만 읽어서 검색
+        void scan_plain_file(const std::string& file,
+            const std::vector<log_query::range>& ranges,
+            const log_query_options& opt, file_result& out)
+        {
+            std::ifstream in(file, std::ios::binary);
+            if (!in) return;
+
+            std::vector<char> buf;
+            for (const auto& r : ranges) {
+                if (r.end <= r.begin) continue;
+                buf.resize(static_cast<std::size_t>(r.end - r.begin));
+                in.clear();
+                in.seekg(static_cast<std::streamoff>(r.begin));
+                in.read(buf.data(), static_cast<std::streamsize>(buf.size()));
+                const std::size_t len = static_cast<std::size_t>(in.gcount());
+                out.scannedBytes += len;
+                if (!scan_buffer(buf.data(), len, r.begin, file, opt, r.exactTime, out)) break;
+            }
+        }
+#endif
+
+        // .gz 보관 파일: 압축을 풀며 앞으로만 이동하여 필요한 구간만 읽음
+        void scan_gz_file(const std::string& file,
+            const std::vector<log_query::range>& ranges,
+            const log_query_options& opt, file_result& out)
+        {
+#if defined(J2_HAVE_ZLIB)
+            gzFile gz = gzopen(file.c_str(), "rb");
+            if (!gz) return;
+            gzbuffer(gz, 256 * 1024);
+
+            std::vector<char> buf;
+            for (const auto& r : ranges) {
+                if (r.end <= r.begin) continue;
+                if (gzseek(gz, static_cast<z_off_t>(r.begin), SEEK_SET) < 0) break;
+
+                buf.clear();
+                const std::uint64_t want = r.end - r.begin;
+                char chunk[64 * 1024];
+                while (buf.size() < want) {
+                    const std::uint64_t left = want - buf.size();
+                    const unsigned n = static_cast<unsigned>(std::min<std::uint64_t>(left, sizeof(chunk)));
+                    const int got = gzread(gz, chunk, n);
+                    if (got <= 0) break;
+                    buf.insert(buf.end(), chunk, chunk + got);
+                }
+                out.scannedBytes += buf.size();
+                if (!scan_buffer(buf.data(), buf.size(), r.begin, file, opt, r.exactTime, out)) break;
+            }
+            gzclose(gz);
+#else
+            (void)file;
+            (void)ranges;
+            (void)opt;
+            (void)out;
+#endif
+        }
+
+        file_result search_file(const std::string& file, const log_query_options& opt) {
+            file_result out;
+            const bool gz = j2::string::ends_with(file, ".gz");
+#if !defined(J2_HAVE_ZLIB)
+            if (gz) return out;
+#endif
+            std::error_code ec;
+            const std::uint64_t diskSize = static_cast<std::uint64_t>(fs::file_size(file, ec));
+            if (ec) return out;
+            out.totalBytes = diskSize;
+
+            std::vector<log_index_entry> entries;
+            log_index_writer::read(log_index_writer::index_path_of(file), entries);
+
+            // 압축 파일은 압축 해제 후 크기를 알 수 없으므로 끝 구간은 EOF 까지 읽음
+            const auto ranges = log_query::selectRanges(entries, gz ? UNKNOWN_SIZE : diskSize, opt);
+            if (gz) {
+                scan_gz_file(file, ranges, opt, out);
+            }
+            else {
+                scan_plain_file(file, ranges, opt, out);
+            }
+            return out;
+        }
+
+    } // anonymous namespace
+
+    std::vector<std::string> log_query::listFiles(const std::string& basePath) {
+        struct item {
+            std::string path;
+            fs::file_time_type mtime;
+        };
+        std::vector<item> archives;
+
+        fs::path dir = fs::path(basePath).parent_path();
+        if (dir.empty()) dir = ".";
+
+        std::error_code ec;
+        for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+            if (!it->is_regular_file(ec)) continue;
+            fs::path candidate = fs::path(basePath).parent_path() / it->path().filename();
+            if (!rotating_archive_sink::is_rotated_name_of(basePath, candidate.string())) continue;
+            archives.push_back(item{ candidate.string(), it->last_write_time(ec) });
+        }
+
+        std::sort(archives.begin(), archives.end(), [](const item& a, const item& b) {
+            if (a.mtime != b.mtime) return a.mtime < b.mtime;
+            return a.path < b.path;
+            });
+
+        std::vector<std::string> out;
+        out.reserve(archives.size() + 1);
+        for (auto& a : archives) out.push_back(std::move(a.path));
+        if (fs::exists(basePath, ec)) out.push_back(basePath);
+        return out;
+    }
+
+    std::vector<log_query::range> log_query::selectRanges(
+        const std::vector<log_index_entry>& entries,
+        std::uint64_t fileSize,
+        const log_query_options& options)
+    {
+        const std::uint32_t levelMask = required_level_mask(options.minLevel);
+
+        // 시각 범위에 걸치는 인덱스 구간 [lo, hi) 를 이진 탐색으로 찾는다.
+        // (시스템 시각이 뒤로 간 경우처럼 정렬되어 있지 않으면 전체를 대상으로 함)
+        std::size_t lo = 0;
+        std::size_t hi = entries.size();
+        const bool sorted = std::is_sorted(entries.begin(), entries.end(),
+            [](const log_index_entry& a, const log_index_entry& b) { return a.lastNs < b.lastNs; }) &&
+            std::is_sorted(entries.begin(), entries.end(),
+                [](const log_index_entry& a, const log_index_entry& b) { return a.firstNs < b.firstNs; });
+        if (sorted) {
+            lo = static_cast<std::size_t>(std::partition_point(entries.begin(), entries.end(),
+                [&](const log_index_entry& e) { return e.lastNs < options.fromNs; }) - entries.begin());
+            hi = static_cast<std::size_t>(std::partition_point(entries.begin(), entries.end(),
+                [&](const log_index_entry& e) { return e.firstNs <= options.toNs; }) - entries.begin());
+        }
+
+        std::vector<range> out;
+        auto push = [&out](std::uint64_t begin, std::uint64_t end, bool exact) {
+            if (end <= begin) return;
+            if (!out.empty() && out.back().end == begin && out.back().exactTime == exact) {
+                out.back().end = end; // 이어지는 구간은 한 번에 매핑
+                return;
+            }
+            out.push_back(range{ begin, end, exact });
+        };
+
+        // 인덱스가 덮지 못하는 구간(인덱스 도입 전 내용, 비정상 종료로 빠진 블록)은 항상 검사
+        std::uint64_t cursor = 0;
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            const auto& e = entries[i];
+            if (e.offset >= fileSize) break;
+            const std::uint64_t end = std::min<std::uint64_t>(e.offset + e.length, fileSize);
+
+            if (e.offset > cursor) push(cursor, e.offset, false);
+
+            const bool inTime = i >= lo && i < hi &&
+                e.lastNs >= options.fromNs && e.firstNs <= options.toNs;
+            if (inTime && (e.levelMask & levelMask) != 0) {
+                const bool exact = e.firstNs >= options.fromNs && e.lastNs <= options.toNs;
+                push(e.offset, end, exact);
+            }
+            cursor = std::max(cursor, end);
+        }
+
+        // 기록 중인 마지막 블록 (아직 인덱스에 없음)
+        if (cursor < fileSize) push(cursor, fileSize, false);
+        return out;
+    }
+
+    bool log_query::parseLineTime(const char* line, std::size_t len, bool utc, std::int64_t& epochNs) {
+        // "[YYYY-mm-dd HH:MM:SS.mmm]"
+        if (len < 25 || line[0] != '[' || line[5] != '-' || line[8] != '-' || line[11] != ' ' ||
+            line[14] != ':' || line[17] != ':' || line[20] != '.' || line[24] != ']') {
+            return false;
+        }
+        auto num = [line](int pos, int n, int& v) {
+            v = 0;
+            for (int i = 0; i < n; ++i) {
+                char c = line[pos + i];
+                if (c < '0' || c > '9') return false;
+                v = v * 10 + (c - '0');
+            }
+            return true;
+        };
+        int Y, m, d, H, M, S, ms;
+        if (!num(1, 4, Y) || !num(6, 2, m) || !num(9, 2, d) || !num(12, 2, H) ||
+            !num(15, 2, M) || !num(18, 2, S) || !num(21, 3, ms)) {
+            return false;
+        }
+
+        // mktime 은 느리므로 같은 분(minute)의 변환 결과를 스레드별로 재사용
+        thread_local int cacheKey[6] = { -1, -1, -1, -1, -1, -1 };
+        thread_local std::int64_t cacheMinuteSec = 0;
+        const int key[6] = { Y, m, d, H, M, utc ? 1 : 0 };
+        if (!std::equal(std::begin(key), std::end(key), std::begin(cacheKey))) {
+            std::tm tmv{};
+            tmv.tm_year = Y - 1900;
+            tmv.tm_mon = m - 1;
+            tmv.tm_mday = d;
+            tmv.tm_hour = H;
+            tmv.tm_min = M;
+            tmv.tm_sec = 0;
+            tmv.tm_isdst = -1;
+            std::time_t t;
+            if (utc) {
+#ifdef _WIN32
+                t = _mkgmtime(&tmv);
+#else
+                t = timegm(&tmv);
+#endif
+            }
+            else {
+                t = std::mktime(&tmv);
+            }
+            if (t == static_cast<std::time_t>(-1)) return false;
+            std::copy(std::begin(key), std::end(key), std::begin(cacheKey));
+            cacheMinuteSec = static_cast<std::int64_t>(t);
+        }
+
+        epochNs = (cacheMinuteSec + S) * 1000000000LL + static_cast<std::int64_t>(ms) * 1000000LL;
+        return true;
+    }
+
+    std::vector<log_query_hit> log_query::run(const std::string& basePath,
+        const log_query_options& options,
+        log_query_stats* stats)
+    {
+        const std::vector<std::string> files = listFiles(basePath);
+        std::vector<file_result> results(files.size());
+
+        unsigned threads = options.threads;
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        threads = static_cast<unsigned>(std::min<std::size_t>(threads, files.size()));
+
+        // 파일 단위로 작업을 나누어 병렬 검색
+        std::atomic<std::size_t> next{ 0 };
+        auto worker = [&]() {
+            for (std::size_t i = next.fetch_add(1); i < files.size(); i = next.fetch_add(1)) {
+                try {
+                    results[i] = search_file(files[i], options);
+                }
+                catch (...) {
+                    // 검색 도중 파일이 회전/삭제된 경우 등은 건너뜀
+                }
+            }
+        };
+
+        if (threads <= 1) {
+            worker();
+        }
+        else {
+            std::vector<std::thread> pool;
+            pool.reserve(threads);
+            for (unsigned t = 0; t < threads; ++t) pool.emplace_back(worker);
+            for (auto& th : pool) th.join();
+        }
+
+        std::vector<log_query_hit> out;
+        log_query_stats st;
+        st.files = files.size();
+        for (auto& r : results) {
+            st.totalBytes += r.totalBytes;
+            st.scannedBytes += r.scannedBytes;
+            for (auto& h : r.hits) {
+                if (options.maxResults > 0 && out.size() >= options.maxResults) break;
+                out.push_back(std::move(h));
+            }
+        }
+        if (stats) *stats = st;
+        return out;
+    }
+
+} // namespace j2::log
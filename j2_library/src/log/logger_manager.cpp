@@ -52,10 +52,20 @@ namespace j2::log {
             std::size_t width_{ 5 };
         };
 #endif // J2_SPDLOG_HAS_CUSTOM_FLAG
+
+        // 네트워크 싱크 재생성이 필요한지 비교 (hard-reload)
+        bool same_net_options(const network_sink::options& a, const network_sink::options& b) {
+            return a.protocol == b.protocol && a.host == b.host && a.port == b.port &&
+                a.maxBatchBytes == b.maxBatchBytes && a.flushIntervalMs == b.flushIntervalMs &&
+                a.maxQueueBytes == b.maxQueueBytes;
+        }
     } // anonymous namespace
 
     logger_manager::logger_manager() {}
-    logger_manager::~logger_manager() { stopAutoReload(); }
+    logger_manager::~logger_manager() {
+        stopAutoReload();
+        if (archiver_) archiver_->stop();
+    }
 
     // init에서 락을 해제한 뒤 start/stopAutoReload를 호출하여 교착 방지
     bool logger_manager::init(const std::string& defaultConfigPath,
@@ -130,23 +140,26 @@ namespace j2::log {
             }
 
             if (enableFileAll_) {
-                ensureParentDir(allPath_);
-                allSink_ = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(
-                    allPath_, allMaxSize_, allMaxFiles_, false);
+                allSink_ = makeFileSink(allPath_, allMaxSize_, allMaxFiles_);
                 allSink_->set_level(allFileMin_);
                 allSink_->set_formatter(file_fmt->clone());
                 distSink_->add_sink(allSink_);
             }
 
             if (enableFileAlerts_) {
-                ensureParentDir(alertsPath_);
-                alertsSink_ = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(
-                    alertsPath_, alertMaxSize_, alertMaxFiles_, false);
+                alertsSink_ = makeFileSink(alertsPath_, alertMaxSize_, alertMaxFiles_);
                 alertsSink_->set_level(alertsMin_);
                 alertsSink_->set_formatter(file_fmt->clone());
                 distSink_->add_sink(alertsSink_);
             }
 
+            if (netSinkEnable_) {
+                netSink_ = std::make_shared<network_sink>(netSinkOptions_);
+                netSink_->set_level(netSinkMin_);
+                netSink_->set_formatter(file_fmt->clone());
+                distSink_->add_sink(netSink_);
+            }
+
             if (distSink_->sinks().empty()) {
                 auto fallback = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
                 fallback->set_level(spdlog::level::trace);
@@ -163,6 +176,13 @@ namespace j2::log {
                 std::cerr << "[logger_manager] No sinks enabled, fallback to console.\n";
             }
 
+            // 플라이트 레코더는 파일 I/O 없이 메모리에만 기록하므로 출력 싱크로 집계하지 않음
+            if (flightRecorderEnable_) {
+                flight_recorder::setSlotsPerThread(flightRecorderSlots_);
+                flightSink_ = std::make_shared<flight_recorder_sink>();
+                distSink_->add_sink(flightSink_);
+            }
+
             logger_ = std::make_shared<spdlog::logger>(loggerName_, distSink_);
             spdlog::register_logger(logger_);
 
@@ -223,11 +243,76 @@ namespace j2::log {
             alertsSink_->set_level(alertsMin_);
             alertsSink_->set_formatter(file_fmt->clone());
         }
+        if (netSink_) {
+            netSink_->set_level(netSinkMin_);
+            netSink_->set_formatter(file_fmt->clone());
+        }
 
         if (logger_) {
             logger_->set_level(loggerMin_);
             logger_->flush_on(flushOn_);
         }
+
+        applyArchivePolicy();
+    }
+
+    // 파일 싱크 생성
+    //  ARCHIVE_ENABLE=false: spdlog 기본 rotating_file_sink_mt (백업 개수 기준)
+    //  ARCHIVE_ENABLE=true : rotating_archive_sink + log_archiver (보관 바이트 기준, 백그라운드 압축)
+    //  INDEX_ENABLE=true   : 인덱스를 회전 파일과 함께 옮겨야 하므로 rotating_archive_sink 사용
+    //                        (ARCHIVE_ENABLE=false 이면 압축 없이 *_MAX_FILES 개수 기준으로 보관)
+    spdlog::sink_ptr logger_manager::makeFileSink(const std::string& path,
+        std::size_t maxSize,
+        std::size_t maxFiles) {
+        ensureParentDir(path);
+
+        if (!archiveEnable_ && !indexEnable_) {
+            return std::make_shared<spdlog::sinks::rotating_file_sink_mt>(
+                path, maxSize, maxFiles, false);
+        }
+
+        if (!archiver_) {
+            archiver_ = std::make_shared<log_archiver>();
+        }
+        archiver_->start();
+        return std::make_shared<rotating_archive_sink>(path, maxSize, archiver_->makeHook(path),
+            indexEnable_ ? indexInterval_ : 0);
+    }
+
+    // 보관 정책(압축 여부/보관 바이트)은 soft-reload 로 즉시 반영
+    void logger_manager::applyArchivePolicy() {
+        if (!archiver_) return;
+
+        if (!archiveEnable_) {
+            // 인덱스만 사용하는 경우: 압축 없이 백업 개수 기준 보관 (spdlog 기본 싱크와 같은 보관량)
+            if (!indexEnable_) return;
+            log_archiver::policy p;
+            p.compress = false;
+            if (enableFileAll_) {
+                p.maxArchiveFiles = std::max<std::size_t>(allMaxFiles_, 1);
+                archiver_->setPolicy(allPath_, p);
+            }
+            if (enableFileAlerts_) {
+                p.maxArchiveFiles = std::max<std::size_t>(alertMaxFiles_, 1);
+                archiver_->setPolicy(alertsPath_, p);
+            }
+            return;
+        }
+
+        if (archiveCompress_ && !log_archiver::compressionAvailable()) {
+            std::cerr << "[logger_manager] ARCHIVE_COMPRESS=true but built without zlib. Archiving uncompressed.\n";
+        }
+
+        log_archiver::policy p;
+        p.compress = archiveCompress_;
+        if (enableFileAll_) {
+            p.maxArchiveBytes = allArchiveMaxBytes_;
+            archiver_->setPolicy(allPath_, p);
+        }
+        if (enableFileAlerts_) {
+            p.maxArchiveBytes = alertArchiveMaxBytes_;
+            archiver_->setPolicy(alertsPath_, p);
+        }
     }
 
     void logger_manager::applyHardSettingsIfNeeded(
@@ -239,7 +324,13 @@ namespace j2::log {
         std::size_t old_allMaxSize,
         std::size_t old_allMaxFiles,
         std::size_t old_alertMaxSize,
-        std::size_t old_alertMaxFiles)
+        std::size_t old_alertMaxFiles,
+        bool old_archiveEnable,
+        bool old_indexEnable,
+        std::size_t old_indexInterval,
+        bool old_flightRecorderEnable,
+        bool old_netSinkEnable,
+        const network_sink::options& old_netSinkOptions)
     {
 
         auto time_type = utcMode_ ? spdlog::pattern_time_type::utc
@@ -278,13 +369,14 @@ namespace j2::log {
             (!old_enableFileAll && enableFileAll_) ||
             (allSink_ && (allPath_ != old_allPath ||
                 allMaxSize_ != old_allMaxSize ||
-                allMaxFiles_ != old_allMaxFiles));
+                allMaxFiles_ != old_allMaxFiles ||
+                archiveEnable_ != old_archiveEnable ||
+                indexEnable_ != old_indexEnable ||
+                indexInterval_ != old_indexInterval));
 
         if (enableFileAll_) {
             if (need_new_all) {
-                ensureParentDir(allPath_);
-                auto new_all = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(
-                    allPath_, allMaxSize_, allMaxFiles_, false);
+                auto new_all = makeFileSink(allPath_, allMaxSize_, allMaxFiles_);
                 new_all->set_level(allFileMin_);
                 new_all->set_formatter(file_fmt->clone());
                 distSink_->add_sink(new_all);
@@ -308,13 +400,14 @@ namespace j2::log {
             (!old_enableFileAlerts && enableFileAlerts_) ||
             (alertsSink_ && (alertsPath_ != old_alertsPath ||
                 alertMaxSize_ != old_alertMaxSize ||
-                alertMaxFiles_ != old_alertMaxFiles));
+                alertMaxFiles_ != old_alertMaxFiles ||
+                archiveEnable_ != old_archiveEnable ||
+                indexEnable_ != old_indexEnable ||
+                indexInterval_ != old_indexInterval));
 
         if (enableFileAlerts_) {
             if (need_new_alerts) {
-                ensureParentDir(alertsPath_);
-                auto new_alerts = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(
-                    alertsPath_, alertMaxSize_, alertMaxFiles_, false);
+                auto new_alerts = makeFileSink(alertsPath_, alertMaxSize_, alertMaxFiles_);
                 new_alerts->set_level(alertsMin_);
                 new_alerts->set_formatter(file_fmt->clone());
                 distSink_->add_sink(new_alerts);
@@ -333,7 +426,44 @@ namespace j2::log {
             }
         }
 
-        if (distSink_->sinks().empty()) {
+        bool need_new_net =
+            (netSinkEnable_ && !netSink_) ||
+            (!old_netSinkEnable && netSinkEnable_) ||
+            (netSink_ && !same_net_options(netSinkOptions_, old_netSinkOptions));
+
+        if (netSinkEnable_) {
+            if (need_new_net) {
+                auto new_net = std::make_shared<network_sink>(netSinkOptions_);
+                new_net->set_level(netSinkMin_);
+                new_net->set_formatter(file_fmt->clone());
+                distSink_->add_sink(new_net);
+                if (netSink_) {
+                    netSink_->flush();
+                    distSink_->remove_sink(netSink_);
+                }
+                netSink_.swap(new_net);
+            }
+        }
+        else {
+            if (netSink_) {
+                netSink_->flush();
+                distSink_->remove_sink(netSink_);
+                netSink_.reset();
+            }
+        }
+
+        // 플라이트 레코더 싱크 추가/제거 (슬롯 개수는 이후 새로 할당되는 링부터 적용)
+        flight_recorder::setSlotsPerThread(flightRecorderSlots_);
+        if (flightRecorderEnable_ && !old_flightRecorderEnable && !flightSink_) {
+            flightSink_ = std::make_shared<flight_recorder_sink>();
+            distSink_->add_sink(flightSink_);
+        }
+        else if (!flightRecorderEnable_ && flightSink_) {
+            distSink_->remove_sink(flightSink_);
+            flightSink_.reset();
+        }
+
+        if (distSink_->sinks().size() <= (flightSink_ ? 1u : 0u)) {
             auto fallback = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
             fallback->set_level(spdlog::level::trace);
 #if defined(J2_SPDLOG_HAS_CUSTOM_FLAG)
@@ -378,6 +508,12 @@ namespace j2::log {
         std::size_t old_allMaxFiles = allMaxFiles_;
         std::size_t old_alertMaxSize = alertMaxSize_;
         std::size_t old_alertMaxFiles = alertMaxFiles_;
+        bool old_archiveEnable = archiveEnable_;
+        bool old_indexEnable = indexEnable_;
+        std::size_t old_indexInterval = indexInterval_;
+        bool old_flightRecorderEnable = flightRecorderEnable_;
+        bool old_netSinkEnable = netSinkEnable_;
+        network_sink::options old_netSinkOptions = netSinkOptions_;
 
         bool ok = loadConfig(false);
         if (!ok) {
@@ -388,7 +524,9 @@ namespace j2::log {
         applyHardSettingsIfNeeded(
             old_enableConsole, old_enableFileAll, old_enableFileAlerts,
             old_allPath, old_alertsPath,
-            old_allMaxSize, old_allMaxFiles, old_alertMaxSize, old_alertMaxFiles);
+            old_allMaxSize, old_allMaxFiles, old_alertMaxSize, old_alertMaxFiles,
+            old_archiveEnable, old_indexEnable, old_indexInterval,
+            old_flightRecorderEnable, old_netSinkEnable, old_netSinkOptions);
 
         applySoftSettings();
 
@@ -513,6 +651,42 @@ namespace j2::log {
         alertMaxFiles_ = static_cast<std::size_t>(
             get_ll("ALERT_MAX_FILES", 10));
 
+        // 회전 파일 보관(압축) 정책
+        archiveEnable_ = toBool(get_str("ARCHIVE_ENABLE", "false"), false);
+        archiveCompress_ = toBool(get_str("ARCHIVE_COMPRESS", "true"), true);
+        allArchiveMaxBytes_ = parseSizeBytes(
+            get_str("ALL_ARCHIVE_MAX_BYTES", "1GB"),
+            1024ull * 1024ull * 1024ull);
+        alertArchiveMaxBytes_ = parseSizeBytes(
+            get_str("ALERT_ARCHIVE_MAX_BYTES", "1GB"),
+            1024ull * 1024ull * 1024ull);
+
+        // 시간 인덱스
+        indexEnable_ = toBool(get_str("INDEX_ENABLE", "false"), false);
+        indexInterval_ = parseSizeBytes(get_str("INDEX_INTERVAL", "64KB"), 64 * 1024);
+        if (indexInterval_ == 0) indexInterval_ = 64 * 1024;
+
+        // 네트워크 로그 전송
+        netSinkEnable_ = toBool(get_str("NET_SINK_ENABLE", "false"), false);
+        netSinkOptions_.protocol = (toLower(get_str("NET_SINK_PROTOCOL", "udp")) == "tcp")
+            ? network_sink::transport::tcp : network_sink::transport::udp;
+        netSinkOptions_.host = get_str("NET_SINK_HOST", "");
+        netSinkOptions_.port = static_cast<std::uint16_t>(get_ll("NET_SINK_PORT", 0));
+        netSinkOptions_.maxBatchBytes = parseSizeBytes(get_str("NET_SINK_BATCH_BYTES", "60000"), 60000);
+        netSinkOptions_.flushIntervalMs = static_cast<unsigned>(get_ll("NET_SINK_FLUSH_MS", 200));
+        netSinkOptions_.maxQueueBytes = parseSizeBytes(get_str("NET_SINK_QUEUE_BYTES", "4MB"), 4 * 1024 * 1024);
+        netSinkMin_ = parseLevel(get_str("NET_SINK_LEVEL", "info"), spdlog::level::info);
+        if (netSinkEnable_ && (netSinkOptions_.host.empty() || netSinkOptions_.port == 0)) {
+            std::cerr << "[logger_manager] NET_SINK_ENABLE=true but NET_SINK_HOST/NET_SINK_PORT is empty. Network sink disabled.\n";
+            netSinkEnable_ = false;
+        }
+
+        // 플라이트 레코더
+        flightRecorderEnable_ = toBool(get_str("FLIGHT_RECORDER_ENABLE", "false"), false);
+        flightRecorderSlots_ = static_cast<std::size_t>(
+            get_ll("FLIGHT_RECORDER_SLOTS", 256));
+        if (flightRecorderSlots_ == 0) flightRecorderSlots_ = 1;
+
         // 디스크 감시 ON/OFF 및 파라미터
         diskGuardEnable_ = toBool(get_str("DISK_GUARD_ENABLE", "true"), true);
         diskRoot_ = get_str("DISK_ROOT", "");
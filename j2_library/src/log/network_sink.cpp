@@ -0,0 +1,189 @@
+#include "j2_library/log/network_sink.hpp"
+
+#include <chrono>
+#include <iostream>
+
+#include <spdlog/fmt/fmt.h>
+
+namespace j2::log {
+
+    network_sink::network_sink(const options& opt)
+        : opt_(opt)
+    {
+        if (opt_.maxBatchBytes == 0) opt_.maxBatchBytes = 60000;
+        if (opt_.maxQueueBytes < opt_.maxBatchBytes) opt_.maxQueueBytes = opt_.maxBatchBytes;
+
+        if (opt_.protocol == transport::udp) {
+            udp_ = std::make_unique<j2::network::udp::udp_sender>();
+            udp_->setServer(opt_.host, opt_.port);
+            if (!udp_->create()) {
+                std::cerr << "[network_sink] Failed to create UDP sender for "
+                    << opt_.host << ":" << opt_.port << "\n";
+            }
+        }
+        else {
+            const int family = (opt_.host.find(':') != std::string::npos) ? AF_INET6 : AF_INET;
+            tcp_ = std::make_unique<j2::network::tcp::tcp_client>();
+            tcp_->setServer(opt_.host, opt_.port, family);
+            tcp_->start(); // 연결/재연결은 tcp_client 스레드가 담당
+        }
+
+        queue_.data.reserve(opt_.maxBatchBytes);
+        shipping_.data.reserve(opt_.maxBatchBytes);
+        batch_.reserve(opt_.maxBatchBytes + 4);
+
+        shipper_ = std::thread(&network_sink::shipLoop, this);
+    }
+
+    network_sink::~network_sink() {
+        {
+            std::lock_guard<std::mutex> lk(queueMu_);
+            stop_ = true;
+        }
+        queueCv_.notify_all();
+        if (shipper_.joinable()) {
+            shipper_.join();
+        }
+        if (tcp_) tcp_->stop();
+        if (udp_) udp_->stop();
+    }
+
+    network_sink::stats network_sink::getStats() const {
+        stats s;
+        s.queuedRecords = queuedRecords_.load();
+        s.droppedRecords = droppedRecords_.load();
+        s.droppedBytes = droppedBytes_.load();
+        s.sentRecords = sentRecords_.load();
+        s.sentBatches = sentBatches_.load();
+        s.sentBytes = sentBytes_.load();
+        s.sendFailures = sendFailures_.load();
+        return s;
+    }
+
+    void network_sink::sink_it_(const spdlog::details::log_msg& msg) {
+        spdlog::memory_buf_t formatted;
+        formatter_->format(msg, formatted);
+
+        // UDP 는 레코드 1개가 datagram 1개를 넘지 않도록 자름
+        std::size_t len = formatted.size();
+        if (opt_.protocol == transport::udp && len > opt_.maxBatchBytes) {
+            len = opt_.maxBatchBytes;
+        }
+
+        bool wake = false;
+        {
+            std::lock_guard<std::mutex> lk(queueMu_);
+            if (queue_.data.size() + len > opt_.maxQueueBytes) {
+                // 전송이 밀린 경우 로깅 스레드를 막지 않고 버림
+                ++unreportedDrops_;
+                unreportedDropBytes_ += len;
+                droppedRecords_.fetch_add(1, std::memory_order_relaxed);
+                droppedBytes_.fetch_add(len, std::memory_order_relaxed);
+                return;
+            }
+            const std::size_t before = queue_.data.size();
+            queue_.data.append(formatted.data(), len);
+            queue_.lengths.push_back(static_cast<std::uint32_t>(len));
+            // 묶음 1개 분량이 찼을 때만 깨움 (레코드마다 깨우지 않음)
+            wake = before < opt_.maxBatchBytes && queue_.data.size() >= opt_.maxBatchBytes;
+        }
+        queuedRecords_.fetch_add(1, std::memory_order_relaxed);
+        if (wake) queueCv_.notify_one();
+    }
+
+    void network_sink::flush_() {
+        {
+            std::lock_guard<std::mutex> lk(queueMu_);
+            flushRequested_ = true;
+        }
+        queueCv_.notify_one();
+    }
+
+    void network_sink::shipLoop() {
+        const auto interval = std::chrono::milliseconds(opt_.flushIntervalMs > 0 ? opt_.flushIntervalMs : 1);
+
+        while (true) {
+            bool stopping = false;
+            {
+                std::unique_lock<std::mutex> lk(queueMu_);
+                queueCv_.wait_for(lk, interval, [this] {
+                    return stop_ || flushRequested_ || queue_.data.size() >= opt_.maxBatchBytes;
+                    });
+
+                // 버퍼 교환 (할당된 용량은 양쪽에서 재사용)
+                shipping_.clear();
+                std::swap(queue_, shipping_);
+                flushRequested_ = false;
+                stopping = stop_;
+            }
+
+            ship(shipping_);
+            if (stopping) break;
+        }
+    }
+
+    void network_sink::ship(const pending& p) {
+        std::uint64_t drops = 0;
+        std::uint64_t dropBytes = 0;
+        {
+            std::lock_guard<std::mutex> lk(queueMu_);
+            drops = unreportedDrops_;
+            dropBytes = unreportedDropBytes_;
+            unreportedDrops_ = 0;
+            unreportedDropBytes_ = 0;
+        }
+        if (p.lengths.empty() && drops == 0) return;
+
+        batch_.clear();
+        std::uint64_t records = 0;
+        if (drops > 0) {
+            batch_ += fmt::format("[network_sink] dropped {} records ({} bytes)\n", drops, dropBytes);
+        }
+
+        std::size_t offset = 0;
+        for (std::uint32_t len : p.lengths) {
+            if (!batch_.empty() && batch_.size() + len > opt_.maxBatchBytes) {
+                sendBatch(batch_, records);
+                records = 0;
+            }
+            batch_.append(p.data, offset, len);
+            offset += len;
+            ++records;
+        }
+        if (!batch_.empty()) {
+            sendBatch(batch_, records);
+        }
+    }
+
+    void network_sink::sendBatch(std::string& batch, std::uint64_t records) {
+        bool ok = false;
+
+        if (udp_) {
+            ok = udp_->send_data(batch) == static_cast<ssize_t>(batch.size());
+        }
+        else if (tcp_ && tcp_->is_connected()) {
+            // [길이(4, big-endian)][페이로드]
+            const std::uint32_t n = static_cast<std::uint32_t>(batch.size());
+            const char header[4] = {
+                static_cast<char>((n >> 24) & 0xFF), static_cast<char>((n >> 16) & 0xFF),
+                static_cast<char>((n >> 8) & 0xFF), static_cast<char>(n & 0xFF) };
+            batch.insert(0, header, sizeof(header));
+
+            // 부분 전송 후 실패하면 tcp_client가 연결을 끊고 재연결한다 (프레임 경계 유지)
+            ok = tcp_->send_all(batch.data(), batch.size());
+        }
+
+        if (ok) {
+            sentRecords_.fetch_add(records, std::memory_order_relaxed);
+            sentBatches_.fetch_add(1, std::memory_order_relaxed);
+            sentBytes_.fetch_add(batch.size(), std::memory_order_relaxed);
+        }
+        else {
+            sendFailures_.fetch_add(1, std::memory_order_relaxed);
+            droppedRecords_.fetch_add(records, std::memory_order_relaxed);
+            droppedBytes_.fetch_add(batch.size(), std::memory_order_relaxed);
+        }
+        batch.clear();
+    }
+
+} // namespace j2::log
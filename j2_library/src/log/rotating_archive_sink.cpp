@@ -0,0 +1,171 @@
+#include "j2_library/log/rotating_archive_sink.hpp"
+
+#include <ctime>
+#include <chrono>
+#include <iostream>
+#include <filesystem>
+#include <system_error>
+
+#include <spdlog/details/os.h>
+#include <spdlog/fmt/fmt.h>
+
+#include "j2_library/string/string_basic.hpp"
+
+namespace j2::log {
+
+    namespace {
+        // 회전 이름의 가운데 부분(타임스탬프-순번)은 숫자와 '-' 로만 구성
+        bool is_rotation_token(const std::string& token) {
+            if (token.empty()) return false;
+            for (char c : token) {
+                if (!((c >= '0' && c <= '9') || c == '-')) return false;
+            }
+            return true;
+        }
+    } // anonymous namespace
+
+    rotating_archive_sink::rotating_archive_sink(std::string base_filename,
+        std::size_t max_size,
+        rotate_hook hook,
+        std::size_t index_interval)
+        : base_filename_(std::move(base_filename))
+        , max_size_(max_size)
+        , hook_(std::move(hook))
+        , index_interval_(index_interval)
+    {
+        if (max_size_ == 0) {
+            spdlog::throw_spdlog_ex("rotating_archive_sink constructor: max_size arg cannot be zero");
+        }
+        file_helper_.open(base_filename_, false);
+        current_size_ = file_helper_.size(); // 기존 파일에 이어 쓰기
+        write_offset_ = current_size_;
+
+        if (index_interval_ > 0) {
+            // 로그 파일이 비어 있으면 이전 인덱스는 의미가 없으므로 새로 작성
+            index_.open(log_index_writer::index_path_of(base_filename_),
+                index_interval_, current_size_, current_size_ == 0);
+        }
+    }
+
+    const std::string& rotating_archive_sink::filename() const {
+        return base_filename_;
+    }
+
+    std::string rotating_archive_sink::make_rotated_name(const std::string& base_filename,
+        std::uint64_t seq)
+    {
+        std::filesystem::path base(base_filename);
+        std::filesystem::path ext = base.extension();
+        std::filesystem::path stem = base;
+        stem.replace_extension();
+
+        std::tm tm = spdlog::details::os::localtime(std::time(nullptr));
+        std::string token = fmt::format("{:04d}{:02d}{:02d}-{:02d}{:02d}{:02d}-{:06d}",
+            tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday,
+            tm.tm_hour, tm.tm_min, tm.tm_sec, seq);
+
+        return stem.string() + "." + token + ext.string();
+    }
+
+    bool rotating_archive_sink::is_rotated_name_of(const std::string& base_filename,
+        const std::string& path)
+    {
+        std::filesystem::path base(base_filename);
+        std::filesystem::path candidate(path);
+
+        if (base.parent_path().lexically_normal() != candidate.parent_path().lexically_normal()) {
+            return false;
+        }
+
+        const std::string base_name = base.filename().string();
+        std::string name = candidate.filename().string();
+        if (name == base_name) return false;
+
+        const std::string ext = base.extension().string();
+        std::string stem = base_name.substr(0, base_name.size() - ext.size());
+
+        if (j2::string::ends_with(name, ".gz")) {
+            name.resize(name.size() - 3);
+        }
+        if (!j2::string::ends_with(name, ext)) return false;
+        name.resize(name.size() - ext.size());
+
+        const std::string prefix = stem + ".";
+        if (name.compare(0, prefix.size(), prefix) != 0) return false;
+
+        return is_rotation_token(name.substr(prefix.size()));
+    }
+
+    void rotating_archive_sink::sink_it_(const spdlog::details::log_msg& msg) {
+        spdlog::memory_buf_t formatted;
+        formatter_->format(msg, formatted);
+
+        std::size_t new_size = current_size_ + formatted.size();
+        if (new_size > max_size_ && current_size_ > 0) {
+            file_helper_.flush();
+            rotate_();
+            new_size = formatted.size();
+        }
+        if (index_.isOpen()) {
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                msg.time.time_since_epoch()).count();
+            index_.add(static_cast<std::int64_t>(ns), msg.level,
+                write_offset_, formatted.size());
+        }
+        file_helper_.write(formatted);
+        current_size_ = new_size;
+        write_offset_ += formatted.size();
+    }
+
+    void rotating_archive_sink::flush_() {
+        file_helper_.flush();
+        index_.flush();
+    }
+
+    // 현재 파일을 닫고 고유한 이름으로 rename 한 뒤 새 파일을 연다.
+    // rename 실패 시(예: Windows 에서 다른 프로세스가 파일을 연 경우) 같은 파일에 이어 쓰고
+    // 다음 max_size 도달 시 다시 시도한다.
+    void rotating_archive_sink::rotate_() {
+        file_helper_.close();
+        index_.close();
+
+        std::string target = make_rotated_name(base_filename_, ++seq_);
+        std::error_code ec;
+        while (std::filesystem::exists(target, ec)) {
+            target = make_rotated_name(base_filename_, ++seq_);
+        }
+
+        std::filesystem::rename(base_filename_, target, ec);
+        if (ec) {
+            std::cerr << "[rotating_archive_sink] Failed to rename " << base_filename_
+                << " to " << target << ": " << ec.message() << "\n";
+            file_helper_.open(base_filename_, false);
+            current_size_ = 0;
+            write_offset_ = file_helper_.size();
+            if (index_interval_ > 0) {
+                index_.open(log_index_writer::index_path_of(base_filename_),
+                    index_interval_, write_offset_, false);
+            }
+            return;
+        }
+
+        file_helper_.open(base_filename_, true);
+        current_size_ = 0;
+        write_offset_ = 0;
+
+        if (index_interval_ > 0) {
+            // 인덱스를 보관 파일 이름으로 옮기고 새 인덱스 시작 (실패 시 잘못된 인덱스가 남지 않도록 삭제)
+            const std::string base_index = log_index_writer::index_path_of(base_filename_);
+            std::filesystem::rename(base_index, log_index_writer::index_path_of(target), ec);
+            if (ec) {
+                std::filesystem::remove(base_index, ec);
+            }
+            index_.open(base_index, index_interval_, 0, true);
+        }
+
+        if (hook_) {
+            hook_(target);
+        }
+    }
+
+} // namespace j2::log
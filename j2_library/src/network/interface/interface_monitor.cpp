@@ -0,0 +1,266 @@
+
+#include "j2_library/network/interface/interface_monitor.hpp"
+#include "j2_library/network/interface/network_interface.hpp"
+
+#include <cstring>
+
+#ifdef __linux__
+    #include <cerrno>
+    #include <linux/netlink.h>
+    #include <linux/rtnetlink.h>
+    #include <linux/if_link.h>
+    #include <net/if.h>
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+
+namespace j2 {
+    namespace network {
+        namespace interface {
+
+            namespace {
+
+                // 카운터가 줄어든 경우(인터페이스 재생성, 카운터 리셋)는 0 으로 처리
+                uint64_t delta(uint64_t now, uint64_t before) {
+                    return now >= before ? now - before : 0;
+                }
+
+                double per_sec(uint64_t now, uint64_t before, double seconds) {
+                    return seconds > 0 ? static_cast<double>(delta(now, before)) / seconds : 0.0;
+                }
+
+#ifdef __linux__
+                constexpr size_t NETLINK_BUFFER_SIZE = 64 * 1024;
+                constexpr int EVENT_POLL_MS = 100; // stop_link_events() 대기 상한
+
+                int open_netlink(uint32_t groups) {
+                    int fd = ::socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+                    if (fd < 0) return -1;
+                    sockaddr_nl local{};
+                    local.nl_family = AF_NETLINK;
+                    local.nl_groups = groups;
+                    if (::bind(fd, reinterpret_cast<sockaddr*>(&local), sizeof(local)) != 0) {
+                        ::close(fd);
+                        return -1;
+                    }
+                    return fd;
+                }
+
+                // RTM_NEWLINK / RTM_DELLINK 메시지 하나를 해석 (이름, 플래그, 카운터)
+                void parse_link(const nlmsghdr* nh, InterfaceSample& out) {
+                    const auto* ifi = static_cast<const ifinfomsg*>(NLMSG_DATA(nh));
+                    out.index = ifi->ifi_index;
+                    out.is_up = (ifi->ifi_flags & IFF_UP) != 0;
+                    out.is_running = (ifi->ifi_flags & IFF_RUNNING) != 0;
+
+                    bool have_stats64 = false;
+                    int len = static_cast<int>(nh->nlmsg_len) - static_cast<int>(NLMSG_LENGTH(sizeof(ifinfomsg)));
+                    const auto* rta = reinterpret_cast<const rtattr*>(
+                        reinterpret_cast<const char*>(ifi) + NLMSG_ALIGN(sizeof(ifinfomsg)));
+                    for (; RTA_OK(rta, len); rta = RTA_NEXT(rta, len)) {
+                        const size_t payload = RTA_PAYLOAD(rta);
+                        switch (rta->rta_type) {
+                        case IFLA_IFNAME:
+                            out.name.assign(static_cast<const char*>(RTA_DATA(rta)),
+                                strnlen(static_cast<const char*>(RTA_DATA(rta)), payload));
+                            break;
+                        case IFLA_STATS64:
+                            if (payload >= sizeof(rtnl_link_stats64)) {
+                                rtnl_link_stats64 s;
+                                std::memcpy(&s, RTA_DATA(rta), sizeof(s));
+                                out.counters = { s.rx_bytes, s.tx_bytes, s.rx_packets, s.tx_packets,
+                                                 s.rx_errors, s.tx_errors, s.rx_dropped, s.tx_dropped };
+                                have_stats64 = true;
+                            }
+                            break;
+                        case IFLA_STATS:
+                            // 32비트 카운터는 STATS64 가 없는 오래된 커널용
+                            if (!have_stats64 && payload >= sizeof(rtnl_link_stats)) {
+                                rtnl_link_stats s;
+                                std::memcpy(&s, RTA_DATA(rta), sizeof(s));
+                                out.counters = { s.rx_bytes, s.tx_bytes, s.rx_packets, s.tx_packets,
+                                                 s.rx_errors, s.tx_errors, s.rx_dropped, s.tx_dropped };
+                            }
+                            break;
+                        default:
+                            break;
+                        }
+                    }
+                }
+#endif
+
+            } // namespace
+
+            InterfaceMonitor::~InterfaceMonitor() {
+                stop_link_events();
+#ifdef __linux__
+                if (dump_fd >= 0) ::close(dump_fd);
+#endif
+            }
+
+            std::vector<InterfaceSample> InterfaceMonitor::sample() {
+                std::lock_guard<std::mutex> lock(sample_mutex);
+                std::vector<InterfaceSample> result;
+
+#ifdef __linux__
+                if (dump_fd < 0) {
+                    dump_fd = open_netlink(0);
+                    if (dump_fd < 0) return result;
+                    dump_buffer.resize(NETLINK_BUFFER_SIZE);
+                }
+
+                struct {
+                    nlmsghdr nh;
+                    ifinfomsg ifi;
+                } request{};
+                request.nh.nlmsg_len = NLMSG_LENGTH(sizeof(ifinfomsg));
+                request.nh.nlmsg_type = RTM_GETLINK;
+                request.nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+                request.nh.nlmsg_seq = ++dump_seq;
+                request.ifi.ifi_family = AF_UNSPEC;
+
+                sockaddr_nl kernel{};
+                kernel.nl_family = AF_NETLINK;
+                if (::sendto(dump_fd, &request, request.nh.nlmsg_len, 0,
+                    reinterpret_cast<sockaddr*>(&kernel), sizeof(kernel)) < 0) {
+                    ::close(dump_fd);
+                    dump_fd = -1;
+                    return result;
+                }
+
+                bool done = false;
+                while (!done) {
+                    const ssize_t n = ::recv(dump_fd, dump_buffer.data(), dump_buffer.size(), 0);
+                    if (n < 0) {
+                        if (errno == EINTR) continue;
+                        ::close(dump_fd); // 다음 호출에서 새 소켓으로 다시 시도
+                        dump_fd = -1;
+                        return {};
+                    }
+                    int len = static_cast<int>(n);
+                    for (auto* nh = reinterpret_cast<nlmsghdr*>(dump_buffer.data()); NLMSG_OK(nh, len); nh = NLMSG_NEXT(nh, len)) {
+                        if (nh->nlmsg_seq != dump_seq) continue; // 이전 요청의 남은 응답
+                        if (nh->nlmsg_type == NLMSG_DONE) {
+                            done = true;
+                            break;
+                        }
+                        if (nh->nlmsg_type == NLMSG_ERROR) {
+                            return {};
+                        }
+                        if (nh->nlmsg_type == RTM_NEWLINK) {
+                            InterfaceSample s;
+                            parse_link(nh, s);
+                            result.push_back(std::move(s));
+                        }
+                    }
+                }
+#else
+                for (const auto& info : InterfaceManager::get_interfaces()) {
+                    InterfaceSample s;
+                    s.name = info.name;
+                    s.is_up = info.is_running;
+                    s.is_running = info.is_running;
+                    s.counters.rx_bytes = info.stats.rx_bytes;
+                    s.counters.tx_bytes = info.stats.tx_bytes;
+                    result.push_back(std::move(s));
+                }
+#endif
+
+                // 직전 샘플과 비교해 속도/증가량 계산
+                const auto now = std::chrono::steady_clock::now();
+                std::unordered_map<std::string, previous> current;
+                for (auto& s : result) {
+                    auto it = previous_samples.find(s.name);
+                    if (it != previous_samples.end()) {
+                        const auto& before = it->second.counters;
+                        const double seconds = std::chrono::duration<double>(now - it->second.time).count();
+                        s.rates.rx_bytes_per_sec = per_sec(s.counters.rx_bytes, before.rx_bytes, seconds);
+                        s.rates.tx_bytes_per_sec = per_sec(s.counters.tx_bytes, before.tx_bytes, seconds);
+                        s.rates.rx_packets_per_sec = per_sec(s.counters.rx_packets, before.rx_packets, seconds);
+                        s.rates.tx_packets_per_sec = per_sec(s.counters.tx_packets, before.tx_packets, seconds);
+                        s.rates.rx_errors = delta(s.counters.rx_errors, before.rx_errors);
+                        s.rates.tx_errors = delta(s.counters.tx_errors, before.tx_errors);
+                        s.rates.rx_dropped = delta(s.counters.rx_dropped, before.rx_dropped);
+                        s.rates.tx_dropped = delta(s.counters.tx_dropped, before.tx_dropped);
+                    }
+                    current[s.name] = previous{ s.counters, now };
+                }
+                previous_samples = std::move(current); // 사라진 인터페이스는 제거
+                return result;
+            }
+
+#ifdef __linux__
+            bool InterfaceMonitor::start_link_events(LinkCallback cb) {
+                if (events_running) return false;
+                const int fd = open_netlink(RTMGRP_LINK);
+                if (fd < 0) return false;
+
+                // 구독 시작 시점의 상태를 기준으로 변화만 알림
+                std::unordered_map<int, LinkEvent> known;
+                for (const auto& s : sample()) {
+                    known[s.index] = LinkEvent{ s.index, s.name, s.is_up, s.is_running, false };
+                }
+
+                on_link = std::move(cb);
+                events_running = true;
+                event_thread = std::thread(&InterfaceMonitor::link_event_loop, this, fd, std::move(known));
+                return true;
+            }
+
+            void InterfaceMonitor::stop_link_events() {
+                if (!events_running.exchange(false)) return;
+                if (event_thread.joinable()) event_thread.join();
+            }
+
+            void InterfaceMonitor::link_event_loop(int fd, std::unordered_map<int, LinkEvent> known) {
+                std::vector<char> buffer(NETLINK_BUFFER_SIZE);
+                while (events_running) {
+                    pollfd pfd{ fd, POLLIN, 0 };
+                    const int ready = ::poll(&pfd, 1, EVENT_POLL_MS);
+                    if (ready <= 0) continue;
+
+                    const ssize_t n = ::recv(fd, buffer.data(), buffer.size(), 0);
+                    if (n < 0) {
+                        // ENOBUFS: 이벤트 유실. 다음 메시지부터 계속 (상태 비교는 known 기준)
+                        continue;
+                    }
+                    int len = static_cast<int>(n);
+                    for (auto* nh = reinterpret_cast<nlmsghdr*>(buffer.data()); NLMSG_OK(nh, len); nh = NLMSG_NEXT(nh, len)) {
+                        if (nh->nlmsg_type != RTM_NEWLINK && nh->nlmsg_type != RTM_DELLINK) continue;
+
+                        InterfaceSample s;
+                        parse_link(nh, s);
+                        LinkEvent ev{ s.index, s.name, s.is_up, s.is_running, nh->nlmsg_type == RTM_DELLINK };
+
+                        auto it = known.find(ev.index);
+                        if (ev.removed) {
+                            if (it == known.end()) continue;
+                            if (ev.name.empty()) ev.name = it->second.name;
+                            known.erase(it);
+                        }
+                        else if (it != known.end() && it->second.is_up == ev.is_up &&
+                            it->second.is_running == ev.is_running && it->second.name == ev.name) {
+                            continue; // 카운터/속성만 바뀐 RTM_NEWLINK
+                        }
+                        else {
+                            known[ev.index] = ev;
+                        }
+                        if (on_link) on_link(ev);
+                    }
+                }
+                ::close(fd);
+            }
+#else
+            bool InterfaceMonitor::start_link_events(LinkCallback) {
+                return false;
+            }
+
+            void InterfaceMonitor::stop_link_events() {}
+
+            void InterfaceMonitor::link_event_loop(int, std::unordered_map<int, LinkEvent>) {}
+#endif
+
+        } // namespace interface
+    } // namespace network
+} // namespace j2
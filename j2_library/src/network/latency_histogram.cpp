@@ -0,0 +1,128 @@
+#include "j2_library/network/latency_histogram.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace j2::network {
+
+namespace {
+
+int highest_bit(std::uint64_t v) {
+    int bit = 0;
+    while (v >>= 1) {
+        ++bit;
+    }
+    return bit;
+}
+
+std::string format_ns(std::uint64_t ns) {
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(1);
+    if (ns < 1000) {
+        os << ns << "ns";
+    } else if (ns < 1000000) {
+        os << static_cast<double>(ns) / 1e3 << "us";
+    } else if (ns < 1000000000) {
+        os << static_cast<double>(ns) / 1e6 << "ms";
+    } else {
+        os << static_cast<double>(ns) / 1e9 << "s";
+    }
+    return os.str();
+}
+
+} // namespace
+
+// Values below SUB_BUCKETS get a bucket each; above that, bucket = (log2 band, top 3 bits below
+// the leading one)
+std::size_t latency_histogram::bucket_of(std::uint64_t ns) {
+    if (ns < SUB_BUCKETS) {
+        return static_cast<std::size_t>(ns);
+    }
+    const int msb = highest_bit(ns);
+    const std::size_t index = static_cast<std::size_t>(msb - 2) * SUB_BUCKETS + ((ns >> (msb - 3)) & (SUB_BUCKETS - 1));
+    return std::min(index, BUCKET_COUNT - 1);
+}
+
+std::uint64_t latency_histogram::bucket_floor(std::size_t index) {
+    if (index < SUB_BUCKETS) {
+        return index;
+    }
+    const int msb = static_cast<int>(index / SUB_BUCKETS) + 2;
+    const std::uint64_t sub = index % SUB_BUCKETS;
+    return (std::uint64_t{ 1 } << msb) | (sub << (msb - 3));
+}
+
+void latency_histogram::record(std::uint64_t ns) {
+    buckets[bucket_of(ns)].fetch_add(1, std::memory_order_relaxed);
+    total.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(ns, std::memory_order_relaxed);
+
+    std::uint64_t cur = lowest.load(std::memory_order_relaxed);
+    while (ns < cur && !lowest.compare_exchange_weak(cur, ns, std::memory_order_relaxed)) {
+    }
+    cur = highest.load(std::memory_order_relaxed);
+    while (ns > cur && !highest.compare_exchange_weak(cur, ns, std::memory_order_relaxed)) {
+    }
+}
+
+void latency_histogram::reset() {
+    for (auto& b : buckets) {
+        b.store(0, std::memory_order_relaxed);
+    }
+    total.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    lowest.store(UINT64_MAX, std::memory_order_relaxed);
+    highest.store(0, std::memory_order_relaxed);
+}
+
+std::uint64_t latency_histogram::count() const {
+    return total.load(std::memory_order_relaxed);
+}
+
+std::uint64_t latency_histogram::min() const {
+    const std::uint64_t v = lowest.load(std::memory_order_relaxed);
+    return v == UINT64_MAX ? 0 : v;
+}
+
+std::uint64_t latency_histogram::max() const {
+    return highest.load(std::memory_order_relaxed);
+}
+
+double latency_histogram::mean() const {
+    const std::uint64_t n = count();
+    return n == 0 ? 0.0 : static_cast<double>(sum.load(std::memory_order_relaxed)) / static_cast<double>(n);
+}
+
+std::uint64_t latency_histogram::percentile(double p) const {
+    std::uint64_t n = 0;
+    for (const auto& b : buckets) {
+        n += b.load(std::memory_order_relaxed);
+    }
+    if (n == 0) {
+        return 0;
+    }
+    p = std::clamp(p, 0.0, 1.0);
+    const std::uint64_t rank = static_cast<std::uint64_t>(p * static_cast<double>(n - 1)) + 1;
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            return std::max(bucket_floor(i), min());
+        }
+    }
+    return max();
+}
+
+std::string latency_histogram::to_string() const {
+    std::ostringstream os;
+    os << "count=" << count()
+       << " mean=" << format_ns(static_cast<std::uint64_t>(mean()))
+       << " p50=" << format_ns(percentile(0.50))
+       << " p99=" << format_ns(percentile(0.99))
+       << " p99.9=" << format_ns(percentile(0.999))
+       << " max=" << format_ns(max());
+    return os.str();
+}
+
+} // namespace j2::network
@@ -0,0 +1,441 @@
+
+#include <sstream>
+#include <algorithm>
+#include <cctype>
+#include <vector>
+
+#include "j2_library/network/rest/curl_async_client.hpp"
+
+namespace {
+    std::once_flag g_curl_global_init_flag;
+
+#if LIBCURL_VERSION_NUM >= 0x074400
+    constexpr int POLL_TIMEOUT_MS = 1000; // 새 요청/종료는 curl_multi_wakeup 으로 즉시 깨움
+#else
+    constexpr int POLL_TIMEOUT_MS = 10;   // curl_multi_wakeup 이 없는 libcurl(< 7.68): 짧게 대기하며 대기열 확인
+#endif
+
+    // "scheme://host:port/path?query" -> "host:port" (호스트별 동시 요청 상한의 키)
+    std::string host_key(const std::string& url)
+    {
+        std::size_t begin = url.find("://");
+        begin = (begin == std::string::npos) ? 0 : begin + 3;
+        const std::size_t end = url.find_first_of("/?#", begin);
+        return url.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+    }
+
+    template <class Status>
+    Status to_http_status(long code)
+    {
+        switch (code) {
+        case 200: case 201: case 204:
+        case 400: case 401: case 403: case 404:
+        case 500: case 502: case 503:
+            return static_cast<Status>(code);
+        default:
+            return Status::unknown;
+        }
+    }
+}
+
+namespace j2::network::rest {
+
+// 요청 하나: 제출 시점의 설정 사본 + 진행 중 상태
+struct curl_async_client::job
+{
+    bool is_post = false;
+    std::string url;
+    query_params params;
+    std::string post_body;
+    std::string host;
+
+    headers request_headers;
+    long timeout_ms = 0;
+    bool ignore_ssl_errors = false;
+    rest_session* session = nullptr;
+
+    get_callback on_get;
+    post_callback on_post;
+
+    bool admitted = false;           // 대기열에서 나와 동시 요청 수에 포함됨
+    rest_session::easy_handle lease; // 세션 사용 시
+    CURL* own = nullptr;             // 세션 미사용 시
+    CURL* curl = nullptr;
+    curl_slist* header_list = nullptr;
+
+    std::string body;
+    get_response received; // 헤더/Content-Type 수집용
+
+    ~job()
+    {
+        if (header_list) curl_slist_free_all(header_list);
+        if (own) curl_easy_cleanup(own);
+    }
+};
+
+size_t curl_async_client::write_callback(char* ptr, size_t size, size_t nmemb, void* userdata)
+{
+    size_t real_size = size * nmemb;
+    auto* body = static_cast<std::string*>(userdata);
+    body->append(ptr, real_size);
+    return real_size;
+}
+
+size_t curl_async_client::header_callback(char* buffer, size_t size, size_t nitems, void* userdata)
+{
+    size_t real_size = size * nitems;
+    auto* resp = static_cast<get_response*>(userdata);
+    std::string header_line(buffer, real_size);
+
+    // Remove trailing CRLF
+    while (!header_line.empty() && (header_line.back() == '\r' || header_line.back() == '\n'))
+        header_line.pop_back();
+
+    // Store only headers in "Key: Value" format
+    if (!header_line.empty() && header_line.find(':') != std::string::npos) {
+        resp->headers.push_back(header_line);
+
+        const std::string key = "Content-Type:";
+        if (header_line.size() > key.size() &&
+            std::equal(key.begin(), key.end(), header_line.begin(),
+                [](char a, char b) { return std::tolower(a) == std::tolower(b); })) {
+            std::string value = header_line.substr(key.size());
+            value.erase(0, value.find_first_not_of(" \t"));
+            resp->content_type = value;
+        }
+    }
+    return real_size;
+}
+
+curl_async_client::curl_async_client()
+{
+    std::call_once(g_curl_global_init_flag, []() {
+        CURLcode code = curl_global_init(CURL_GLOBAL_DEFAULT);
+        if (code != CURLE_OK) {
+            throw std::runtime_error("curl_global_init failed");
+        }
+        });
+
+    multi_ = curl_multi_init();
+    if (!multi_) {
+        throw std::runtime_error("curl_multi_init failed");
+    }
+    loop_thread_ = std::thread(&curl_async_client::event_loop, this);
+}
+
+curl_async_client::~curl_async_client()
+{
+    running_ = false;
+    wakeup();
+    if (loop_thread_.joinable())
+        loop_thread_.join();
+    curl_multi_cleanup(multi_);
+    multi_ = nullptr;
+}
+
+void curl_async_client::set_headers(const headers& new_headers)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    headers_ = new_headers;
+}
+
+void curl_async_client::set_timeout_ms(long timeout_ms)
+{
+    if (timeout_ms <= 0) throw std::invalid_argument("timeoutMs must be greater than 0.");
+    std::lock_guard<std::mutex> lock(mutex_);
+    timeout_ms_ = timeout_ms;
+}
+
+void curl_async_client::set_ignore_ssl_errors(bool ignore)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ignore_ssl_errors_ = ignore;
+}
+
+void curl_async_client::set_max_concurrency(std::size_t total, std::size_t per_host)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        max_total_ = total;
+        max_per_host_ = per_host;
+    }
+    wakeup(); // 상한이 늘었으면 대기 중인 요청 시작
+}
+
+void curl_async_client::set_session(rest_session* session)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    session_ = session;
+}
+
+std::future<curl_async_client::get_response>
+    curl_async_client::get_async(const std::string& url, const query_params& params)
+{
+    auto promise = std::make_shared<std::promise<get_response>>();
+    auto future = promise->get_future();
+    get_async(url, params, [promise](get_response resp) { promise->set_value(std::move(resp)); });
+    return future;
+}
+
+void curl_async_client::get_async(const std::string& url, const query_params& params, get_callback cb)
+{
+    auto j = std::make_unique<job>();
+    j->url = url;
+    j->params = params;
+    j->on_get = std::move(cb);
+    submit(std::move(j));
+}
+
+std::future<curl_async_client::post_response>
+    curl_async_client::post_async(const std::string& url, const std::string& body)
+{
+    auto promise = std::make_shared<std::promise<post_response>>();
+    auto future = promise->get_future();
+    post_async(url, body, [promise](post_response resp) { promise->set_value(std::move(resp)); });
+    return future;
+}
+
+void curl_async_client::post_async(const std::string& url, const std::string& body, post_callback cb)
+{
+    auto j = std::make_unique<job>();
+    j->is_post = true;
+    j->url = url;
+    j->post_body = body;
+    j->on_post = std::move(cb);
+    submit(std::move(j));
+}
+
+std::size_t curl_async_client::pending() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size() + in_flight_;
+}
+
+void curl_async_client::submit(std::unique_ptr<job> j)
+{
+    if (j->url.empty()) throw std::invalid_argument("url is empty.");
+    j->host = host_key(j->url);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        j->request_headers = headers_;
+        j->timeout_ms = timeout_ms_;
+        j->ignore_ssl_errors = ignore_ssl_errors_;
+        j->session = session_;
+        queue_.push_back(std::move(j));
+    }
+    wakeup();
+}
+
+void curl_async_client::wakeup()
+{
+#if LIBCURL_VERSION_NUM >= 0x074400 // 7.68.0
+    if (multi_) curl_multi_wakeup(multi_);
+#endif
+}
+
+void curl_async_client::admit_pending()
+{
+    // 상한 안에서 대기열 앞쪽부터 시작 (상한에 걸린 호스트의 요청은 건너뛰고 순서 유지)
+    std::vector<std::unique_ptr<job>> admitted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto it = queue_.begin(); it != queue_.end();) {
+            if (max_total_ != 0 && in_flight_ >= max_total_) break;
+            std::size_t& host_count = per_host_[(*it)->host];
+            if (max_per_host_ != 0 && host_count >= max_per_host_) {
+                ++it;
+                continue;
+            }
+            ++host_count;
+            ++in_flight_;
+            (*it)->admitted = true;
+            admitted.push_back(std::move(*it));
+            it = queue_.erase(it);
+        }
+    }
+
+    for (auto& j : admitted) {
+        if (start_job(*j)) {
+            CURL* curl = j->curl;
+            active_.emplace(curl, std::move(j));
+            continue;
+        }
+        complete(*j, CURLE_FAILED_INIT, "failed to start request");
+    }
+}
+
+bool curl_async_client::start_job(job& j)
+{
+    try {
+        if (j.session) {
+            j.lease = j.session->acquire();
+            j.curl = j.lease.get();
+        }
+        else {
+            j.own = curl_easy_init();
+            j.curl = j.own;
+        }
+    }
+    catch (...) {
+        return false;
+    }
+    if (!j.curl) return false;
+    CURL* curl = j.curl;
+
+    std::string url = j.url;
+    if (!j.params.empty()) {
+        std::ostringstream oss;
+        oss << url << (url.find('?') == std::string::npos ? "?" : "&");
+        bool first = true;
+        for (const auto& kv : j.params) {
+            char* k = curl_easy_escape(curl, kv.first.c_str(), static_cast<int>(kv.first.size()));
+            char* v = curl_easy_escape(curl, kv.second.c_str(), static_cast<int>(kv.second.size()));
+            if (!k || !v) {
+                if (k) curl_free(k);
+                if (v) curl_free(v);
+                return false;
+            }
+            if (!first) oss << "&";
+            first = false;
+            oss << k << "=" << v;
+            curl_free(k);
+            curl_free(v);
+        }
+        url = oss.str();
+    }
+
+    for (const auto& kv : j.request_headers) {
+        if (!kv.first.empty())
+            j.header_list = curl_slist_append(j.header_list, (kv.first + ": " + kv.second).c_str());
+    }
+
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str()); // libcurl 이 문자열을 복사
+    if (j.is_post) {
+        curl_easy_setopt(curl, CURLOPT_POST, 1L);
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDS, j.post_body.c_str());
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, static_cast<long>(j.post_body.size()));
+    }
+    else {
+        curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
+    }
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, j.timeout_ms);
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &j.body);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, header_callback);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &j.received);
+
+    if (j.header_list)
+        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, j.header_list);
+
+    if (j.ignore_ssl_errors) {
+        curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
+        curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
+    }
+    else {
+        curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
+        curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 2L);
+    }
+
+    return curl_multi_add_handle(multi_, curl) == CURLM_OK;
+}
+
+void curl_async_client::finish_job(CURL* curl, CURLcode code)
+{
+    auto it = active_.find(curl);
+    if (it == active_.end()) return;
+    std::unique_ptr<job> j = std::move(it->second);
+    active_.erase(it);
+    curl_multi_remove_handle(multi_, curl);
+    complete(*j, code, code == CURLE_OK ? std::string() : curl_easy_strerror(code));
+}
+
+void curl_async_client::complete(job& j, CURLcode code, const std::string& error)
+{
+    long http_code = 0;
+    if (code == CURLE_OK && j.curl)
+        curl_easy_getinfo(j.curl, CURLINFO_RESPONSE_CODE, &http_code);
+
+    if (j.admitted) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --in_flight_;
+        auto host = per_host_.find(j.host);
+        if (host != per_host_.end() && --host->second == 0)
+            per_host_.erase(host);
+    }
+
+    auto fill = [&](auto& resp) {
+        using status_type = decltype(resp.status);
+        resp.headers = std::move(j.received.headers);
+        resp.content_type = std::move(j.received.content_type);
+        if (!error.empty()) {
+            resp.error = error;
+            resp.curl_error_code = static_cast<int>(code);
+            return;
+        }
+        resp.raw_status_code = http_code;
+        resp.status = to_http_status<status_type>(http_code);
+        resp.body = std::move(j.body);
+    };
+
+    // 콜백 예외가 이벤트 루프를 멈추지 않도록 차단
+    try {
+        if (j.is_post) {
+            post_response resp;
+            fill(resp);
+            if (j.on_post) j.on_post(std::move(resp));
+        }
+        else {
+            get_response resp;
+            fill(resp);
+            if (j.on_get) j.on_get(std::move(resp));
+        }
+    }
+    catch (...) {
+    }
+}
+
+void curl_async_client::event_loop()
+{
+    while (running_) {
+        admit_pending();
+
+        int still_running = 0;
+        curl_multi_perform(multi_, &still_running);
+
+        bool finished = false;
+        int left = 0;
+        while (CURLMsg* msg = curl_multi_info_read(multi_, &left)) {
+            if (msg->msg == CURLMSG_DONE) {
+                finish_job(msg->easy_handle, msg->data.result);
+                finished = true;
+            }
+        }
+        if (finished) continue; // 빈 자리에 대기 중인 요청을 바로 시작
+
+#if LIBCURL_VERSION_NUM >= 0x074400 // 7.68.0: curl_multi_wakeup 으로 깨울 수 있음
+        curl_multi_poll(multi_, nullptr, 0, POLL_TIMEOUT_MS, nullptr);
+#else
+        curl_multi_wait(multi_, nullptr, 0, POLL_TIMEOUT_MS, nullptr);
+#endif
+    }
+
+    // 종료: 진행 중/대기 중 요청을 취소 응답으로 완료
+    for (auto& entry : active_) {
+        curl_multi_remove_handle(multi_, entry.first);
+        complete(*entry.second, CURLE_ABORTED_BY_CALLBACK, "request cancelled");
+    }
+    active_.clear();
+
+    std::deque<std::unique_ptr<job>> queued;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queued.swap(queue_);
+    }
+    for (auto& j : queued)
+        complete(*j, CURLE_ABORTED_BY_CALLBACK, "request cancelled");
+}
+
+} // namespace j2::network::rest
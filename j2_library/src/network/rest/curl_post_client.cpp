@@ -107,6 +107,11 @@ void curl_post_client::set_ignore_ssl_errors(bool ignore)
     ignore_ssl_errors_ = ignore;
 }
 
+void curl_post_client::set_session(rest_session* session)
+{
+    session_ = session;
+}
+
 std::vector<std::string> curl_post_client::build_header_lines(const headers& headers)
 {
     std::vector<std::string> lines;
@@ -205,36 +210,45 @@ curl_post_client::response curl_post_client::post(const std::string& body_str)
     for (const auto& line : header_lines)
         header_list = curl_slist_append(header_list, line.c_str());
 
-    curl_easy_reset(curl_);
+    // 세션이 연결되어 있으면 풀의 핸들(공유 연결/DNS/TLS 세션)을, 아니면 자체 핸들을 사용
+    rest_session::easy_handle lease;
+    CURL* curl = curl_;
+    if (session_) {
+        lease = session_->acquire();
+        curl = lease.get();
+    }
+    else {
+        curl_easy_reset(curl_);
+    }
 
-    curl_easy_setopt(curl_, CURLOPT_URL, url.c_str());
-    curl_easy_setopt(curl_, CURLOPT_POST, 1L);
-    curl_easy_setopt(curl_, CURLOPT_TIMEOUT_MS, timeout_ms_);
-    curl_easy_setopt(curl_, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_POST, 1L);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, timeout_ms_);
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
 
-    curl_easy_setopt(curl_, CURLOPT_WRITEFUNCTION, write_callback);
-    curl_easy_setopt(curl_, CURLOPT_WRITEDATA, &body);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &body);
 
-    curl_easy_setopt(curl_, CURLOPT_HEADERFUNCTION, header_callback);
-    curl_easy_setopt(curl_, CURLOPT_HEADERDATA, &resp);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, header_callback);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &resp);
 
     if (header_list)
-        curl_easy_setopt(curl_, CURLOPT_HTTPHEADER, header_list);
+        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, header_list);
 
     // Set the body to be sent (JSON, XML, TEXT, etc.)
-    curl_easy_setopt(curl_, CURLOPT_POSTFIELDS, body_str.c_str());
-    curl_easy_setopt(curl_, CURLOPT_POSTFIELDSIZE, static_cast<long>(body_str.size()));
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, body_str.c_str());
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, static_cast<long>(body_str.size()));
 
     if (ignore_ssl_errors_) {
-        curl_easy_setopt(curl_, CURLOPT_SSL_VERIFYPEER, 0L);
-        curl_easy_setopt(curl_, CURLOPT_SSL_VERIFYHOST, 0L);
+        curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
+        curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
     }
     else {
-        curl_easy_setopt(curl_, CURLOPT_SSL_VERIFYPEER, 1L);
-        curl_easy_setopt(curl_, CURLOPT_SSL_VERIFYHOST, 2L);
+        curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
+        curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 2L);
     }
 
-    CURLcode code = curl_easy_perform(curl_);
+    CURLcode code = curl_easy_perform(curl);
 
     if (header_list) curl_slist_free_all(header_list);
 
@@ -245,7 +259,7 @@ curl_post_client::response curl_post_client::post(const std::string& body_str)
     }
 
     long http_code = 0;
-    curl_easy_getinfo(curl_, CURLINFO_RESPONSE_CODE, &http_code);
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
 
     resp.raw_status_code = http_code;
     resp.status = to_http_status(http_code);
@@ -0,0 +1,151 @@
+
+#include <stdexcept>
+
+#include "j2_library/network/rest/rest_session.hpp"
+
+namespace {
+    std::once_flag g_curl_global_init_flag;
+}
+
+namespace j2::network::rest {
+
+rest_session::easy_handle::~easy_handle()
+{
+    if (session_ && curl_)
+        session_->release(curl_);
+}
+
+rest_session::easy_handle::easy_handle(easy_handle&& other) noexcept
+    : session_(other.session_), curl_(other.curl_)
+{
+    other.session_ = nullptr;
+    other.curl_ = nullptr;
+}
+
+rest_session::easy_handle& rest_session::easy_handle::operator=(easy_handle&& other) noexcept
+{
+    if (this != &other) {
+        if (session_ && curl_)
+            session_->release(curl_);
+        session_ = other.session_;
+        curl_ = other.curl_;
+        other.session_ = nullptr;
+        other.curl_ = nullptr;
+    }
+    return *this;
+}
+
+rest_session::rest_session(std::size_t max_idle_handles)
+    : max_idle_(max_idle_handles)
+{
+    std::call_once(g_curl_global_init_flag, []() {
+        CURLcode code = curl_global_init(CURL_GLOBAL_DEFAULT);
+        if (code != CURLE_OK) {
+            throw std::runtime_error("curl_global_init failed");
+        }
+        });
+
+    share_ = curl_share_init();
+    if (!share_) {
+        throw std::runtime_error("curl_share_init failed");
+    }
+    curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, lock_callback);
+    curl_share_setopt(share_, CURLSHOPT_UNLOCKFUNC, unlock_callback);
+    curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    // CURL_LOCK_DATA_CONNECT 는 스레드 간 공유가 안전하지 않으므로 제외 (연결은 풀의 핸들별로 유지)
+}
+
+rest_session::~rest_session()
+{
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        for (CURL* curl : idle_)
+            curl_easy_cleanup(curl);
+        idle_.clear();
+    }
+    if (share_) {
+        curl_share_cleanup(share_);
+        share_ = nullptr;
+    }
+}
+
+rest_session& rest_session::instance()
+{
+    static rest_session session;
+    return session;
+}
+
+rest_session::easy_handle rest_session::acquire()
+{
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        if (!idle_.empty()) {
+            CURL* curl = idle_.back();
+            idle_.pop_back();
+            return easy_handle(this, curl);
+        }
+        ++created_;
+    }
+
+    CURL* curl = curl_easy_init();
+    if (!curl) {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        --created_;
+        throw std::runtime_error("curl_easy_init failed");
+    }
+    curl_easy_setopt(curl, CURLOPT_SHARE, share_);
+    return easy_handle(this, curl);
+}
+
+void rest_session::release(CURL* curl) noexcept
+{
+    // reset 은 옵션만 초기화하고 연결, 세션 ID/DNS 캐시, 공유 핸들 설정은 유지합니다.
+    curl_easy_reset(curl);
+    curl_easy_setopt(curl, CURLOPT_SHARE, share_);
+
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    if (idle_.size() < max_idle_) {
+        idle_.push_back(curl);
+        return;
+    }
+    curl_easy_cleanup(curl);
+}
+
+void rest_session::set_max_idle_handles(std::size_t count)
+{
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    max_idle_ = count;
+    while (idle_.size() > max_idle_) {
+        curl_easy_cleanup(idle_.back());
+        idle_.pop_back();
+    }
+}
+
+std::size_t rest_session::idle_handles() const
+{
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    return idle_.size();
+}
+
+std::size_t rest_session::created_handles() const
+{
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    return created_;
+}
+
+void rest_session::lock_callback(CURL*, curl_lock_data data, curl_lock_access, void* userptr)
+{
+    auto* self = static_cast<rest_session*>(userptr);
+    self->share_locks_[data].lock();
+}
+
+void rest_session::unlock_callback(CURL*, curl_lock_data data, void* userptr)
+{
+    auto* self = static_cast<rest_session*>(userptr);
+    self->share_locks_[data].unlock();
+}
+
+} // namespace j2::network::rest
@@ -0,0 +1,78 @@
+#include "j2_library/network/shm/shm_publisher.hpp"
+
+#include <cstring>
+#include <iostream>
+
+namespace j2::network::shm {
+
+shm_publisher::~shm_publisher() {
+    stop();
+}
+
+bool shm_publisher::create(const std::string& name, std::size_t capacity, bool unlink_on_stop_, unsigned mode) {
+    stop(); // a previous segment of this publisher (its name is released per unlink_on_stop)
+    std::lock_guard<std::mutex> lock(send_mutex);
+    unlink_on_stop = unlink_on_stop_;
+    next_seq = 0;
+    return segment.create(name, capacity, mode);
+}
+
+ssize_t shm_publisher::send_data(const void* data, std::size_t size) {
+    std::lock_guard<std::mutex> lock(send_mutex);
+    if (!segment.is_open()) {
+        std::cerr << "Publisher not created" << std::endl;
+        return -1;
+    }
+    if (size > segment.max_message_size()) {
+        std::cerr << "Message too large for shared-memory ring" << std::endl;
+        return -1;
+    }
+
+    ring_header* h = segment.header();
+    std::byte* ring = segment.data();
+    const std::uint64_t cap = h->capacity;
+    const std::uint64_t pos = h->write_pos.load(std::memory_order_relaxed);   // only we write it
+    const std::uint64_t off = pos & (cap - 1);
+    const std::uint64_t span = record_span(size);
+    const std::uint64_t tail = cap - off;
+    const bool wrap = tail < span;
+    const std::uint64_t end = pos + (wrap ? tail : 0) + span;
+
+    // Announce the bytes about to be overwritten before touching them
+    h->reserve_pos.store(end, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const std::uint64_t seq = next_seq++;
+    std::uint64_t at = off;
+    if (wrap) {
+        const record_header marker{ seq, 0, WRAP_RECORD };
+        std::memcpy(ring + off, &marker, sizeof(marker));
+        at = 0;
+    }
+    const record_header rec{ seq, static_cast<std::uint32_t>(size), 0 };
+    std::memcpy(ring + at, &rec, sizeof(rec));
+    if (size > 0) {
+        std::memcpy(ring + at + sizeof(rec), data, size);
+    }
+
+    h->write_pos.store(end, std::memory_order_release);
+    segment.notify_all();
+    return static_cast<ssize_t>(size);
+}
+
+ssize_t shm_publisher::send_data(const std::string& data) {
+    return send_data(data.data(), data.size());
+}
+
+void shm_publisher::stop() {
+    std::lock_guard<std::mutex> lock(send_mutex);
+    if (!segment.is_open()) {
+        return;
+    }
+    if (unlink_on_stop) {
+        segment.unlink();
+    }
+    segment.close();
+}
+
+} // namespace j2::network::shm
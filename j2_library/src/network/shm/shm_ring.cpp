@@ -0,0 +1,191 @@
+#include "j2_library/network/shm/shm_ring.hpp"
+
+#include <iostream>
+#include <new>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace j2::network::shm {
+
+namespace {
+
+constexpr std::size_t MIN_CAPACITY = 4096;
+constexpr std::size_t HEADER_SIZE = (sizeof(ring_header) + 63) & ~std::size_t{ 63 };
+
+std::string shm_name(const std::string& name) {
+    return (!name.empty() && name[0] == '/') ? name : "/" + name;
+}
+
+std::size_t round_capacity(std::size_t capacity) {
+    std::size_t c = MIN_CAPACITY;
+    while (c < capacity) {
+        c <<= 1;
+    }
+    return c;
+}
+
+#ifdef __linux__
+long futex(std::atomic<std::uint32_t>* word, int op, std::uint32_t val, const timespec* timeout) {
+    return syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(word), op, val, timeout, nullptr, 0);
+}
+#endif
+
+} // namespace
+
+shm_segment::~shm_segment() {
+    close();
+}
+
+#ifdef __linux__
+
+bool shm_segment::create(const std::string& name, std::size_t capacity, unsigned mode) {
+    close();
+    const std::string path = shm_name(name);
+    const std::size_t cap = round_capacity(capacity);
+
+    // Never take over an existing name: another publisher may still be writing to it
+    const int fd = shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, static_cast<mode_t>(mode));
+    if (fd < 0) {
+        if (errno == EEXIST) {
+            std::cerr << "Shared-memory segment already exists: " << path << std::endl;
+            return false;
+        }
+        std::cerr << "shm_open failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    const std::size_t size = HEADER_SIZE + cap;
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        std::cerr << "ftruncate failed: " << std::strerror(errno) << std::endl;
+        ::close(fd);
+        shm_unlink(path.c_str());
+        return false;
+    }
+    void* map = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+        std::cerr << "mmap failed: " << std::strerror(errno) << std::endl;
+        shm_unlink(path.c_str());
+        return false;
+    }
+
+    auto* h = new (map) ring_header{};
+    h->version = ring_header::VERSION;
+    h->header_size = static_cast<std::uint32_t>(HEADER_SIZE);
+    h->capacity = cap;
+    h->reserve_pos.store(0, std::memory_order_relaxed);
+    h->write_pos.store(0, std::memory_order_relaxed);
+    h->notify_seq.store(0, std::memory_order_relaxed);
+    h->waiters.store(0, std::memory_order_relaxed);
+    // The magic is what open() checks: publish it last
+    std::atomic_thread_fence(std::memory_order_release);
+    reinterpret_cast<std::atomic<std::uint64_t>*>(&h->magic)->store(ring_header::MAGIC, std::memory_order_release);
+
+    name_ = path;
+    map_ = map;
+    map_size_ = size;
+    header_ = h;
+    data_ = static_cast<std::byte*>(map) + HEADER_SIZE;
+    return true;
+}
+
+bool shm_segment::open(const std::string& name) {
+    close();
+    const std::string path = shm_name(name);
+    const int fd = shm_open(path.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        std::cerr << "shm_open failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    struct stat st{};
+    if (fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < HEADER_SIZE + MIN_CAPACITY) {
+        std::cerr << "Invalid shared-memory segment: " << path << std::endl;
+        ::close(fd);
+        return false;
+    }
+    const std::size_t size = static_cast<std::size_t>(st.st_size);
+    void* map = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+        std::cerr << "mmap failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    auto* h = static_cast<ring_header*>(map);
+    const std::uint64_t magic =
+        reinterpret_cast<std::atomic<std::uint64_t>*>(&h->magic)->load(std::memory_order_acquire);
+    if (magic != ring_header::MAGIC || h->version != ring_header::VERSION ||
+        h->header_size != HEADER_SIZE || h->header_size + h->capacity != size) {
+        std::cerr << "Invalid shared-memory segment: " << path << std::endl;
+        munmap(map, size);
+        return false;
+    }
+
+    name_ = path;
+    map_ = map;
+    map_size_ = size;
+    header_ = h;
+    data_ = static_cast<std::byte*>(map) + HEADER_SIZE;
+    return true;
+}
+
+void shm_segment::close() {
+    if (map_ != nullptr) {
+        munmap(map_, map_size_);
+    }
+    map_ = nullptr;
+    map_size_ = 0;
+    header_ = nullptr;
+    data_ = nullptr;
+}
+
+void shm_segment::unlink() {
+    if (!name_.empty()) {
+        shm_unlink(name_.c_str());
+    }
+}
+
+void shm_segment::notify_all() {
+    header_->notify_seq.fetch_add(1, std::memory_order_seq_cst);
+    if (header_->waiters.load(std::memory_order_seq_cst) != 0) {
+        futex(&header_->notify_seq, FUTEX_WAKE, INT32_MAX, nullptr);
+    }
+}
+
+void shm_segment::wait(std::uint32_t seen, int timeout_ms) {
+    timespec ts{ timeout_ms / 1000, static_cast<long>(timeout_ms % 1000) * 1000000L };
+    header_->waiters.fetch_add(1, std::memory_order_seq_cst);
+    // Returns at once if notify_seq already moved past `seen`
+    futex(&header_->notify_seq, FUTEX_WAIT, seen, &ts);
+    header_->waiters.fetch_sub(1, std::memory_order_seq_cst);
+}
+
+#else
+
+bool shm_segment::create(const std::string&, std::size_t, unsigned) {
+    std::cerr << "Shared-memory pub/sub is only supported on Linux" << std::endl;
+    return false;
+}
+
+bool shm_segment::open(const std::string&) {
+    std::cerr << "Shared-memory pub/sub is only supported on Linux" << std::endl;
+    return false;
+}
+
+void shm_segment::close() {}
+void shm_segment::unlink() {}
+void shm_segment::notify_all() {}
+void shm_segment::wait(std::uint32_t, int) {}
+
+#endif
+
+} // namespace j2::network::shm
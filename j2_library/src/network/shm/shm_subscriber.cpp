@@ -0,0 +1,117 @@
+#include "j2_library/network/shm/shm_subscriber.hpp"
+
+#include <cstring>
+#include <iostream>
+
+namespace j2::network::shm {
+
+namespace {
+constexpr int WAIT_TIMEOUT_MS = 100;   // bounds how long quit() may wait for the thread
+}
+
+shm_subscriber::~shm_subscriber() {
+    quit();
+}
+
+void shm_subscriber::setOnReceiveCallback(Callback cb) {
+    on_receive = std::move(cb);
+}
+
+bool shm_subscriber::start(const std::string& name) {
+    if (is_running) {
+        std::cerr << "Subscriber already running" << std::endl;
+        return false;
+    }
+    if (!segment.open(name)) {
+        return false;
+    }
+    dropped = 0;
+    is_running = true;
+    // Fix the start position here so nothing published after start() returns is missed
+    const std::uint64_t start_pos = segment.header()->write_pos.load(std::memory_order_acquire);
+    receiver_thread = std::thread(&shm_subscriber::receiveLoop, this, start_pos);
+    return true;
+}
+
+void shm_subscriber::quit() {
+    if (!is_running.exchange(false)) {
+        return;
+    }
+    segment.notify_all();
+    if (receiver_thread.joinable()) {
+        receiver_thread.join();
+    }
+    segment.close();
+}
+
+void shm_subscriber::receiveLoop(std::uint64_t read_pos) {
+    ring_header* h = segment.header();
+    const std::byte* ring = segment.data();
+    const std::uint64_t cap = h->capacity;
+    const std::size_t max_size = segment.max_message_size();
+
+    std::uint64_t expected_seq = 0;
+    bool have_seq = false;   // no gap accounting until the first record is read
+
+    // A copy is usable only if the publisher has not started reusing [read_pos, ...) since
+    auto still_valid = [&]() {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return h->reserve_pos.load(std::memory_order_relaxed) - read_pos <= cap;
+    };
+    // Lapped by the publisher: skip to the newest data, the next sequence gap counts the loss
+    auto resync = [&]() {
+        read_pos = h->write_pos.load(std::memory_order_acquire);
+    };
+
+    while (is_running) {
+        const std::uint64_t write_pos = h->write_pos.load(std::memory_order_acquire);
+        if (read_pos == write_pos) {
+            const std::uint32_t seen = h->notify_seq.load(std::memory_order_acquire);
+            if (h->write_pos.load(std::memory_order_acquire) == read_pos) {
+                segment.wait(seen, WAIT_TIMEOUT_MS);
+            }
+            continue;
+        }
+        if (write_pos - read_pos > cap) {
+            resync();
+            continue;
+        }
+
+        const std::uint64_t off = read_pos & (cap - 1);
+        record_header rec;
+        std::memcpy(&rec, ring + off, sizeof(rec));
+        if (rec.flags & WRAP_RECORD) {
+            if (!still_valid()) {
+                resync();
+                continue;
+            }
+            read_pos += cap - off;
+            continue;
+        }
+        if (rec.size > max_size) {
+            resync();   // torn header: the publisher lapped us while reading it
+            continue;
+        }
+        buffer.resize(rec.size);
+        if (rec.size > 0) {
+            std::memcpy(buffer.data(), ring + off + sizeof(rec), rec.size);
+        }
+        if (!still_valid()) {
+            resync();
+            continue;
+        }
+
+        if (have_seq && rec.seq > expected_seq) {
+            dropped.fetch_add(rec.seq - expected_seq, std::memory_order_relaxed);
+        }
+        expected_seq = rec.seq + 1;
+        have_seq = true;
+        read_pos += record_span(rec.size);
+
+        if (on_receive) {
+            on_receive(std::string_view(buffer.data(), buffer.size()));
+        }
+    }
+}
+
+} // namespace j2::network::shm
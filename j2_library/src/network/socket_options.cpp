@@ -0,0 +1,118 @@
+#include "j2_library/network/socket_options.hpp"
+#include "j2_library/network/ethernet.hpp"
+
+#include <iostream>
+
+#ifndef _WIN32
+#include <netinet/tcp.h>
+#endif
+
+namespace j2::network {
+
+namespace {
+
+bool set_int(int fd, int level, int name, int value, const char* label) {
+#ifdef _WIN32
+    const int r = setsockopt(static_cast<SOCKET>(fd), level, name, (const char*)&value, sizeof(value));
+#else
+    const int r = setsockopt(fd, level, name, &value, sizeof(value));
+#endif
+    if (r != 0) {
+        std::cerr << "Failed to set " << label << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool is_stream(int fd) {
+    int type = 0;
+    socklen_t len = sizeof(type);
+#ifdef _WIN32
+    getsockopt(static_cast<SOCKET>(fd), SOL_SOCKET, SO_TYPE, (char*)&type, &len);
+#else
+    getsockopt(fd, SOL_SOCKET, SO_TYPE, &type, &len);
+#endif
+    return type == SOCK_STREAM;
+}
+
+} // namespace
+
+socket_options socket_options::low_latency() {
+    socket_options o;
+    o.tcp_nodelay = true;
+    o.tcp_quickack = true;
+    o.priority = 6;
+    o.keepalive = true;
+    o.keepalive_idle_s = 5;
+    o.keepalive_interval_s = 1;
+    o.keepalive_count = 3;
+    o.tcp_user_timeout_ms = 5000;
+    return o;
+}
+
+socket_options socket_options::bulk_throughput() {
+    socket_options o;
+    o.tcp_nodelay = false;
+    o.send_buffer = 4 * 1024 * 1024;
+    o.receive_buffer = 4 * 1024 * 1024;
+    o.keepalive = true;
+    o.keepalive_idle_s = 60;
+    o.keepalive_interval_s = 10;
+    o.keepalive_count = 5;
+    return o;
+}
+
+bool socket_options::apply(int fd) const {
+    if (fd < 0) return false;
+    if (!tcp_nodelay && !tcp_quickack && !send_buffer && !receive_buffer && !busy_poll_us && !keepalive &&
+        !keepalive_idle_s && !keepalive_interval_s && !keepalive_count && !tcp_user_timeout_ms && !priority) {
+        return true; // nothing to do (no SO_TYPE lookup on the accept path)
+    }
+    const bool tcp = is_stream(fd);
+    bool ok = true;
+
+    if (send_buffer) ok &= set_int(fd, SOL_SOCKET, SO_SNDBUF, *send_buffer, "SO_SNDBUF");
+    if (receive_buffer) ok &= set_int(fd, SOL_SOCKET, SO_RCVBUF, *receive_buffer, "SO_RCVBUF");
+#ifdef SO_BUSY_POLL
+    if (busy_poll_us) ok &= set_int(fd, SOL_SOCKET, SO_BUSY_POLL, *busy_poll_us, "SO_BUSY_POLL");
+#endif
+#ifdef SO_PRIORITY
+    if (priority) ok &= set_int(fd, SOL_SOCKET, SO_PRIORITY, *priority, "SO_PRIORITY");
+#endif
+
+    if (!tcp) return ok;
+
+    if (tcp_nodelay) ok &= set_int(fd, IPPROTO_TCP, TCP_NODELAY, *tcp_nodelay ? 1 : 0, "TCP_NODELAY");
+#ifdef TCP_QUICKACK
+    if (tcp_quickack) ok &= set_int(fd, IPPROTO_TCP, TCP_QUICKACK, *tcp_quickack ? 1 : 0, "TCP_QUICKACK");
+#endif
+    if (keepalive) ok &= set_int(fd, SOL_SOCKET, SO_KEEPALIVE, *keepalive ? 1 : 0, "SO_KEEPALIVE");
+#ifdef TCP_KEEPIDLE
+    if (keepalive_idle_s) ok &= set_int(fd, IPPROTO_TCP, TCP_KEEPIDLE, *keepalive_idle_s, "TCP_KEEPIDLE");
+#endif
+#ifdef TCP_KEEPINTVL
+    if (keepalive_interval_s) ok &= set_int(fd, IPPROTO_TCP, TCP_KEEPINTVL, *keepalive_interval_s, "TCP_KEEPINTVL");
+#endif
+#ifdef TCP_KEEPCNT
+    if (keepalive_count) ok &= set_int(fd, IPPROTO_TCP, TCP_KEEPCNT, *keepalive_count, "TCP_KEEPCNT");
+#endif
+#ifdef TCP_USER_TIMEOUT
+    if (tcp_user_timeout_ms) {
+        ok &= set_int(fd, IPPROTO_TCP, TCP_USER_TIMEOUT, static_cast<int>(*tcp_user_timeout_ms), "TCP_USER_TIMEOUT");
+    }
+#endif
+    return ok;
+}
+
+void socket_options::rearm_quickack(int fd) const {
+#ifdef TCP_QUICKACK
+    if (tcp_quickack.value_or(false)) {
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_QUICKACK, &one, sizeof(one));
+    }
+#else
+    (void)fd;
+#endif
+}
+
+} // namespace j2::network
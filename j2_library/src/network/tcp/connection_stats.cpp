@@ -0,0 +1,135 @@
+#include "j2_library/network/tcp/connection_stats.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+
+#ifdef __linux__
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <linux/sockios.h>
+#endif
+
+namespace j2::network::tcp {
+
+bool connection_stats::sample(int fd) {
+    socket = fd;
+    tcp_info_valid = false;
+#ifdef __linux__
+    tcp_info info{};
+    socklen_t len = sizeof(info);
+    if (getsockopt(fd, IPPROTO_TCP, TCP_INFO, &info, &len) != 0) {
+        return false;
+    }
+    state = info.tcpi_state;
+    rtt_us = info.tcpi_rtt;
+    rtt_var_us = info.tcpi_rttvar;
+    rto_us = info.tcpi_rto;
+    snd_cwnd = info.tcpi_snd_cwnd;
+    snd_mss = info.tcpi_snd_mss;
+    unacked = info.tcpi_unacked;
+    lost = info.tcpi_lost;
+    retransmits = info.tcpi_retrans;
+    total_retrans = info.tcpi_total_retrans;
+
+    int queued = 0;
+    send_queue_bytes = ioctl(fd, SIOCOUTQ, &queued) == 0 ? static_cast<std::uint32_t>(queued) : 0;
+    queued = 0;
+    recv_queue_bytes = ioctl(fd, SIOCINQ, &queued) == 0 ? static_cast<std::uint32_t>(queued) : 0;
+    tcp_info_valid = true;
+#endif
+    return tcp_info_valid;
+}
+
+std::string connection_stats::to_string() const {
+    std::ostringstream out;
+    out << "fd=" << socket;
+    if (tcp_info_valid) {
+        out << std::fixed << std::setprecision(2)
+            << " rtt=" << rtt_us / 1000.0 << "ms/" << rtt_var_us / 1000.0 << "ms"
+            << " rto=" << rto_us / 1000 << "ms"
+            << " cwnd=" << snd_cwnd
+            << " unacked=" << unacked
+            << " retrans=" << retransmits << "/" << total_retrans
+            << " lost=" << lost
+            << " sndq=" << send_queue_bytes
+            << " rcvq=" << recv_queue_bytes;
+    }
+    out << " appq=" << app_queued_bytes
+        << " in=" << bytes_in << "B/" << messages_in << "msg"
+        << " out=" << bytes_out << "B/" << messages_out << "msg";
+    return out.str();
+}
+
+void traffic_counters::reset() {
+    bytes_in.store(0, std::memory_order_relaxed);
+    bytes_out.store(0, std::memory_order_relaxed);
+    messages_in.store(0, std::memory_order_relaxed);
+    messages_out.store(0, std::memory_order_relaxed);
+}
+
+void traffic_counters::copy_to(connection_stats& out) const {
+    out.bytes_in = bytes_in.load(std::memory_order_relaxed);
+    out.bytes_out = bytes_out.load(std::memory_order_relaxed);
+    out.messages_in = messages_in.load(std::memory_order_relaxed);
+    out.messages_out = messages_out.load(std::memory_order_relaxed);
+}
+
+stats_dumper::~stats_dumper() {
+    stop();
+    if (thread.joinable()) {
+        thread.detach(); // destroyed from its own sink: the loop only uses its shared state
+    }
+}
+
+bool stats_dumper::start(std::chrono::milliseconds interval, Source source, Sink sink) {
+    if (!source || interval.count() <= 0) return false;
+    if (thread.joinable()) {
+        if (is_running() || thread.get_id() == std::this_thread::get_id()) return false;
+        thread.join(); // stopped from its sink earlier
+    }
+    if (!sink) {
+        sink = [](const std::vector<connection_stats>& all) {
+            std::ostringstream out;
+            for (const auto& s : all) out << s.to_string() << "\n";
+            std::cout << out.str() << std::flush;
+        };
+    }
+
+    state = std::make_shared<loop_state>();
+    // Held until `thread` is assigned: the loop takes the lock before its first sink call, so a
+    // sink that calls stop() right away already sees its own thread
+    std::lock_guard<std::mutex> start_lock(state->mutex);
+    thread = std::thread([st = state, interval, source = std::move(source), sink = std::move(sink)] {
+        std::unique_lock<std::mutex> lock(st->mutex);
+        while (!st->cv.wait_for(lock, interval, [&st] { return st->stopping; })) {
+            lock.unlock();
+            sink(source());
+            lock.lock();
+        }
+    });
+    return true;
+}
+
+void stats_dumper::stop() {
+    if (!thread.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->stopping = true;
+    }
+    state->cv.notify_all();
+    if (thread.get_id() == std::this_thread::get_id()) {
+        return; // stopped from the sink itself: the loop exits once it returns
+    }
+    thread.join();
+}
+
+bool stats_dumper::is_running() const {
+    if (!thread.joinable()) return false;
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return !state->stopping;
+}
+
+} // namespace j2::network::tcp
@@ -1,6 +1,8 @@
 
 #include "j2_library/network/tcp/tcp_client.hpp"
 
+#include <cerrno>
+
 namespace j2::network::tcp {
 
 tcp_client::tcp_client()
@@ -12,10 +14,15 @@ tcp_client::tcp_client()
     , address_family(AF_INET)
 {
     stop_flag = false;
+    connected = false;
     server_ip.clear();
     server_port = 0;
 }
 
+tcp_client::tcp_client(const socket_options& opts) : tcp_client() {
+    options = opts;
+}
+
 tcp_client::~tcp_client() {
     stop();
 }
@@ -26,9 +33,12 @@ void tcp_client::setServer(const std::string& ip, unsigned short port, int famil
     address_family = family;
 }
 
+void tcp_client::set_socket_options(const socket_options& opts) { options = opts; }
 void tcp_client::set_on_connect(Callback cb) { on_connect = std::move(cb); }
 void tcp_client::set_on_close(Callback cb) { on_close = std::move(cb); }
 void tcp_client::set_on_receive(ReceiveCallback cb) { on_receive = std::move(cb); }
+void tcp_client::set_framing(const framing& f) { decoder = frame_decoder(f); }
+void tcp_client::set_on_message(MessageCallback cb) { on_message = std::move(cb); }
 
 bool tcp_client::start(std::chrono::seconds sleep_time) {
     if (server_ip.length() == 0) {
@@ -48,6 +58,7 @@ bool tcp_client::start(std::chrono::seconds sleep_time) {
 }
 
 void tcp_client::stop() {
+    stop_stats_dump();
     stop_flag = true;
     close_connection();
     if (client_thread.joinable()) {
@@ -55,6 +66,12 @@ void tcp_client::stop() {
     }
 }
 
+#ifdef _WIN32
+static constexpr int SEND_FLAGS = 0;
+#else
+static constexpr int SEND_FLAGS = MSG_NOSIGNAL; // EPIPE instead of SIGPIPE on a reset connection
+#endif
+
 int tcp_client::send_data(const std::string& data) {
     std::lock_guard<std::mutex> lock(send_mutex);
 #ifdef _WIN32
@@ -62,14 +79,42 @@ int tcp_client::send_data(const std::string& data) {
 #else
     if (socket_fd != -1) {
 #endif
-        return ::send(socket_fd, data.c_str(), static_cast<int>(data.size()), 0);
+        int sent = ::send(socket_fd, data.c_str(), static_cast<int>(data.size()), SEND_FLAGS);
+        if (sent > 0) traffic.sent(static_cast<std::size_t>(sent));
+        return sent;
     }
     return -1; // Not connected or invalid socket
 }
 
+bool tcp_client::send_all(const char* data, std::size_t size) {
+    std::lock_guard<std::mutex> lock(send_mutex);
+#ifdef _WIN32
+    if (socket_fd == INVALID_SOCKET) return false;
+#else
+    if (socket_fd == -1) return false;
+#endif
+
+    std::size_t offset = 0;
+    while (offset < size) {
+        int n = ::send(socket_fd, data + offset, static_cast<int>(size - offset), SEND_FLAGS);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        traffic.sent(static_cast<std::size_t>(n));
+        offset += static_cast<std::size_t>(n);
+    }
+    if (offset == size) return true;
+
+    // Part of the frame may be on the wire: the stream is out of sync, start over
+    if (offset > 0) close_connection_locked();
+    return false;
+}
+
 void tcp_client::close_connection() {
     std::lock_guard<std::mutex> lock(send_mutex);
+    close_connection_locked();
+}
 
+void tcp_client::close_connection_locked() {
 #ifdef _WIN32
     if (socket_fd != INVALID_SOCKET) {
 #else
@@ -80,35 +125,56 @@ void tcp_client::close_connection() {
         closesocket(socket_fd);
         socket_fd = INVALID_SOCKET;
 #else
+        shutdown(socket_fd, SHUT_RDWR); // wake up a recv() blocked in the receive thread
         close(socket_fd);
         socket_fd = -1;
 #endif
+        connected = false;
 
         if (on_close) on_close();
     }
 }
 
 bool tcp_client::is_connected() const {
-#ifdef _WIN32
-    return socket_fd != INVALID_SOCKET;
-#else
-    return socket_fd != -1;
-#endif
+    return connected;
+}
+
+connection_stats tcp_client::get_stats() {
+    connection_stats s;
+    traffic.copy_to(s);
+    std::lock_guard<std::mutex> lock(send_mutex);
+    if (is_connected()) {
+        s.sample(static_cast<int>(socket_fd));
+    }
+    return s;
+}
+
+bool tcp_client::start_stats_dump(std::chrono::milliseconds interval, stats_dumper::Sink sink) {
+    return stats_dump.start(interval, [this] { return std::vector<connection_stats>{ get_stats() }; },
+        std::move(sink));
+}
+
+void tcp_client::stop_stats_dump() {
+    stats_dump.stop();
 }
 
 void tcp_client::connect_to_server(std::chrono::seconds sleep_time) {
     while (!stop_flag) {
-        socket_fd = ::socket(address_family, SOCK_STREAM, 0);
-
+        // The socket is published in socket_fd only once connected, so is_connected()/send_data()
+        // never see a socket that is still connecting
 #ifdef _WIN32
-        if (socket_fd == INVALID_SOCKET) {
+        SOCKET fd = ::socket(address_family, SOCK_STREAM, 0);
+        if (fd == INVALID_SOCKET) {
 #else
-        if (socket_fd == (-1)) {
+        int fd = ::socket(address_family, SOCK_STREAM, 0);
+        if (fd == (-1)) {
 #endif
             std::this_thread::sleep_for(sleep_time);
             continue;
         }
 
+        options.apply(static_cast<int>(fd));
+
         sockaddr_storage server_addr_storage;
         memset(&server_addr_storage, 0, sizeof(server_addr_storage));
         socklen_t addr_len = 0;
@@ -132,11 +198,9 @@ void tcp_client::connect_to_server(std::chrono::seconds sleep_time) {
         } else {
             std::cerr << "Unsupported address family." << std::endl;
 #ifdef _WIN32
-            closesocket(socket_fd);
-            socket_fd = INVALID_SOCKET;
+            closesocket(fd);
 #else
-            close(socket_fd);
-            socket_fd = -1;
+            close(fd);
 #endif
             std::this_thread::sleep_for(sleep_time);
             continue;
@@ -144,17 +208,27 @@ void tcp_client::connect_to_server(std::chrono::seconds sleep_time) {
 
         std::cout << "   try to connect..." << std::endl;
 
-        if (::connect(socket_fd, reinterpret_cast<sockaddr*>(&server_addr_storage), addr_len) == 0) {
+        bool published = false;
+        if (::connect(fd, reinterpret_cast<sockaddr*>(&server_addr_storage), addr_len) == 0) {
+            std::lock_guard<std::mutex> lock(send_mutex);
+            if (!stop_flag) {
+                // Reset before publishing: a concurrent send_data() counts into the new connection
+                traffic.reset();
+                socket_fd = fd;
+                connected = true;
+                published = true;
+            }
+        }
+
+        if (published) {
             if (on_connect) on_connect();
             receive_loop();
         }
         else {
 #ifdef _WIN32
-            closesocket(socket_fd);
-            socket_fd = INVALID_SOCKET;
+            closesocket(fd);
 #else
-            close(socket_fd);
-            socket_fd = -1;
+            close(fd);
 #endif
         }
 
@@ -163,16 +237,32 @@ void tcp_client::connect_to_server(std::chrono::seconds sleep_time) {
 }
 
 void tcp_client::receive_loop() {
-    char buffer[BUFFER_SIZE];
+    decoder.reset(); // drop a partial message left by the previous connection
 
     while (!stop_flag) {
-        int bytes_received = ::recv(socket_fd, buffer, sizeof(buffer), 0);
-        if (bytes_received > 0) {
-            if (on_receive) {
-                on_receive(std::string(buffer, bytes_received));
+        char* buffer = decoder.prepare();
+        int bytes_received = ::recv(socket_fd, buffer, static_cast<int>(decoder.writable()), 0);
+        if (bytes_received <= 0) {
+            close_connection();
+            break;
+        }
+        decoder.commit(static_cast<std::size_t>(bytes_received));
+        traffic.received(static_cast<std::size_t>(bytes_received));
+        options.rearm_quickack(static_cast<int>(socket_fd));
+
+        std::string_view msg;
+        frame_decoder::Result r;
+        while ((r = decoder.next(msg)) == frame_decoder::Result::Message) {
+            traffic.delivered(1);
+            if (on_message) {
+                on_message(msg);
+            }
+            else if (on_receive) {
+                on_receive(std::string(msg));
             }
         }
-        else {
+        if (r == frame_decoder::Result::Error) {
+            std::cerr << "Invalid frame from server" << std::endl;
             close_connection();
             break;
         }
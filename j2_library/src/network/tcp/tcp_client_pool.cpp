@@ -0,0 +1,602 @@
+#include "j2_library/network/tcp/tcp_client_pool.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <cstring>
+
+#ifdef __linux__
+#include <cerrno>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#endif
+
+namespace j2::network::tcp {
+
+tcp_client_pool::tcp_client_pool() : jitter(std::random_device{}()) {}
+
+tcp_client_pool::~tcp_client_pool() {
+    stop();
+}
+
+void tcp_client_pool::set_backoff(std::chrono::milliseconds initial, std::chrono::milliseconds max) {
+    initial_backoff = std::max(initial, std::chrono::milliseconds(1));
+    max_backoff = std::max(max, initial_backoff);
+}
+
+void tcp_client_pool::set_connect_timeout(std::chrono::milliseconds timeout) {
+    connect_timeout = std::max(timeout, std::chrono::milliseconds(0));
+}
+
+void tcp_client_pool::set_socket_options(const socket_options& opts) {
+    options = opts;
+}
+
+int tcp_client_pool::add(const std::string& ip, unsigned short port, int family) {
+    if (ip.empty() || port == 0) {
+        std::cerr << " server ip is empty or port is zero. " << std::endl;
+        return -1;
+    }
+    auto e = std::make_shared<entry>();
+    e->server_ip = ip;
+    e->server_port = port;
+    e->address_family = family;
+
+    std::lock_guard<std::mutex> lock(entries_mutex);
+    e->id = next_id++;
+    entries.emplace(e->id, e);
+    return e->id;
+}
+
+std::shared_ptr<tcp_client_pool::entry> tcp_client_pool::find(int id) const {
+    std::lock_guard<std::mutex> lock(entries_mutex);
+    auto it = entries.find(id);
+    return it != entries.end() ? it->second : nullptr;
+}
+
+void tcp_client_pool::set_on_connect(int id, Callback cb) {
+    if (auto e = find(id)) e->on_connect = std::move(cb);
+}
+
+void tcp_client_pool::set_on_close(int id, Callback cb) {
+    if (auto e = find(id)) e->on_close = std::move(cb);
+}
+
+void tcp_client_pool::set_on_receive(int id, ReceiveCallback cb) {
+    if (auto e = find(id)) e->on_receive = std::move(cb);
+}
+
+void tcp_client_pool::set_on_message(int id, MessageCallback cb) {
+    if (auto e = find(id)) e->on_message = std::move(cb);
+}
+
+void tcp_client_pool::set_framing(int id, const framing& f) {
+    if (auto e = find(id)) e->decoder = frame_decoder(f);
+}
+
+std::size_t tcp_client_pool::size() const {
+    std::lock_guard<std::mutex> lock(entries_mutex);
+    return entries.size();
+}
+
+std::size_t tcp_client_pool::connected_count() const {
+    std::size_t count = 0;
+    std::lock_guard<std::mutex> lock(entries_mutex);
+    for (auto& item : entries) {
+        if (item.second->fallback) {
+            if (item.second->fallback->is_connected()) ++count;
+            continue;
+        }
+        std::lock_guard<std::mutex> entry_lock(item.second->mutex);
+        if (item.second->connected) ++count;
+    }
+    return count;
+}
+
+bool tcp_client_pool::is_connected(int id) const {
+    auto e = find(id);
+    if (!e) return false;
+    if (e->fallback) return e->fallback->is_connected();
+    std::lock_guard<std::mutex> lock(e->mutex);
+    return e->connected;
+}
+
+#ifdef __linux__
+
+namespace {
+
+constexpr std::uint64_t WAKE_ID = ~std::uint64_t(0);
+
+} // namespace
+
+bool tcp_client_pool::start() {
+    if (running) return false;
+
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.u64 = WAKE_ID;
+    if (epoll_fd < 0 || wake_fd < 0 || epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_fd, &ev) != 0) {
+        perror("epoll setup failed");
+        if (epoll_fd >= 0) close(epoll_fd);
+        if (wake_fd >= 0) close(wake_fd);
+        epoll_fd = wake_fd = -1;
+        return false;
+    }
+
+    {
+        // Every registered connection is opened by the loop
+        std::lock_guard<std::mutex> lock(entries_mutex);
+        std::lock_guard<std::mutex> command_lock(command_mutex);
+        to_connect.clear();
+        to_remove.clear();
+        for (auto& item : entries) to_connect.push_back(item.first);
+    }
+
+    running = true;
+    loop_thread = std::thread(&tcp_client_pool::loop, this);
+    return true;
+}
+
+bool tcp_client_pool::start(int id) {
+    if (!running || !find(id)) return false;
+    {
+        std::lock_guard<std::mutex> lock(command_mutex);
+        to_connect.push_back(id);
+    }
+    wake();
+    return true;
+}
+
+void tcp_client_pool::stop() {
+    if (!running) return;
+    running = false;
+    wake();
+    if (loop_thread.joinable()) {
+        loop_thread.join();
+    }
+    close(epoll_fd);
+    close(wake_fd);
+    epoll_fd = wake_fd = -1;
+}
+
+void tcp_client_pool::remove(int id) {
+    if (running) {
+        {
+            std::lock_guard<std::mutex> lock(command_mutex);
+            to_remove.push_back(id);
+        }
+        wake();
+        return;
+    }
+    std::lock_guard<std::mutex> lock(entries_mutex);
+    entries.erase(id);
+}
+
+void tcp_client_pool::wake() {
+    std::uint64_t one = 1;
+    ssize_t r = write(wake_fd, &one, sizeof(one));
+    (void)r;
+}
+
+int tcp_client_pool::send_data(int id, const std::string& data) {
+    auto e = find(id);
+    if (!e) return -1;
+    std::lock_guard<std::mutex> lock(e->mutex);
+    if (!e->connected) return -1; // Not connected
+
+    std::size_t offset = 0;
+    if (e->queue.empty()) {
+        while (offset < data.size()) {
+            ssize_t n = ::send(e->fd, data.data() + offset, data.size() - offset, MSG_DONTWAIT | MSG_NOSIGNAL);
+            if (n > 0) {
+                offset += static_cast<std::size_t>(n);
+                continue;
+            }
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+            shutdown(e->fd, SHUT_RDWR); // the loop sees the hang-up and reconnects
+            return -1;
+        }
+        if (offset == data.size()) {
+            return static_cast<int>(data.size());
+        }
+    }
+
+    e->queue.emplace_back(offset == 0 ? data : data.substr(offset));
+    updateInterest(*e);
+    return static_cast<int>(data.size());
+}
+
+void tcp_client_pool::loop() {
+    std::vector<epoll_event> events(256);
+
+    while (running) {
+        runCommands();
+        retryDue();
+        expireConnects();
+
+        int n = epoll_wait(epoll_fd, events.data(), static_cast<int>(events.size()), nextTimeoutMs());
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            perror("epoll_wait failed");
+            break;
+        }
+
+        const auto ready = static_cast<std::size_t>(n);
+        for (std::size_t i = 0; i < ready; ++i) {
+            const epoll_event& ev = events[i];
+            if (ev.data.u64 == WAKE_ID) {
+                std::uint64_t count;
+                while (read(wake_fd, &count, sizeof(count)) > 0) {}
+                continue;
+            }
+
+            auto e = find(static_cast<int>(ev.data.u64));
+            if (!e || e->fd < 0) continue;
+
+            if (e->connecting) {
+                if (!(ev.events & (EPOLLOUT | EPOLLERR | EPOLLHUP))) continue;
+                finishConnect(*e);
+                if (!e->connected) continue;
+            }
+
+            bool ok = true;
+            if (ev.events & (EPOLLIN | EPOLLRDHUP | EPOLLERR | EPOLLHUP)) {
+                ok = readEntry(*e);
+            }
+            if (ok && (ev.events & EPOLLOUT)) {
+                ok = flushEntry(*e);
+            }
+            if (!ok) {
+                dropEntry(*e);
+                scheduleRetry(*e);
+            }
+        }
+
+        if (ready == events.size()) {
+            events.resize(events.size() * 2);
+        }
+    }
+
+    // Close everything; the entries stay registered for the next start()
+    std::vector<std::shared_ptr<entry>> all;
+    {
+        std::lock_guard<std::mutex> lock(entries_mutex);
+        for (auto& item : entries) all.push_back(item.second);
+    }
+    for (auto& e : all) dropEntry(*e);
+    retries.clear();
+    deadlines.clear();
+}
+
+void tcp_client_pool::runCommands() {
+    std::vector<int> connects;
+    std::vector<int> removes;
+    {
+        std::lock_guard<std::mutex> lock(command_mutex);
+        connects.swap(to_connect);
+        removes.swap(to_remove);
+    }
+
+    for (int id : removes) {
+        std::shared_ptr<entry> e;
+        {
+            std::lock_guard<std::mutex> lock(entries_mutex);
+            auto it = entries.find(id);
+            if (it == entries.end()) continue;
+            e = it->second;
+            entries.erase(it);
+        }
+        dropEntry(*e);
+    }
+
+    for (int id : connects) {
+        auto e = find(id);
+        if (e && e->fd < 0) {
+            e->backoff = std::chrono::milliseconds(0);
+            connectEntry(*e);
+        }
+    }
+}
+
+void tcp_client_pool::connectEntry(entry& e) {
+    sockaddr_storage addr{};
+    socklen_t addr_len = 0;
+    int parsed = 0;
+    if (e.address_family == AF_INET) {
+        sockaddr_in* addr4 = reinterpret_cast<sockaddr_in*>(&addr);
+        addr4->sin_family = AF_INET;
+        addr4->sin_port = htons(e.server_port);
+        parsed = inet_pton(AF_INET, e.server_ip.c_str(), &addr4->sin_addr);
+        addr_len = sizeof(sockaddr_in);
+    }
+    else if (e.address_family == AF_INET6) {
+        sockaddr_in6* addr6 = reinterpret_cast<sockaddr_in6*>(&addr);
+        addr6->sin6_family = AF_INET6;
+        addr6->sin6_port = htons(e.server_port);
+        parsed = inet_pton(AF_INET6, e.server_ip.c_str(), &addr6->sin6_addr);
+        addr_len = sizeof(sockaddr_in6);
+    }
+    if (parsed != 1) {
+        std::cerr << "Invalid server address: " << e.server_ip << std::endl;
+        scheduleRetry(e);
+        return;
+    }
+
+    int fd = ::socket(e.address_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        perror("Socket creation failed");
+        scheduleRetry(e);
+        return;
+    }
+
+    options.apply(fd);
+
+    // Completion (or failure) is reported as EPOLLOUT/EPOLLERR, also for an immediate success
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), addr_len) != 0 && errno != EINPROGRESS) {
+        close(fd);
+        scheduleRetry(e);
+        return;
+    }
+
+    epoll_event ev{};
+    ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+    ev.data.u64 = static_cast<std::uint64_t>(e.id);
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+        perror("epoll_ctl add failed");
+        close(fd);
+        scheduleRetry(e);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(e.mutex);
+        e.fd = fd;
+        e.connecting = true;
+        e.want_write = true;
+    }
+    if (connect_timeout.count() > 0) {
+        e.connect_deadline = std::chrono::steady_clock::now() + connect_timeout;
+        deadlines.emplace(e.connect_deadline, e.id);
+    }
+}
+
+void tcp_client_pool::finishConnect(entry& e) {
+    int error = 0;
+    socklen_t len = sizeof(error);
+    if (getsockopt(e.fd, SOL_SOCKET, SO_ERROR, &error, &len) != 0 || error != 0) {
+        dropEntry(e);
+        scheduleRetry(e);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(e.mutex);
+        e.connecting = false;
+        e.connected = true;
+        updateInterest(e); // drop EPOLLOUT until something is queued
+    }
+    e.backoff = std::chrono::milliseconds(0);
+    e.decoder.reset(); // drop a partial message left by the previous connection
+    if (e.on_connect) e.on_connect();
+}
+
+// Reads until the socket is drained. Returns false when the connection is gone.
+bool tcp_client_pool::readEntry(entry& e) {
+    while (true) {
+        char* buffer = e.decoder.prepare();
+        ssize_t n = ::recv(e.fd, buffer, e.decoder.writable(), 0);
+        if (n > 0) {
+            e.decoder.commit(static_cast<std::size_t>(n));
+
+            std::string_view msg;
+            frame_decoder::Result r;
+            while ((r = e.decoder.next(msg)) == frame_decoder::Result::Message) {
+                if (e.on_message) {
+                    e.on_message(msg);
+                }
+                else if (e.on_receive) {
+                    e.on_receive(std::string(msg));
+                }
+            }
+            if (r == frame_decoder::Result::Error) {
+                std::cerr << "Invalid frame from server" << std::endl;
+                return false;
+            }
+            continue;
+        }
+        if (n == 0) return false;
+        if (errno == EINTR) continue;
+        if (errno != EAGAIN && errno != EWOULDBLOCK) return false;
+        options.rearm_quickack(e.fd);
+        return true;
+    }
+}
+
+// Called on EPOLLOUT. Returns false when the connection failed.
+bool tcp_client_pool::flushEntry(entry& e) {
+    std::lock_guard<std::mutex> lock(e.mutex);
+    while (!e.queue.empty()) {
+        const std::string& head = e.queue.front();
+        ssize_t n = ::send(e.fd, head.data() + e.front_offset, head.size() - e.front_offset,
+            MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            return false;
+        }
+        e.front_offset += static_cast<std::size_t>(n);
+        if (e.front_offset == head.size()) {
+            e.queue.pop_front();
+            e.front_offset = 0;
+        }
+    }
+    updateInterest(e);
+    return true;
+}
+
+// Closes the socket. on_close is called when the connection had been established.
+void tcp_client_pool::dropEntry(entry& e) {
+    bool was_connected = false;
+    {
+        std::lock_guard<std::mutex> lock(e.mutex);
+        if (e.fd < 0) return;
+        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, e.fd, nullptr);
+        shutdown(e.fd, SHUT_RDWR);
+        close(e.fd);
+        e.fd = -1;
+        was_connected = e.connected;
+        e.connected = false;
+        e.connecting = false;
+        e.queue.clear();
+        e.front_offset = 0;
+        e.want_write = false;
+    }
+    if (was_connected && e.on_close) e.on_close();
+}
+
+// Next attempt after initial_backoff, doubling per failed attempt up to max_backoff (+-20% jitter)
+void tcp_client_pool::scheduleRetry(entry& e) {
+    if (!running) return;
+    e.backoff = e.backoff.count() == 0 ? initial_backoff : std::min(e.backoff * 2, max_backoff);
+    std::uniform_int_distribution<int> percent(80, 120);
+    const auto delay = std::chrono::milliseconds(e.backoff.count() * percent(jitter) / 100);
+    e.next_attempt = std::chrono::steady_clock::now() + delay;
+    retries.emplace(e.next_attempt, e.id);
+}
+
+void tcp_client_pool::retryDue() {
+    const auto now = std::chrono::steady_clock::now();
+    while (!retries.empty() && retries.begin()->first <= now) {
+        const auto due = retries.begin()->first;
+        const int id = retries.begin()->second;
+        retries.erase(retries.begin());
+
+        // Skip stale timers (removed, restarted or already reconnected)
+        auto e = find(id);
+        if (e && e->fd < 0 && e->next_attempt == due) {
+            connectEntry(*e);
+        }
+    }
+}
+
+// Abandons connects that are still pending at their deadline (e.g. a host that drops SYNs)
+void tcp_client_pool::expireConnects() {
+    const auto now = std::chrono::steady_clock::now();
+    while (!deadlines.empty() && deadlines.begin()->first <= now) {
+        const auto due = deadlines.begin()->first;
+        const int id = deadlines.begin()->second;
+        deadlines.erase(deadlines.begin());
+
+        // Skip stale timers (removed, connected or a newer attempt)
+        auto e = find(id);
+        if (e && e->connecting && e->connect_deadline == due) {
+            dropEntry(*e);
+            scheduleRetry(*e);
+        }
+    }
+}
+
+int tcp_client_pool::nextTimeoutMs() const {
+    if (retries.empty() && deadlines.empty()) return -1;
+    auto next = std::chrono::steady_clock::time_point::max();
+    if (!retries.empty()) next = retries.begin()->first;
+    if (!deadlines.empty()) next = std::min(next, deadlines.begin()->first);
+    const auto wait = std::chrono::ceil<std::chrono::milliseconds>(
+        next - std::chrono::steady_clock::now());
+    return static_cast<int>(std::max<std::chrono::milliseconds::rep>(wait.count(), 0));
+}
+
+// Arms EPOLLOUT while connecting or while data is queued. Called with e.mutex held.
+void tcp_client_pool::updateInterest(entry& e) {
+    const bool want = e.connecting || !e.queue.empty();
+    if (want == e.want_write) return;
+
+    epoll_event ev{};
+    ev.events = EPOLLIN | EPOLLRDHUP | EPOLLET | (want ? EPOLLOUT : 0u);
+    ev.data.u64 = static_cast<std::uint64_t>(e.id);
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_MOD, e.fd, &ev) == 0) {
+        e.want_write = want;
+    }
+}
+
+#else // !__linux__
+
+// No epoll here: one tcp_client (and its thread) per connection
+
+bool tcp_client_pool::start() {
+    if (running) return false;
+    running = true;
+    std::vector<int> ids;
+    {
+        std::lock_guard<std::mutex> lock(entries_mutex);
+        for (auto& item : entries) ids.push_back(item.first);
+    }
+    for (int id : ids) start(id);
+    return true;
+}
+
+bool tcp_client_pool::start(int id) {
+    auto e = find(id);
+    if (!running || !e) return false;
+    if (e->fallback) return true;
+
+    e->fallback = std::make_unique<tcp_client>(options);
+    e->fallback->setServer(e->server_ip, e->server_port, e->address_family);
+    e->fallback->set_on_connect(e->on_connect);
+    e->fallback->set_on_close(e->on_close);
+    e->fallback->set_on_receive(e->on_receive);
+    e->fallback->set_on_message(e->on_message);
+    e->fallback->set_framing(e->decoder.getFraming());
+    const auto seconds = std::chrono::ceil<std::chrono::seconds>(initial_backoff);
+    return e->fallback->start(std::max(seconds, std::chrono::seconds(1)));
+}
+
+void tcp_client_pool::stop() {
+    if (!running) return;
+    running = false;
+    std::lock_guard<std::mutex> lock(entries_mutex);
+    for (auto& item : entries) {
+        if (item.second->fallback) {
+            item.second->fallback->stop();
+            item.second->fallback.reset();
+        }
+    }
+}
+
+void tcp_client_pool::remove(int id) {
+    std::shared_ptr<entry> e;
+    {
+        std::lock_guard<std::mutex> lock(entries_mutex);
+        auto it = entries.find(id);
+        if (it == entries.end()) return;
+        e = it->second;
+        entries.erase(it);
+    }
+    if (e->fallback) e->fallback->stop();
+}
+
+int tcp_client_pool::send_data(int id, const std::string& data) {
+    auto e = find(id);
+    return e && e->fallback ? e->fallback->send_data(data) : -1;
+}
+
+void tcp_client_pool::wake() {}
+void tcp_client_pool::loop() {}
+void tcp_client_pool::runCommands() {}
+void tcp_client_pool::connectEntry(entry&) {}
+void tcp_client_pool::finishConnect(entry&) {}
+bool tcp_client_pool::readEntry(entry&) { return false; }
+bool tcp_client_pool::flushEntry(entry&) { return false; }
+void tcp_client_pool::dropEntry(entry&) {}
+void tcp_client_pool::scheduleRetry(entry&) {}
+void tcp_client_pool::updateInterest(entry&) {}
+int tcp_client_pool::nextTimeoutMs() const { return -1; }
+void tcp_client_pool::retryDue() {}
+void tcp_client_pool::expireConnects() {}
+
+#endif // __linux__
+
+} // namespace j2::network::tcp
@@ -0,0 +1,135 @@
+#include "j2_library/network/tcp/tcp_framing.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace j2::network::tcp {
+
+framing framing::none() {
+    return framing();
+}
+
+framing framing::length_prefix(std::size_t prefix_bytes, bool big_endian) {
+    framing f;
+    f.mode = Mode::LengthPrefix;
+    f.prefix_bytes = prefix_bytes;
+    f.big_endian = big_endian;
+    return f;
+}
+
+framing framing::delimited(std::string delimiter) {
+    framing f;
+    f.mode = Mode::Delimiter;
+    f.delimiter = std::move(delimiter);
+    return f;
+}
+
+framing framing::fixed(std::size_t size) {
+    framing f;
+    f.mode = Mode::FixedSize;
+    f.fixed_size = size;
+    return f;
+}
+
+void framing::encode(std::string& out, std::string_view payload) const {
+    if (mode == Mode::LengthPrefix) {
+        const std::uint64_t n = payload.size();
+        for (std::size_t i = 0; i < prefix_bytes; ++i) {
+            const std::size_t shift = 8 * (big_endian ? prefix_bytes - 1 - i : i);
+            out.push_back(static_cast<char>((n >> shift) & 0xFF));
+        }
+    }
+    out.append(payload.data(), payload.size());
+    if (mode == Mode::Delimiter) {
+        out += delimiter;
+    }
+}
+
+frame_decoder::frame_decoder(const framing& f, std::size_t min_free_bytes)
+    : frame(f), min_free(min_free_bytes > 0 ? min_free_bytes : 1)
+{
+    // The buffer is allocated by the first prepare() so that idle connections cost nothing
+}
+
+char* frame_decoder::prepare() {
+    if (buffer.size() - tail >= min_free) {
+        return buffer.data() + tail;
+    }
+    // Move the unconsumed bytes to the front before growing
+    if (head > 0) {
+        const std::size_t n = tail - head;
+        if (n > 0) std::memmove(buffer.data(), buffer.data() + head, n);
+        head = 0;
+        tail = n;
+    }
+    if (buffer.size() - tail < min_free) {
+        buffer.resize(std::max(buffer.size() * 2, tail + min_free));
+    }
+    return buffer.data() + tail;
+}
+
+frame_decoder::Result frame_decoder::next(std::string_view& msg) {
+    const char* data = buffer.data() + head;
+    const std::size_t avail = tail - head;
+
+    switch (frame.mode) {
+    case framing::Mode::None:
+        if (avail == 0) break;
+        msg = std::string_view(data, avail);
+        head = tail = 0; // whole buffer consumed; the view stays valid until prepare()
+        return Result::Message;
+
+    case framing::Mode::LengthPrefix: {
+        const std::size_t hdr = frame.prefix_bytes;
+        if (hdr == 0 || hdr > 8) return Result::Error;
+        if (avail < hdr) break;
+        std::uint64_t len = 0;
+        for (std::size_t i = 0; i < hdr; ++i) {
+            const auto b = static_cast<std::uint8_t>(data[frame.big_endian ? i : hdr - 1 - i]);
+            len = (len << 8) | b;
+        }
+        if (len > frame.max_message_size) return Result::Error;
+        if (avail - hdr < len) break;
+        msg = std::string_view(data + hdr, static_cast<std::size_t>(len));
+        head += hdr + static_cast<std::size_t>(len);
+        return Result::Message;
+    }
+
+    case framing::Mode::Delimiter: {
+        const std::string& delim = frame.delimiter;
+        if (delim.empty()) return Result::Error;
+        // Resume the search where the previous call stopped (minus a partial delimiter)
+        const std::size_t from = scan >= delim.size() ? scan - (delim.size() - 1) : 0;
+        const std::string_view window(data, avail);
+        const std::size_t pos = window.find(delim, from);
+        if (pos == std::string_view::npos) {
+            if (avail > frame.max_message_size + delim.size()) return Result::Error;
+            scan = avail;
+            break;
+        }
+        if (pos > frame.max_message_size) return Result::Error;
+        msg = std::string_view(data, pos);
+        head += pos + delim.size();
+        scan = 0;
+        return Result::Message;
+    }
+
+    case framing::Mode::FixedSize:
+        if (frame.fixed_size == 0) return Result::Error;
+        if (avail < frame.fixed_size) break;
+        msg = std::string_view(data, frame.fixed_size);
+        head += frame.fixed_size;
+        return Result::Message;
+    }
+
+    if (head == tail) {
+        head = tail = 0;
+    }
+    return Result::NeedMore;
+}
+
+void frame_decoder::reset() {
+    head = tail = scan = 0;
+}
+
+} // namespace j2::network::tcp
@@ -1,9 +1,22 @@
 #include "j2_library/network/tcp/tcp_server.hpp"
 
+#include <algorithm>
+
 namespace j2::network::tcp {
 
+namespace {
+
+// Server whose client handler runs on this thread (Thread backend)
+thread_local const tcp_server* current_handler_owner = nullptr;
+
+} // namespace
+
 tcp_server::tcp_server() : is_running(false), server_socket(-1) {}
 
+tcp_server::tcp_server(const socket_options& opts) : tcp_server() {
+    options = opts;
+}
+
 tcp_server::~tcp_server() {
     quit();
 }
@@ -32,6 +45,14 @@ tcp_server::StartResult tcp_server::start(const std::string& ip, int port) {
 #else
         setsockopt(server_socket, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
 #endif
+#ifdef SO_REUSEPORT
+        if (backend == Backend::Epoll && accept_sharding) {
+            // The other shard listeners bind the same address in startEpoll()
+            setsockopt(server_socket, SOL_SOCKET, SO_REUSEPORT, &opt, sizeof(opt));
+        }
+#endif
+
+        options.apply(server_socket); // buffer sizes must be set before listen()
 
         if (bind(server_socket, p->ai_addr, static_cast<int>(p->ai_addrlen)) == 0) {
             address_family = p->ai_family; // Store the family
@@ -56,11 +77,33 @@ tcp_server::StartResult tcp_server::start(const std::string& ip, int port) {
         return StartResult::ListenFailed;
     }
 
+    if (backend == Backend::Epoll && startEpoll()) {
+        return StartResult::Success;
+    }
+
     is_running = true;
     server_thread = std::thread(&tcp_server::acceptLoop, this);
     return StartResult::Success;
 }
 
+void tcp_server::setBackend(Backend b, unsigned loop_threads) {
+    backend = b;
+    loop_thread_count = loop_threads > 0 ? loop_threads : 1;
+}
+
+tcp_server::Backend tcp_server::getBackend() const {
+    return backend;
+}
+
+void tcp_server::setSocketOptions(const socket_options& opts) {
+    options = opts;
+}
+
+void tcp_server::setAcceptSharding(bool enable, bool pin_to_cores) {
+    accept_sharding = enable;
+    pin_loops = pin_to_cores;
+}
+
 void tcp_server::setOnConnectCallback(Callback cb) {
     on_connect = std::move(cb);
 }
@@ -73,25 +116,120 @@ void tcp_server::setOnCloseCallback(Callback cb) {
     on_close = std::move(cb);
 }
 
+void tcp_server::setFraming(const framing& f) {
+    frame = f;
+}
+
+void tcp_server::setOnMessageCallback(MessageCallback cb) {
+    on_message = std::move(cb);
+}
+
+// Returns false when the framing is violated (the connection should be dropped)
+bool tcp_server::deliverMessages(int client_socket, frame_decoder& decoder, traffic_counters& counters) {
+    std::string_view msg;
+    frame_decoder::Result r;
+    while ((r = decoder.next(msg)) == frame_decoder::Result::Message) {
+        counters.delivered(1);
+        if (on_message) {
+            on_message(client_socket, msg);
+        }
+        else if (on_receive) {
+            on_receive(client_socket, std::string(msg));
+        }
+    }
+    return r != frame_decoder::Result::Error;
+}
+
 // Changed: Return type is int, returns the return value of send()
 int tcp_server::sendToClient(int client_socket, const std::string& message) {
+    if (!loops.empty()) {
+        auto c = findConnection(client_socket);
+        return c ? queueSend(*c, message, nullptr) : -1;
+    }
     std::lock_guard<std::mutex> lock(send_mutex);
-    return send(client_socket, message.c_str(), static_cast<int>(message.size()), 0); // If the return value is 0 or more, it is success; if negative, it is failure
+    int sent = send(client_socket, message.c_str(), static_cast<int>(message.size()), 0); // If the return value is 0 or more, it is success; if negative, it is failure
+    if (sent > 0) {
+        auto it = traffic.find(client_socket);
+        if (it != traffic.end()) it->second->sent(static_cast<std::size_t>(sent));
+    }
+    return sent;
+}
+
+int tcp_server::sendToClient(int client_socket, SharedBuffer message) {
+    if (!message) return -1;
+    if (!loops.empty()) {
+        auto c = findConnection(client_socket);
+        return c ? queueSend(*c, *message, message) : -1;
+    }
+    return sendToClient(client_socket, *message);
 }
 
 std::vector<int> tcp_server::broadcastToClients(const std::string& message) {
-    std::lock_guard<std::mutex> lock(send_mutex);
     std::vector<int> failed_clients;
+    if (!loops.empty()) {
+        auto shared = std::make_shared<const std::string>(message);
+        std::vector<std::shared_ptr<connection>> targets;
+        {
+            std::lock_guard<std::mutex> lock(send_mutex);
+            targets.reserve(connections.size());
+            for (auto& entry : connections) targets.push_back(entry.second);
+        }
+        // A slow client only affects its own queue
+        for (auto& c : targets) {
+            if (queueSend(*c, *shared, shared) < 0) {
+                failed_clients.push_back(c->fd);
+            }
+        }
+        return failed_clients;
+    }
+
+    std::lock_guard<std::mutex> lock(send_mutex);
     for (int client_socket : client_sockets) {
-        if (send(client_socket, message.c_str(), static_cast<int>(message.size()), 0) < 0) {
+        int sent = send(client_socket, message.c_str(), static_cast<int>(message.size()), 0);
+        if (sent < 0) {
             failed_clients.push_back(client_socket);
+            continue;
         }
+        auto it = traffic.find(client_socket);
+        if (it != traffic.end()) it->second->sent(static_cast<std::size_t>(sent));
     }
     return failed_clients;
 }
 
+void tcp_server::setSendQueueLimit(std::size_t high_watermark, Overflow overflow) {
+    send_high_watermark = high_watermark;
+    send_overflow = overflow;
+}
+
+std::size_t tcp_server::getQueuedBytes(int client_socket) {
+    auto c = findConnection(client_socket);
+    if (!c) return 0;
+    std::lock_guard<std::mutex> lock(c->mutex);
+    return c->queued_bytes + static_cast<std::size_t>(c->queued_file_bytes);
+}
+
 void tcp_server::closeClient(int client_socket) {
+#ifndef _WIN32
+    if (!loops.empty()) {
+        // Epoll: the owning loop sees the shutdown, closes the socket and calls on_close.
+        // A closed connection's number may already belong to another socket, so leave it alone.
+        auto c = findConnection(client_socket);
+        if (!c) return;
+        std::lock_guard<std::mutex> lock(c->mutex);
+        if (!c->closed) {
+            shutdown(c->fd, SHUT_RDWR);
+        }
+        return;
+    }
+#endif
+
     std::lock_guard<std::mutex> lock(send_mutex);
+    auto it = std::find(client_sockets.begin(), client_sockets.end(), client_socket);
+    if (it == client_sockets.end()) {
+        return; // already closed: the number may belong to another socket by now
+    }
+    client_sockets.erase(it);
+    traffic.erase(client_socket);
 #ifdef _WIN32
     closesocket(client_socket);
 #else
@@ -103,11 +241,39 @@ void tcp_server::closeClient(int client_socket) {
 }
 
 void tcp_server::quit() {
+    stopStatsDump();
+    if (!loops.empty()) {
+        stopEpoll();
+        return;
+    }
     if (is_running) {
         is_running = false;
+#ifndef _WIN32
+        // Unblock accept() so that the accept thread can exit
+        if (server_socket >= 0) {
+            shutdown(server_socket, SHUT_RDWR);
+        }
+#endif
         if (server_thread.joinable()) {
             server_thread.join();
         }
+        // close() does not wake a handler blocked in recv(): shut the sockets down and wait for
+        // the handlers to finish, they must not touch this object once quit() has returned
+        {
+            std::lock_guard<std::mutex> lock(send_mutex);
+            for (int client : client_sockets) {
+#ifdef _WIN32
+                shutdown(client, SD_BOTH);
+#else
+                shutdown(client, SHUT_RDWR);
+#endif
+            }
+        }
+        {
+            const std::size_t self = current_handler_owner == this ? 1 : 0; // quit() from a callback
+            std::unique_lock<std::mutex> lock(handler_mutex);
+            handlers_done.wait(lock, [&] { return active_handlers <= self; });
+        }
         for (int client : client_sockets) {
 #ifdef _WIN32
             closesocket(client);
@@ -115,7 +281,11 @@ void tcp_server::quit() {
             close(client);
 #endif
         }
-        client_sockets.clear();
+        {
+            std::lock_guard<std::mutex> lock(send_mutex);
+            client_sockets.clear();
+            traffic.clear();
+        }
         if (server_socket >= 0) {
 #ifdef _WIN32
             closesocket(server_socket);
@@ -132,6 +302,55 @@ std::vector<int> tcp_server::getClientSockets() {
     return client_sockets;
 }
 
+std::size_t tcp_server::getClientCount() {
+    std::lock_guard<std::mutex> lock(send_mutex);
+    return client_sockets.size();
+}
+
+std::shared_ptr<traffic_counters> tcp_server::findTraffic(int client_socket) {
+    std::lock_guard<std::mutex> lock(send_mutex);
+    auto it = traffic.find(client_socket);
+    return it != traffic.end() ? it->second : nullptr;
+}
+
+bool tcp_server::getConnectionStats(int client_socket, connection_stats& out) {
+    auto counters = findTraffic(client_socket);
+    if (!counters) return false;
+    connection_stats s;
+    counters->copy_to(s);
+    if (!loops.empty()) {
+        s.app_queued_bytes = getQueuedBytes(client_socket);
+    }
+
+    // Sample only while the descriptor still belongs to this connection: both backends drop a
+    // client from `traffic` under send_mutex before closing it, and a reused fd gets new counters
+    std::lock_guard<std::mutex> lock(send_mutex);
+    auto it = traffic.find(client_socket);
+    if (it == traffic.end() || it->second != counters) return false;
+    s.sample(client_socket);
+    out = s;
+    return true;
+}
+
+std::vector<connection_stats> tcp_server::getAllConnectionStats() {
+    std::vector<connection_stats> all;
+    for (int client_socket : getClientSockets()) {
+        connection_stats s;
+        if (getConnectionStats(client_socket, s)) {
+            all.push_back(s);
+        }
+    }
+    return all;
+}
+
+bool tcp_server::startStatsDump(std::chrono::milliseconds interval, stats_dumper::Sink sink) {
+    return stats_dump.start(interval, [this] { return getAllConnectionStats(); }, std::move(sink));
+}
+
+void tcp_server::stopStatsDump() {
+    stats_dump.stop();
+}
+
 void tcp_server::acceptLoop() {
     while (is_running) {
         sockaddr_storage client_addr{};  
@@ -152,24 +371,33 @@ void tcp_server::acceptLoop() {
             continue;
         }
 
+        options.apply(static_cast<int>(client_socket));
         {
             std::lock_guard<std::mutex> lock(send_mutex);
             client_sockets.push_back(static_cast<int>(client_socket));
+            traffic[static_cast<int>(client_socket)] = std::make_shared<traffic_counters>();
         }
 
         if (on_connect) {
             on_connect(static_cast<int>(client_socket), "New client connected");
         }
 
+        {
+            std::lock_guard<std::mutex> lock(handler_mutex);
+            ++active_handlers;
+        }
         std::thread(&tcp_server::clientHandler, this, static_cast<int>(client_socket)).detach();
     }
 }
 
 void tcp_server::clientHandler(int client_socket) {
-    char buffer[BUFFER_SIZE] = {};
+    current_handler_owner = this;
+    frame_decoder decoder(frame); // reused for every read of this connection
+    auto counters = findTraffic(client_socket);
+    if (!counters) counters = std::make_shared<traffic_counters>(); // already closed
     while (is_running) {
-        memset(buffer, 0, sizeof(buffer));
-        int bytes_received = recv(client_socket, buffer, sizeof(buffer) - 1, 0);
+        char* buffer = decoder.prepare();
+        int bytes_received = recv(client_socket, buffer, static_cast<int>(decoder.writable()), 0);
         if (bytes_received <= 0) {
 #ifdef _WIN32
             if (bytes_received == SOCKET_ERROR) {
@@ -179,10 +407,19 @@ void tcp_server::clientHandler(int client_socket) {
             closeClient(client_socket);
             break;
         }
-        if (on_receive) {
-            on_receive(client_socket, std::string(buffer));
+        decoder.commit(static_cast<std::size_t>(bytes_received));
+        counters->received(static_cast<std::size_t>(bytes_received));
+        options.rearm_quickack(client_socket);
+        if (!deliverMessages(client_socket, decoder, *counters)) {
+            std::cerr << "Invalid frame from client " << client_socket << "\n";
+            closeClient(client_socket);
+            break;
         }
     }
+
+    std::lock_guard<std::mutex> lock(handler_mutex);
+    --active_handlers;
+    handlers_done.notify_all();
 }
 
 } // namespace j2::network::tcp
@@ -0,0 +1,522 @@
+#include "j2_library/network/tcp/tcp_server.hpp"
+
+#include <algorithm>
+#include <optional>
+
+#ifdef __linux__
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace j2::network::tcp {
+
+#ifdef __linux__
+
+namespace {
+
+bool set_non_blocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+void wake(int wake_fd) {
+    std::uint64_t one = 1;
+    ssize_t r = write(wake_fd, &one, sizeof(one));
+    (void)r;
+}
+
+void pin_to_core(std::thread& t, std::size_t index) {
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(index % cores, &set);
+    if (pthread_setaffinity_np(t.native_handle(), sizeof(set), &set) != 0) {
+        std::cerr << "Failed to pin epoll loop " << index << " to a core\n";
+    }
+}
+
+} // namespace
+
+bool tcp_server::startEpoll() {
+    std::vector<std::unique_ptr<event_loop>> created;
+    bool ok = true;
+
+    for (unsigned i = 0; i < loop_thread_count && ok; ++i) {
+        auto loop = std::make_unique<event_loop>();
+        loop->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        loop->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.fd = loop->wake_fd;
+        if (loop->epoll_fd < 0 || loop->wake_fd < 0 ||
+            epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, loop->wake_fd, &ev) != 0) {
+            perror("epoll setup failed");
+            ok = false;
+        }
+        created.push_back(std::move(loop));
+    }
+
+    if (ok) {
+        created[0]->listen_fd = server_socket;
+    }
+    loops = std::move(created);
+    if (ok && accept_sharding && loops.size() > 1 && !openShardListeners()) {
+        std::cerr << "SO_REUSEPORT listeners unavailable; accepting on one loop\n";
+    }
+
+    // Listening sockets are served edge-triggered by their loop
+    for (std::size_t i = 0; ok && i < loops.size(); ++i) {
+        const int fd = loops[i]->listen_fd;
+        if (fd < 0) continue;
+        epoll_event ev{};
+        ev.events = EPOLLIN | EPOLLET;
+        ev.data.fd = fd;
+        ok = set_non_blocking(fd) && epoll_ctl(loops[i]->epoll_fd, EPOLL_CTL_ADD, fd, &ev) == 0;
+        if (!ok) perror("epoll listen setup failed");
+    }
+
+    if (!ok) {
+        for (auto& loop : loops) {
+            if (loop->epoll_fd >= 0) close(loop->epoll_fd);
+            if (loop->wake_fd >= 0) close(loop->wake_fd);
+            if (loop->listen_fd >= 0 && loop->listen_fd != server_socket) close(loop->listen_fd);
+        }
+        loops.clear();
+        // Fall back to the thread backend with a blocking listening socket
+        int flags = fcntl(server_socket, F_GETFL, 0);
+        if (flags >= 0) fcntl(server_socket, F_SETFL, flags & ~O_NONBLOCK);
+        return false;
+    }
+
+    next_loop = 0;
+    is_running = true;
+    for (std::size_t i = 0; i < loops.size(); ++i) {
+        loops[i]->thread = std::thread(&tcp_server::epollLoop, this, i);
+        if (pin_loops) {
+            pin_to_core(loops[i]->thread, i);
+        }
+    }
+    return true;
+}
+
+// Opens one more SO_REUSEPORT listener per extra loop, bound to the address of server_socket
+// (so that port 0 resolves to the same port). On failure every loop but the first gets none.
+bool tcp_server::openShardListeners() {
+    sockaddr_storage addr{};
+    socklen_t len = sizeof(addr);
+    bool ok = getsockname(server_socket, reinterpret_cast<sockaddr*>(&addr), &len) == 0;
+
+    for (std::size_t i = 1; ok && i < loops.size(); ++i) {
+        int fd = socket(addr.ss_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd >= 0) {
+            options.apply(fd);
+        }
+        int opt = 1;
+        if (fd < 0 ||
+            setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt)) != 0 ||
+            setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &opt, sizeof(opt)) != 0 ||
+            bind(fd, reinterpret_cast<sockaddr*>(&addr), len) != 0 ||
+            listen(fd, SOMAXCONN) != 0) {
+            perror("SO_REUSEPORT listener failed");
+            if (fd >= 0) close(fd);
+            ok = false;
+            break;
+        }
+        loops[i]->listen_fd = fd;
+    }
+
+    if (!ok) {
+        for (std::size_t i = 1; i < loops.size(); ++i) {
+            if (loops[i]->listen_fd >= 0) close(loops[i]->listen_fd);
+            loops[i]->listen_fd = -1;
+        }
+    }
+    return ok;
+}
+
+void tcp_server::stopEpoll() {
+    if (loops.empty()) return;
+
+    is_running = false;
+    for (auto& loop : loops) {
+        wake(loop->wake_fd);
+    }
+    for (auto& loop : loops) {
+        if (loop->thread.joinable()) {
+            loop->thread.join();
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(send_mutex);
+        for (auto& entry : connections) {
+            std::lock_guard<std::mutex> conn_lock(entry.second->mutex);
+            entry.second->closed = true;
+        }
+        connections.clear();
+        for (int client : client_sockets) {
+            close(client);
+        }
+        client_sockets.clear();
+        traffic.clear();
+    }
+
+    for (auto& loop : loops) {
+        // Clients accepted but never registered
+        for (int client : loop->pending) {
+            close(client);
+        }
+        close(loop->epoll_fd);
+        close(loop->wake_fd);
+        if (loop->listen_fd >= 0 && loop->listen_fd != server_socket) {
+            close(loop->listen_fd);
+        }
+    }
+    loops.clear();
+
+    if (server_socket >= 0) {
+        close(server_socket);
+        server_socket = -1;
+    }
+}
+
+void tcp_server::epollLoop(std::size_t index) {
+    event_loop& loop = *loops[index];
+    std::vector<epoll_event> events(256);
+
+    while (is_running) {
+        int n = epoll_wait(loop.epoll_fd, events.data(), static_cast<int>(events.size()), -1);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            perror("epoll_wait failed");
+            break;
+        }
+
+        const auto ready = static_cast<std::size_t>(n);
+        for (std::size_t i = 0; i < ready && is_running; ++i) {
+            const int fd = events[i].data.fd;
+            const std::uint32_t ev = events[i].events;
+
+            if (fd == loop.wake_fd) {
+                std::uint64_t count = 0;
+                while (read(loop.wake_fd, &count, sizeof(count)) > 0) {}
+                adoptPendingClients(loop);
+                continue;
+            }
+            if (fd == loop.listen_fd) {
+                acceptClients(loop);
+                continue;
+            }
+
+            if (ev & EPOLLOUT) {
+                auto c = findConnection(fd);
+                if (c && !flushConnection(*c)) {
+                    closeEpollClient(loop, fd, "Client disconnected");
+                    continue;
+                }
+            }
+            if (ev & EPOLLIN) {
+                if (!readClient(loop, fd)) {
+                    closeEpollClient(loop, fd, "Client disconnected");
+                    continue;
+                }
+            }
+            if (ev & (EPOLLHUP | EPOLLERR)) {
+                closeEpollClient(loop, fd, "Client disconnected");
+            }
+        }
+
+        // Grow the event array when a wait filled it completely
+        if (n == static_cast<int>(events.size()) && events.size() < 4096) {
+            events.resize(events.size() * 2);
+        }
+    }
+}
+
+void tcp_server::acceptClients(event_loop& loop) {
+    const bool sharded = loops.size() > 1 && loops[1]->listen_fd >= 0;
+
+    while (is_running) {
+        sockaddr_storage client_addr{};
+        socklen_t client_len = sizeof(client_addr);
+        int client_socket = accept4(loop.listen_fd, reinterpret_cast<sockaddr*>(&client_addr), &client_len,
+            SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (client_socket < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                perror("Accept failed");
+            }
+            return;
+        }
+
+        // Sharded: keep the client. Otherwise round-robin over the loops; the owning loop
+        // registers the client and calls on_connect.
+        event_loop& target = sharded ? loop : *loops[next_loop];
+        if (!sharded) {
+            next_loop = (next_loop + 1) % loops.size();
+        }
+        {
+            std::lock_guard<std::mutex> lock(target.pending_mutex);
+            target.pending.push_back(client_socket);
+        }
+        if (&target == &loop) {
+            adoptPendingClients(target);
+        }
+        else {
+            wake(target.wake_fd);
+        }
+    }
+}
+
+void tcp_server::adoptPendingClients(event_loop& loop) {
+    std::vector<int> adopted;
+    {
+        std::lock_guard<std::mutex> lock(loop.pending_mutex);
+        adopted.swap(loop.pending);
+    }
+
+    for (int client_socket : adopted) {
+        options.apply(client_socket);
+
+        // Registered before on_connect so that the callback can already send
+        epoll_event ev{};
+        ev.events = EPOLLIN | EPOLLRDHUP | EPOLLET;
+        ev.data.fd = client_socket;
+        if (epoll_ctl(loop.epoll_fd, EPOLL_CTL_ADD, client_socket, &ev) != 0) {
+            perror("epoll_ctl add client failed");
+            close(client_socket);
+            continue;
+        }
+
+        auto c = std::make_shared<connection>();
+        c->fd = client_socket;
+        c->epoll_fd = loop.epoll_fd;
+        c->traffic = std::make_shared<traffic_counters>();
+        loop.traffic[client_socket] = c->traffic;
+        {
+            std::lock_guard<std::mutex> lock(send_mutex);
+            client_sockets.push_back(client_socket);
+            traffic[client_socket] = c->traffic;
+            connections[client_socket] = std::move(c);
+        }
+        if (frame.mode != framing::Mode::None) {
+            loop.decoders.emplace(client_socket, frame_decoder(frame, 4096));
+        }
+
+        if (on_connect) {
+            on_connect(client_socket, "New client connected");
+        }
+    }
+}
+
+// Edge-triggered: read until the socket is drained. Returns false when the peer closed, failed
+// or violated the framing. Unframed clients share the loop buffer; framed clients keep their own
+// so that partial messages survive between reads.
+bool tcp_server::readClient(event_loop& loop, int client_socket) {
+    auto it = loop.decoders.find(client_socket);
+    frame_decoder& decoder = it != loop.decoders.end() ? it->second : loop.shared;
+    auto found = loop.traffic.find(client_socket);
+    if (found == loop.traffic.end()) return false;
+    traffic_counters& counters = *found->second;
+
+    while (true) {
+        char* buffer = decoder.prepare();
+        ssize_t n = recv(client_socket, buffer, decoder.writable(), 0);
+        if (n > 0) {
+            decoder.commit(static_cast<std::size_t>(n));
+            counters.received(static_cast<std::size_t>(n));
+            if (!deliverMessages(client_socket, decoder, counters)) {
+                std::cerr << "Invalid frame from client " << client_socket << "\n";
+                return false;
+            }
+            continue;
+        }
+        if (n == 0) return false;
+        if (errno == EINTR) continue;
+        if (errno != EAGAIN && errno != EWOULDBLOCK) return false;
+        options.rearm_quickack(client_socket);
+        return true;
+    }
+}
+
+// on_close is called before the descriptor is released so that it cannot be reused in between
+void tcp_server::closeEpollClient(event_loop& loop, int client_socket, const std::string& reason) {
+    loop.decoders.erase(client_socket);
+    loop.traffic.erase(client_socket);
+    std::shared_ptr<connection> c;
+    {
+        std::lock_guard<std::mutex> lock(send_mutex);
+        auto it = std::find(client_sockets.begin(), client_sockets.end(), client_socket);
+        if (it == client_sockets.end()) return;
+        client_sockets.erase(it);
+        traffic.erase(client_socket);
+
+        auto found = connections.find(client_socket);
+        if (found != connections.end()) {
+            c = std::move(found->second);
+            connections.erase(found);
+        }
+    }
+    if (c) {
+        // Senders that still hold the connection see it closed and never touch the descriptor again
+        std::lock_guard<std::mutex> lock(c->mutex);
+        c->closed = true;
+        c->queue.clear();
+        c->queued_bytes = 0;
+    }
+    if (on_close) {
+        on_close(client_socket, reason);
+    }
+    close(client_socket); // also removes it from the epoll set
+}
+
+std::shared_ptr<tcp_server::connection> tcp_server::findConnection(int client_socket) {
+    std::lock_guard<std::mutex> lock(send_mutex);
+    auto it = connections.find(client_socket);
+    return it != connections.end() ? it->second : nullptr;
+}
+
+// Writes directly while nothing is queued; whatever the socket does not take is queued and
+// flushed by the owning loop. `owner`, when set, holds `data` and is queued without copying.
+int tcp_server::queueSend(connection& c, std::string_view data, const SharedBuffer& owner) {
+    std::unique_lock<std::mutex> lock(c.mutex);
+    if (c.closed) return -1;
+
+    std::size_t sent = 0;
+    if (c.queue.empty()) {
+        while (sent < data.size()) {
+            ssize_t n = send(c.fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL | MSG_DONTWAIT);
+            if (n > 0) {
+                sent += static_cast<std::size_t>(n);
+                continue;
+            }
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+            shutdown(c.fd, SHUT_RDWR); // the owning loop closes it
+            return -1;
+        }
+        if (sent == data.size()) {
+            c.traffic->sent(data.size());
+            return static_cast<int>(sent);
+        }
+    }
+
+    const std::size_t rest = data.size() - sent;
+    if (c.queued_bytes + rest > send_high_watermark) {
+        if (send_overflow == Overflow::Disconnect) {
+            shutdown(c.fd, SHUT_RDWR);
+            return -1;
+        }
+        // Reject, unless part of the message already went out (the stream must stay intact)
+        if (sent == 0) return -1;
+    }
+
+    connection::chunk chunk;
+    if (owner) {
+        chunk.data = owner;
+        chunk.offset = sent;
+    }
+    else {
+        chunk.data = std::make_shared<const std::string>(data.substr(sent));
+    }
+    c.queue.push_back(std::move(chunk));
+    c.queued_bytes += rest;
+    updateInterest(c);
+    c.traffic->sent(data.size());
+    return static_cast<int>(data.size());
+}
+
+// Called by the owning loop on EPOLLOUT. Returns false when the connection failed.
+bool tcp_server::flushConnection(connection& c) {
+    std::lock_guard<std::mutex> lock(c.mutex);
+    if (c.closed) return true;
+
+    std::optional<sigpipe_guard> pipe_guard; // built on the first file chunk of this flush
+    while (!c.queue.empty()) {
+        auto& head = c.queue.front();
+        if (head.file) {
+            if (!pipe_guard) pipe_guard.emplace();
+            const std::uint64_t before = head.file_remaining;
+            const int r = sendFileChunk(c.fd, head);
+            c.queued_file_bytes -= before - head.file_remaining;
+            if (r < 0) return false;
+            if (r == 0) break;
+            c.queue.pop_front();
+            continue;
+        }
+
+        // Coalesce queued chunks (up to the next file chunk) into one gathered write
+        iovec iov[64];
+        int count = 0;
+        for (auto it = c.queue.begin(); it != c.queue.end() && !it->file && count < 64; ++it, ++count) {
+            iov[count].iov_base = const_cast<char*>(it->data->data() + it->offset);
+            iov[count].iov_len = it->data->size() - it->offset;
+        }
+
+        // sendmsg is writev with MSG_NOSIGNAL (no SIGPIPE on a reset connection)
+        msghdr msg{};
+        msg.msg_iov = iov;
+        msg.msg_iovlen = static_cast<std::size_t>(count);
+        ssize_t n = sendmsg(c.fd, &msg, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            return false;
+        }
+
+        std::size_t written = static_cast<std::size_t>(n);
+        c.queued_bytes -= written;
+        while (written > 0) {
+            auto& front = c.queue.front();
+            const std::size_t left = front.data->size() - front.offset;
+            if (written < left) {
+                front.offset += written;
+                break;
+            }
+            written -= left;
+            c.queue.pop_front();
+        }
+    }
+
+    updateInterest(c);
+    return true;
+}
+
+// Arms EPOLLOUT while data is queued. Called with c.mutex held.
+void tcp_server::updateInterest(connection& c) {
+    const bool want = !c.queue.empty();
+    if (want == c.want_write) return;
+
+    epoll_event ev{};
+    ev.events = EPOLLIN | EPOLLRDHUP | EPOLLET | (want ? EPOLLOUT : 0u);
+    ev.data.fd = c.fd;
+    if (epoll_ctl(c.epoll_fd, EPOLL_CTL_MOD, c.fd, &ev) == 0) {
+        c.want_write = want;
+    }
+}
+
+#else // !__linux__
+
+bool tcp_server::startEpoll() { return false; }
+void tcp_server::stopEpoll() {}
+void tcp_server::epollLoop(std::size_t) {}
+void tcp_server::acceptClients(event_loop&) {}
+bool tcp_server::openShardListeners() { return false; }
+void tcp_server::adoptPendingClients(event_loop&) {}
+bool tcp_server::readClient(event_loop&, int) { return false; }
+void tcp_server::closeEpollClient(event_loop&, int, const std::string&) {}
+std::shared_ptr<tcp_server::connection> tcp_server::findConnection(int) { return nullptr; }
+int tcp_server::queueSend(connection&, std::string_view, const SharedBuffer&) { return -1; }
+bool tcp_server::flushConnection(connection&) { return false; }
+void tcp_server::updateInterest(connection&) {}
+
+#endif // __linux__
+
+} // namespace j2::network::tcp
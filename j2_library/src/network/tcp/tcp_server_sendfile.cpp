@@ -0,0 +1,190 @@
+#include "j2_library/network/tcp/tcp_server.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+#ifdef __linux__
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/sendfile.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#endif
+
+namespace j2::network::tcp {
+
+#ifdef __linux__
+
+tcp_server::sigpipe_guard::sigpipe_guard() {
+    sigemptyset(&pipe_set);
+    sigaddset(&pipe_set, SIGPIPE);
+    sigset_t pending;
+    sigpending(&pending);
+    was_pending = sigismember(&pending, SIGPIPE) == 1;
+    blocked = pthread_sigmask(SIG_BLOCK, &pipe_set, &old_set) == 0;
+}
+
+tcp_server::sigpipe_guard::~sigpipe_guard() {
+    if (!blocked) return;
+    sigset_t pending;
+    sigpending(&pending);
+    if (!was_pending && sigismember(&pending, SIGPIPE) == 1) {
+        timespec zero{ 0, 0 };
+        sigtimedwait(&pipe_set, nullptr, &zero);
+    }
+    pthread_sigmask(SIG_SETMASK, &old_set, nullptr);
+}
+
+tcp_server::file_source::~file_source() {
+    if (fd >= 0) close(fd);
+}
+
+std::int64_t tcp_server::sendFileToClient(int client_socket, const std::string& path,
+    std::uint64_t offset, std::uint64_t length) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        perror("Open file failed");
+        return -1;
+    }
+    return queueFile(client_socket, std::make_shared<file_source>(fd), offset, length);
+}
+
+std::int64_t tcp_server::sendFileToClient(int client_socket, int file_fd,
+    std::uint64_t offset, std::uint64_t length) {
+    // The queued chunk may outlive the caller's descriptor
+    int fd = fcntl(file_fd, F_DUPFD_CLOEXEC, 0);
+    if (fd < 0) {
+        perror("Duplicate file descriptor failed");
+        return -1;
+    }
+    return queueFile(client_socket, std::make_shared<file_source>(fd), offset, length);
+}
+
+std::int64_t tcp_server::queueFile(int client_socket, std::shared_ptr<file_source> file,
+    std::uint64_t offset, std::uint64_t length) {
+    struct stat st{};
+    if (fstat(file->fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        std::cerr << "sendFileToClient: not a regular file\n";
+        return -1;
+    }
+    const std::uint64_t size = static_cast<std::uint64_t>(st.st_size);
+    if (offset > size) return -1;
+    if (length == 0 || length > size - offset) {
+        length = size - offset;
+    }
+    if (length == 0) return 0;
+
+    connection::chunk chunk;
+    chunk.file = std::move(file);
+    chunk.file_offset = offset;
+    chunk.file_remaining = length;
+
+    if (loops.empty()) {
+        // Thread backend: keep the existing send serialization and block until sent
+        std::lock_guard<std::mutex> lock(send_mutex);
+        const int flags = fcntl(client_socket, F_GETFL);
+        const bool nonblocking = flags >= 0 && (flags & O_NONBLOCK) != 0;
+        sigpipe_guard guard;
+        while (chunk.file_remaining > 0) {
+            const int r = sendFileChunk(client_socket, chunk);
+            if (r < 0) return -1;
+            if (r > 0) break;
+            // Would block: a blocking socket only reports that once SO_SNDTIMEO expired
+            if (!nonblocking) return -1;
+            pollfd pfd{ client_socket, POLLOUT, 0 };
+            while (poll(&pfd, 1, -1) < 0) {
+                if (errno != EINTR) return -1;
+            }
+        }
+        auto it = traffic.find(client_socket);
+        if (it != traffic.end()) it->second->sent(static_cast<std::size_t>(length));
+        return static_cast<std::int64_t>(length);
+    }
+
+    auto c = findConnection(client_socket);
+    if (!c) return -1;
+    std::lock_guard<std::mutex> lock(c->mutex);
+    if (c->closed) return -1;
+
+    if (c->queue.empty()) {
+        sigpipe_guard guard;
+        if (sendFileChunk(c->fd, chunk) < 0) {
+            shutdown(c->fd, SHUT_RDWR); // the owning loop closes it
+            return -1;
+        }
+    }
+    c->traffic->sent(static_cast<std::size_t>(length));
+    if (chunk.file_remaining == 0) {
+        return static_cast<std::int64_t>(length);
+    }
+
+    c->queued_file_bytes += chunk.file_remaining;
+    c->queue.push_back(std::move(chunk));
+    updateInterest(*c);
+    return static_cast<std::int64_t>(length);
+}
+
+// Sends from the file until the chunk is done or the socket is full.
+// Returns 1 when done, 0 when the socket would block, -1 on error (or if the file shrank).
+// The caller holds a sigpipe_guard, built once per file send or flush rather than per chunk.
+int tcp_server::sendFileChunk(int client_socket, connection::chunk& chunk) {
+    while (chunk.file_remaining > 0) {
+        off_t off = static_cast<off_t>(chunk.file_offset);
+        const std::size_t want = static_cast<std::size_t>(
+            std::min<std::uint64_t>(chunk.file_remaining, 1u << 30));
+        ssize_t n = sendfile(client_socket, chunk.file->fd, &off, want);
+        if (n > 0) {
+            chunk.file_offset += static_cast<std::uint64_t>(n);
+            chunk.file_remaining -= static_cast<std::uint64_t>(n);
+            continue;
+        }
+        if (n == 0) return -1;
+        if (errno == EINTR) continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) return 0;
+        return -1;
+    }
+    return 1;
+}
+
+#else // !__linux__
+
+tcp_server::file_source::~file_source() {}
+
+// No sendfile here: read the range and send it through the regular path
+std::int64_t tcp_server::sendFileToClient(int client_socket, const std::string& path,
+    std::uint64_t offset, std::uint64_t length) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return -1;
+    in.seekg(static_cast<std::streamoff>(offset));
+    if (!in) return -1;
+
+    std::int64_t total = 0;
+    std::string buffer(64 * 1024, '\0');
+    while (length == 0 || static_cast<std::uint64_t>(total) < length) {
+        std::size_t want = buffer.size();
+        if (length != 0) {
+            want = static_cast<std::size_t>(std::min<std::uint64_t>(want, length - total));
+        }
+        in.read(&buffer[0], static_cast<std::streamsize>(want));
+        const std::streamsize got = in.gcount();
+        if (got <= 0) break;
+        if (sendToClient(client_socket, buffer.substr(0, static_cast<std::size_t>(got))) < 0) return -1;
+        total += got;
+    }
+    return total;
+}
+
+std::int64_t tcp_server::sendFileToClient(int, int, std::uint64_t, std::uint64_t) {
+    std::cerr << "sendFileToClient(fd) is not supported on this platform\n";
+    return -1;
+}
+
+std::int64_t tcp_server::queueFile(int, std::shared_ptr<file_source>, std::uint64_t, std::uint64_t) { return -1; }
+int tcp_server::sendFileChunk(int, connection::chunk&) { return -1; }
+
+#endif // __linux__
+
+} // namespace j2::network::tcp
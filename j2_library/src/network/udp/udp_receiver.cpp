@@ -3,13 +3,47 @@
 
 #include <iostream>
 #include <cstring>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
 
 #ifdef _WIN32
 #include <mswsock.h>
 #endif
 
+#ifdef __linux__
+#include <cerrno>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif
+
 namespace j2::network::udp {
 
+#ifdef __linux__
+namespace {
+
+constexpr std::size_t TIMESTAMP_CONTROL_SIZE = CMSG_SPACE(sizeof(timespec));
+static_assert(TIMESTAMP_CONTROL_SIZE % sizeof(cmsghdr) == 0, "control buffers are carved from a cmsghdr array");
+
+// SCM_TIMESTAMPNS of a received message; false when it carries none
+bool read_kernel_time(msghdr& msg, std::chrono::system_clock::time_point& out) {
+    for (cmsghdr* cm = CMSG_FIRSTHDR(&msg); cm != nullptr; cm = CMSG_NXTHDR(&msg, cm)) {
+        if (cm->cmsg_level == SOL_SOCKET && cm->cmsg_type == SCM_TIMESTAMPNS) {
+            timespec ts{};
+            memcpy(&ts, CMSG_DATA(cm), sizeof(ts));
+            out = std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec)));
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+#endif
+
 udp_receiver::udp_receiver(IpVersion version)
     : is_running(false), server_socket(-1),
       receiver_ip(""), receiver_port(0), udpType(UdpType::None),
@@ -17,6 +51,14 @@ udp_receiver::udp_receiver(IpVersion version)
       enable_reuse_port(true), ip_version(version) {
 }
 
+udp_receiver::udp_receiver(IpVersion version, const socket_options& opts) : udp_receiver(version) {
+    options = opts;
+}
+
+void udp_receiver::setSocketOptions(const socket_options& opts) {
+    options = opts;
+}
+
 void udp_receiver::setIpVersion(IpVersion version) {
     ip_version = version;
     any_address = (version == IpVersion::IPv4) ? "0.0.0.0" : "::";
@@ -30,6 +72,29 @@ void udp_receiver::setEnableReusePort(bool enable) {
     enable_reuse_port = enable;
 }
 
+void udp_receiver::setEnableReusePortSharing(bool enable) {
+    enable_reuse_port_sharing = enable;
+}
+
+void udp_receiver::setCpuAffinity(int core) {
+    cpu_affinity = core;
+}
+
+unsigned short udp_receiver::getLocalPort() const {
+    if (server_socket < 0) {
+        return 0;
+    }
+    sockaddr_storage addr{};
+    socklen_t len = sizeof(addr);
+    if (getsockname(server_socket, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+        return 0;
+    }
+    if (addr.ss_family == AF_INET6) {
+        return ntohs(reinterpret_cast<const sockaddr_in6&>(addr).sin6_port);
+    }
+    return ntohs(reinterpret_cast<const sockaddr_in&>(addr).sin_port);
+}
+
 void udp_receiver::setAnyAddress(const std::string anyAddr) {
     any_address = anyAddr;
 }
@@ -95,6 +160,40 @@ bool udp_receiver::start(const std::string& ip, const unsigned short port,
         }
     }
 
+    if (enable_reuse_port_sharing) {
+#ifdef SO_REUSEPORT
+        int reuse = 1;
+        if (setsockopt(server_socket, SOL_SOCKET, SO_REUSEPORT, (const char*)&reuse, sizeof(reuse)) < 0) {
+            perror("Failed to set SO_REUSEPORT");
+            close(server_socket);
+            server_socket = -1;
+            return false;
+        }
+#else
+        std::cerr << "SO_REUSEPORT is not supported on this platform" << std::endl;
+#ifdef _WIN32
+        closesocket(server_socket);
+#else
+        close(server_socket);
+#endif
+        server_socket = -1;
+        return false;
+#endif
+    }
+
+    options.apply(server_socket);
+
+    if (kernel_timestamps) {
+#if defined(__linux__) && defined(SO_TIMESTAMPNS)
+        int on = 1;
+        if (setsockopt(server_socket, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on)) < 0) {
+            perror("Failed to enable SO_TIMESTAMPNS");
+        }
+#else
+        std::cerr << "Kernel receive timestamps are not supported on this platform" << std::endl;
+#endif
+    }
+
     if (enable_broadcast && ip_version == IpVersion::IPv4) {
         int broadcast = 1;
         if (setsockopt(server_socket, SOL_SOCKET, SO_BROADCAST, (const char*)&broadcast, sizeof(broadcast)) < 0) {
@@ -194,7 +293,24 @@ bool udp_receiver::start(const std::string& ip, const unsigned short port,
     }
 
     is_running = true;
-    receiver_thread = std::thread(&udp_receiver::receiveLoop, this);
+    if (on_batch) {
+        receiver_thread = std::thread(&udp_receiver::receiveBatchLoop, this);
+    } else if (kernel_timestamps) {
+        receiver_thread = std::thread(&udp_receiver::receiveTimestampLoop, this);
+    } else {
+        receiver_thread = std::thread(&udp_receiver::receiveLoop, this);
+    }
+
+#ifdef __linux__
+    if (cpu_affinity >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu_affinity, &set);
+        if (pthread_setaffinity_np(receiver_thread.native_handle(), sizeof(set), &set) != 0) {
+            std::cerr << "Failed to pin receive thread to core " << cpu_affinity << std::endl;
+        }
+    }
+#endif
 
     return true;
 }
@@ -203,9 +319,32 @@ void udp_receiver::setOnReceiveCallback(Callback cb) {
     on_receive = std::move(cb);
 }
 
+void udp_receiver::setBatchMode(std::size_t size, std::size_t buffer_size) {
+    batch_size = std::max<std::size_t>(size, 1);
+    batch_buffer_size = std::clamp<std::size_t>(buffer_size, 1, MAX_DATAGRAM_SIZE);
+}
+
+void udp_receiver::setOnBatchCallback(BatchCallback cb) {
+    on_batch = std::move(cb);
+}
+
+void udp_receiver::setEnableKernelTimestamps(bool enable) {
+    kernel_timestamps = enable;
+}
+
+void udp_receiver::setOnReceiveTimestampedCallback(TimestampedCallback cb) {
+    on_receive_timestamped = std::move(cb);
+}
+
 void udp_receiver::quit() {
     if (is_running) {
         is_running = false;
+#ifndef _WIN32
+        // Wake the receive thread blocked in recvfrom/recvmmsg
+        if (server_socket >= 0) {
+            shutdown(server_socket, SHUT_RDWR);
+        }
+#endif
         if (receiver_thread.joinable()) {
             receiver_thread.join();
         }
@@ -222,19 +361,23 @@ void udp_receiver::quit() {
 }
 
 void udp_receiver::receiveLoop() {
-    char buffer[BUFFER_SIZE];
+    std::vector<char> storage(BUFFER_SIZE);
+    char* buffer = storage.data();
 
     if (ip_version == IpVersion::IPv4) {
         sockaddr_in client_addr {};
         socklen_t client_len = sizeof(client_addr);
 
         while (is_running) {
-            memset(buffer, 0, sizeof(buffer));
+            client_len = sizeof(client_addr);
             int bytes_received = recvfrom(server_socket,
-                                          buffer, sizeof(buffer) - 1,
+                                          buffer, BUFFER_SIZE,
                                           0,
                                           (struct sockaddr*)&client_addr,
                                           &client_len);
+            if (!is_running) {
+                break;
+            }
 
             if (bytes_received < 0) {
                 if (is_running) {
@@ -256,12 +399,15 @@ void udp_receiver::receiveLoop() {
         socklen_t client_len6 = sizeof(client_addr6);
 
         while (is_running) {
-            memset(buffer, 0, sizeof(buffer));
+            client_len6 = sizeof(client_addr6);
             int bytes_received = recvfrom(server_socket,
-                                          buffer, sizeof(buffer) - 1,
+                                          buffer, BUFFER_SIZE,
                                           0,
                                           (struct sockaddr*)&client_addr6,
                                           &client_len6);
+            if (!is_running) {
+                break;
+            }
 
             if (bytes_received < 0) {
                 if (is_running) {
@@ -281,5 +427,154 @@ void udp_receiver::receiveLoop() {
     }
 }
 
+// Per-packet receive with recvmsg so that the SO_TIMESTAMPNS control message comes along
+void udp_receiver::receiveTimestampLoop() {
+#ifdef __linux__
+    std::vector<char> storage(BUFFER_SIZE);
+    alignas(cmsghdr) char control[TIMESTAMP_CONTROL_SIZE];
+
+    while (is_running) {
+        sockaddr_storage from{};
+        iovec iov{ storage.data(), storage.size() };
+        msghdr msg{};
+        msg.msg_name = &from;
+        msg.msg_namelen = sizeof(from);
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        ssize_t bytes_received = recvmsg(server_socket, &msg, 0);
+        if (!is_running) {
+            break;
+        }
+        if (bytes_received < 0) {
+            if (errno != EINTR) {
+                perror("Receive failed");
+            }
+            continue;
+        }
+
+        std::chrono::system_clock::time_point kernel_time{};
+        if (read_kernel_time(msg, kernel_time)) {
+            const auto delay = std::chrono::system_clock::now() - kernel_time;
+            kernel_delay.record(static_cast<std::uint64_t>(std::max<std::int64_t>(
+                0, std::chrono::duration_cast<std::chrono::nanoseconds>(delay).count())));
+        }
+
+        char client_ip[INET6_ADDRSTRLEN] = {};
+        uint16_t client_port = 0;
+        if (from.ss_family == AF_INET6) {
+            const auto& a6 = reinterpret_cast<const sockaddr_in6&>(from);
+            inet_ntop(AF_INET6, &a6.sin6_addr, client_ip, INET6_ADDRSTRLEN);
+            client_port = ntohs(a6.sin6_port);
+        } else {
+            const auto& a4 = reinterpret_cast<const sockaddr_in&>(from);
+            inet_ntop(AF_INET, &a4.sin_addr, client_ip, INET6_ADDRSTRLEN);
+            client_port = ntohs(a4.sin_port);
+        }
+
+        std::string data(storage.data(), static_cast<std::size_t>(bytes_received));
+        if (on_receive_timestamped) {
+            on_receive_timestamped(data, std::string(client_ip), client_port, kernel_time);
+        } else if (on_receive) {
+            on_receive(data, std::string(client_ip), client_port);
+        }
+    }
+#else
+    receiveLoop();
+#endif
+}
+
+// Datagrams land directly in the pool buffers and their source addresses directly in the
+// datagram entries, so a batch costs one syscall and no allocation.
+void udp_receiver::receiveBatchLoop() {
+    const std::size_t count = batch_size;
+    const std::size_t buffer_size = batch_buffer_size;
+    std::vector<std::byte> pool(count * buffer_size);
+    std::vector<datagram> packets(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        packets[i].data = pool.data() + i * buffer_size;
+    }
+
+#ifdef __linux__
+    std::vector<iovec> iovs(count);
+    std::vector<mmsghdr> msgs(count);
+    // One timestamp control buffer per message (cmsghdr-aligned: the size is a multiple of it)
+    std::vector<cmsghdr> controls(kernel_timestamps ? count * TIMESTAMP_CONTROL_SIZE / sizeof(cmsghdr) : 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        iovs[i].iov_base = pool.data() + i * buffer_size;
+        iovs[i].iov_len = buffer_size;
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_name = &packets[i].from;
+        if (kernel_timestamps) {
+            msgs[i].msg_hdr.msg_control = reinterpret_cast<char*>(controls.data()) + i * TIMESTAMP_CONTROL_SIZE;
+        }
+    }
+
+    while (is_running) {
+        for (auto& m : msgs) {
+            m.msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+            if (kernel_timestamps) {
+                m.msg_hdr.msg_controllen = TIMESTAMP_CONTROL_SIZE;
+            }
+        }
+        // Blocks for the first datagram, then takes whatever else is already queued
+        int n = recvmmsg(server_socket, msgs.data(), static_cast<unsigned>(count), MSG_WAITFORONE, nullptr);
+        if (!is_running) {
+            break;
+        }
+        if (n < 0) {
+            if (errno != EINTR) {
+                perror("Receive failed");
+            }
+            continue;
+        }
+
+        const auto received = static_cast<std::size_t>(n);
+        for (std::size_t i = 0; i < received; ++i) {
+            packets[i].size = msgs[i].msg_len;
+            packets[i].truncated = (msgs[i].msg_hdr.msg_flags & MSG_TRUNC) != 0;
+            packets[i].from_len = msgs[i].msg_hdr.msg_namelen;
+            packets[i].kernel_time = {}; // slots are reused: no stale time when a datagram carries none
+        }
+        if (kernel_timestamps) {
+            const auto now = std::chrono::system_clock::now();
+            for (std::size_t i = 0; i < received; ++i) {
+                if (read_kernel_time(msgs[i].msg_hdr, packets[i].kernel_time)) {
+                    kernel_delay.record(static_cast<std::uint64_t>(std::max<std::int64_t>(
+                        0, std::chrono::duration_cast<std::chrono::nanoseconds>(now - packets[i].kernel_time).count())));
+                }
+            }
+        }
+        if (on_batch) {
+            on_batch(datagram_batch{ packets.data(), received });
+        }
+    }
+#else
+    // No recvmmsg: batches of one, still without per-packet allocations
+    while (is_running) {
+        datagram& p = packets[0];
+        p.from_len = sizeof(sockaddr_storage);
+        int bytes_received = recvfrom(server_socket, reinterpret_cast<char*>(pool.data()),
+                                      static_cast<int>(buffer_size), 0,
+                                      reinterpret_cast<sockaddr*>(&p.from), &p.from_len);
+        if (!is_running) {
+            break;
+        }
+        if (bytes_received < 0) {
+            perror("Receive failed");
+            continue;
+        }
+        p.size = static_cast<std::size_t>(bytes_received);
+        p.truncated = false;
+        if (on_batch) {
+            on_batch(datagram_batch{ packets.data(), 1 });
+        }
+    }
+#endif
+}
+
 }  // namespace j2::network::udp
 
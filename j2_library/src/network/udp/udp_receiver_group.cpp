@@ -0,0 +1,121 @@
+
+#include "j2_library/network/udp/udp_receiver_group.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+
+#ifdef __linux__
+#include <sys/socket.h>
+#include <linux/filter.h>
+#endif
+
+namespace j2::network::udp {
+
+udp_receiver_group::udp_receiver_group(std::size_t count, udp_receiver::IpVersion version)
+    : ip_version(version) {
+    if (count == 0) {
+        count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        receivers.push_back(std::make_unique<udp_receiver>(version));
+    }
+}
+
+udp_receiver_group::~udp_receiver_group() {
+    quit();
+}
+
+void udp_receiver_group::setSocketOptions(const socket_options& opts) {
+    options = opts;
+}
+
+void udp_receiver_group::setPinToCores(bool enable) {
+    pin_to_cores = enable;
+}
+
+void udp_receiver_group::setSteering(Steering s) {
+    steering = s;
+}
+
+void udp_receiver_group::setBatchMode(std::size_t size, std::size_t buffer_size) {
+    batch_size = size;
+    batch_buffer_size = buffer_size;
+}
+
+void udp_receiver_group::setOnReceiveCallback(Callback cb) {
+    on_receive = std::move(cb);
+}
+
+void udp_receiver_group::setOnBatchCallback(BatchCallback cb) {
+    on_batch = std::move(cb);
+}
+
+bool udp_receiver_group::start(const std::string& ip, unsigned short port) {
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+
+    for (std::size_t i = 0; i < receivers.size(); ++i) {
+        udp_receiver& r = *receivers[i];
+        r.setSocketOptions(options);
+        r.setEnableReusePortSharing(true);
+        r.setCpuAffinity(pin_to_cores ? static_cast<int>(i % cores) : -1);
+        if (on_batch) {
+            r.setBatchMode(batch_size, batch_buffer_size);
+            r.setOnBatchCallback([this, i](const datagram_batch& batch) { on_batch(i, batch); });
+        } else {
+            r.setOnReceiveCallback([this, i](const std::string& data, const std::string& from, uint16_t from_port) {
+                if (on_receive) {
+                    on_receive(i, data, from, from_port);
+                }
+            });
+        }
+
+        // Port 0: the first receiver picks the port, the others join it
+        if (!r.startUnicast(ip, port)) {
+            quit();
+            return false;
+        }
+        if (port == 0) {
+            port = r.getLocalPort();
+        }
+    }
+
+    if (steering != Steering::KernelHash && !attachSteering()) {
+        std::cerr << "Failed to attach the SO_REUSEPORT steering program, using the kernel hash" << std::endl;
+    }
+    return true;
+}
+
+// The program returns the index of the socket in the reuseport group (sockets are numbered in
+// bind order, which is the receiver order); an index out of range falls back to the kernel hash.
+bool udp_receiver_group::attachSteering() {
+#if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+    const std::uint32_t ancillary = (steering == Steering::ReceivingCpu) ? SKF_AD_CPU : SKF_AD_RXHASH;
+    sock_filter code[] = {
+        { BPF_LD | BPF_W | BPF_ABS, 0, 0, static_cast<std::uint32_t>(SKF_AD_OFF) + ancillary },
+        { BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<std::uint32_t>(receivers.size()) },
+        { BPF_RET | BPF_A, 0, 0, 0 },
+    };
+    sock_fprog prog{};
+    prog.len = static_cast<unsigned short>(sizeof(code) / sizeof(code[0]));
+    prog.filter = code;
+    // Attaching to one socket sets the program for the whole group
+    return setsockopt(receivers.front()->server_socket, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF,
+                      &prog, sizeof(prog)) == 0;
+#else
+    return false;
+#endif
+}
+
+void udp_receiver_group::quit() {
+    for (auto& r : receivers) {
+        r->quit();
+    }
+}
+
+unsigned short udp_receiver_group::getLocalPort() const {
+    return receivers.empty() ? 0 : receivers.front()->getLocalPort();
+}
+
+}  // namespace j2::network::udp
@@ -0,0 +1,265 @@
+
+#include "j2_library/network/udp/udp_recorder.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace j2::network::udp {
+
+namespace {
+
+constexpr char MAGIC[8] = { 'J', '2', 'U', 'D', 'P', 'R', 'E', 'C' };
+constexpr std::uint32_t VERSION = 1;
+
+struct file_header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t record_header_size;
+};
+
+struct record_header {
+    std::uint64_t time_ns;
+    std::uint32_t size;
+    std::uint16_t family;
+    std::uint16_t port;
+    std::uint8_t addr[16];
+};
+
+static_assert(sizeof(file_header) == 16, "recording file header layout");
+static_assert(sizeof(record_header) == 32, "recording record header layout");
+
+std::size_t padded(std::size_t size) {
+    return (size + 7) & ~std::size_t{ 7 };
+}
+
+std::uint64_t to_ns(std::chrono::system_clock::time_point t) {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count());
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------------------------
+// udp_recorder
+
+udp_recorder::~udp_recorder() {
+    close();
+}
+
+bool udp_recorder::open(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (file != nullptr) {
+        std::fclose(file);
+    }
+    file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        std::cerr << "Failed to open recording file: " << path << std::endl;
+        return false;
+    }
+    // Large stdio buffer: the receive thread only copies into memory on most calls
+    file_buffer.resize(1 << 20);
+    std::setvbuf(file, file_buffer.data(), _IOFBF, file_buffer.size());
+
+    file_header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.record_header_size = sizeof(record_header);
+    std::fwrite(&header, sizeof(header), 1, file);
+    datagrams = 0;
+    payload_bytes = 0;
+    return true;
+}
+
+void udp_recorder::flush() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (file != nullptr) {
+        std::fflush(file);
+    }
+}
+
+void udp_recorder::close() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (file != nullptr) {
+        std::fclose(file);
+        file = nullptr;
+    }
+}
+
+bool udp_recorder::is_open() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return file != nullptr;
+}
+
+void udp_recorder::record(const void* data, std::size_t size, const sockaddr_storage& from,
+                          std::chrono::system_clock::time_point time) {
+    std::lock_guard<std::mutex> lock(mutex);
+    write_locked(data, size, from, to_ns(time));
+}
+
+void udp_recorder::record(const datagram_batch& batch) {
+    const std::uint64_t now = to_ns(std::chrono::system_clock::now());
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& d : batch) {
+        const std::uint64_t t = d.kernel_time.time_since_epoch().count() != 0 ? to_ns(d.kernel_time) : now;
+        write_locked(d.data, d.size, d.from, t);
+    }
+}
+
+void udp_recorder::attach(udp_receiver& receiver, udp_receiver::BatchCallback next) {
+    receiver.setOnBatchCallback([this, next = std::move(next)](const datagram_batch& batch) {
+        record(batch);
+        if (next) {
+            next(batch);
+        }
+    });
+}
+
+std::uint64_t udp_recorder::count() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return datagrams;
+}
+
+std::uint64_t udp_recorder::bytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return payload_bytes;
+}
+
+void udp_recorder::write_locked(const void* data, std::size_t size, const sockaddr_storage& from, std::uint64_t time_ns) {
+    if (file == nullptr) {
+        return;
+    }
+    record_header h{};
+    h.time_ns = time_ns;
+    h.size = static_cast<std::uint32_t>(size);
+    h.family = static_cast<std::uint16_t>(from.ss_family);
+    if (from.ss_family == AF_INET6) {
+        const auto& a6 = reinterpret_cast<const sockaddr_in6&>(from);
+        h.port = ntohs(a6.sin6_port);
+        std::memcpy(h.addr, &a6.sin6_addr, 16);
+    } else if (from.ss_family == AF_INET) {
+        const auto& a4 = reinterpret_cast<const sockaddr_in&>(from);
+        h.port = ntohs(a4.sin_port);
+        std::memcpy(h.addr, &a4.sin_addr, 4);
+    }
+
+    static constexpr char zeros[8] = {};
+    std::fwrite(&h, sizeof(h), 1, file);
+    std::fwrite(data, 1, size, file);
+    std::fwrite(zeros, 1, padded(size) - size, file);
+    ++datagrams;
+    payload_bytes += size;
+}
+
+// ---------------------------------------------------------------------------------------------
+// udp_recording
+
+udp_recording::~udp_recording() {
+    close();
+}
+
+bool udp_recording::open(const std::string& path) {
+    close();
+
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(file_header))) {
+        ::close(fd);
+        return false;
+    }
+    length = static_cast<std::size_t>(st.st_size);
+    void* p = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+        length = 0;
+        return false;
+    }
+    ::madvise(p, length, MADV_SEQUENTIAL);
+    base = static_cast<const std::byte*>(p);
+    mapped = true;
+#else
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        return false;
+    }
+    contents.resize(static_cast<std::size_t>(in.tellg()));
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(contents.data()), static_cast<std::streamsize>(contents.size()));
+    base = contents.data();
+    length = contents.size();
+#endif
+
+    file_header header{};
+    if (length < sizeof(header)) {
+        close();
+        return false;
+    }
+    std::memcpy(&header, base, sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION ||
+        header.record_header_size != sizeof(record_header)) {
+        close();
+        return false;
+    }
+
+    std::size_t pos = sizeof(file_header);
+    while (pos + sizeof(record_header) <= length) {
+        record_header h{};
+        std::memcpy(&h, base + pos, sizeof(h));
+        const std::size_t payload = pos + sizeof(record_header);
+        if (payload + h.size > length) {
+            break; // truncated last record (recorder was not closed)
+        }
+
+        recorded_datagram r;
+        r.time_ns = h.time_ns;
+        r.data = base + payload;
+        r.size = h.size;
+        if (h.family == AF_INET6) {
+            auto& a6 = reinterpret_cast<sockaddr_in6&>(r.from);
+            a6.sin6_family = AF_INET6;
+            a6.sin6_port = htons(h.port);
+            std::memcpy(&a6.sin6_addr, h.addr, 16);
+        } else if (h.family == AF_INET) {
+            auto& a4 = reinterpret_cast<sockaddr_in&>(r.from);
+            a4.sin_family = AF_INET;
+            a4.sin_port = htons(h.port);
+            std::memcpy(&a4.sin_addr, h.addr, 4);
+        }
+        records.push_back(r);
+        pos = payload + padded(h.size);
+    }
+    return true;
+}
+
+void udp_recording::close() {
+#ifndef _WIN32
+    if (mapped && base != nullptr) {
+        ::munmap(const_cast<std::byte*>(base), length);
+    }
+#endif
+    mapped = false;
+    base = nullptr;
+    length = 0;
+    contents.clear();
+    records.clear();
+}
+
+std::chrono::nanoseconds udp_recording::duration() const {
+    if (records.size() < 2) {
+        return std::chrono::nanoseconds(0);
+    }
+    return std::chrono::nanoseconds(static_cast<std::int64_t>(records.back().time_ns - records.front().time_ns));
+}
+
+}  // namespace j2::network::udp
@@ -0,0 +1,78 @@
+
+#include "j2_library/network/udp/udp_replayer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace j2::network::udp {
+
+udp_replayer::udp_replayer(udp_sender& s) : sender(s) {}
+
+void udp_replayer::stop() {
+    stop_requested = true;
+}
+
+replay_stats udp_replayer::replay(const udp_recording& recording, const replay_options& options) {
+    using clock = std::chrono::steady_clock;
+
+    replay_stats stats;
+    stop_requested = false;
+    if (recording.empty()) {
+        return stats;
+    }
+
+    const std::size_t batch = std::max<std::size_t>(options.batch_size, 1);
+    const bool paced = options.mode != replay_mode::MaxRate;
+    const double speed = (options.mode == replay_mode::Scaled && options.speed > 0) ? options.speed : 1.0;
+    const std::uint64_t first_ns = recording[0].time_ns;
+
+    // Recorded offset of datagram i, scaled to replay time
+    auto due = [&](std::size_t i) {
+        const std::uint64_t offset = recording[i].time_ns >= first_ns ? recording[i].time_ns - first_ns : 0;
+        return std::chrono::nanoseconds(static_cast<std::int64_t>(static_cast<double>(offset) / speed));
+    };
+
+    std::vector<send_buffer> buffers;
+    buffers.reserve(batch);
+    const auto started = clock::now();
+
+    for (std::size_t loop = 0; loop < std::max<std::size_t>(options.loops, 1) && !stop_requested; ++loop) {
+        const auto loop_start = clock::now();
+        std::size_t i = 0;
+        while (i < recording.size() && !stop_requested) {
+            if (paced) {
+                const auto when = loop_start + due(i);
+                if (clock::now() < when) {
+                    std::this_thread::sleep_until(when);
+                }
+            }
+
+            // Everything already due (or a full batch at max rate) goes out together
+            buffers.clear();
+            const auto now = clock::now() - loop_start;
+            while (i < recording.size() && buffers.size() < batch && (!paced || due(i) <= now)) {
+                buffers.push_back(send_buffer{ recording[i].data, recording[i].size });
+                ++i;
+            }
+            if (buffers.empty()) {
+                // Woke up early; the datagram is sent on the next pass
+                continue;
+            }
+
+            const int sent = sender.send_batch(buffers);
+            const std::size_t ok = sent > 0 ? static_cast<std::size_t>(sent) : 0;
+            stats.datagrams += ok;
+            stats.failed += buffers.size() - ok;
+            for (std::size_t k = 0; k < ok; ++k) {
+                stats.bytes += buffers[k].size;
+            }
+        }
+    }
+
+    stats.seconds = std::chrono::duration<double>(clock::now() - started).count();
+    return stats;
+}
+
+}  // namespace j2::network::udp
@@ -1,9 +1,134 @@
 #include "j2_library/network/udp/udp_sender.hpp"
+#include <algorithm>
 #include <cstring>
+#include <cstdint>
 #include <iostream>
 
+#include <functional>
+
+#ifndef _WIN32
+#include <netdb.h>
+#endif
+#ifdef __linux__
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <netinet/udp.h>
+#endif
+
+#if defined(__linux__) && defined(UDP_SEGMENT)
+#define J2_UDP_GSO
+#endif
+
 namespace j2::network::udp {
 
+namespace {
+
+#ifdef __linux__
+constexpr std::size_t MMSG_CHUNK = 64;          // datagrams per sendmmsg call
+#endif
+#ifdef J2_UDP_GSO
+constexpr std::size_t GSO_MAX_SEGMENTS = 64;    // UDP_MAX_SEGMENTS of older kernels
+constexpr std::size_t GSO_MAX_BYTES = 65507;    // largest IPv4 UDP payload
+#endif
+
+// One datagram for send_datagrams: payload and destination
+struct outgoing {
+    const void* data;
+    std::size_t size;
+    const sockaddr_storage* addr;
+    socklen_t addr_len;
+};
+
+// Sends `count` datagrams described by at(i) (sendmmsg on Linux, sendto elsewhere).
+// Returns the number sent, -1 if the first one failed.
+template <typename Socket, typename At>
+int send_datagrams(Socket fd, std::size_t count, At at) {
+    std::size_t done = 0;
+    bool failed = false;
+#ifdef __linux__
+    mmsghdr msgs[MMSG_CHUNK];
+    iovec iovs[MMSG_CHUNK];
+    while (done < count) {
+        const std::size_t n = std::min(MMSG_CHUNK, count - done);
+        memset(msgs, 0, sizeof(mmsghdr) * n);
+        for (std::size_t i = 0; i < n; ++i) {
+            const outgoing o = at(done + i);
+            iovs[i].iov_base = const_cast<void*>(o.data);
+            iovs[i].iov_len = o.size;
+            msgs[i].msg_hdr.msg_name = const_cast<sockaddr_storage*>(o.addr);
+            msgs[i].msg_hdr.msg_namelen = o.addr_len;
+            msgs[i].msg_hdr.msg_iov = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+        int sent = sendmmsg(fd, msgs, static_cast<unsigned>(n), 0);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            failed = true;
+            break;
+        }
+        done += static_cast<std::size_t>(sent);
+    }
+#else
+    for (; done < count; ++done) {
+        const outgoing o = at(done);
+        auto ret = sendto(fd,
+            static_cast<const char*>(o.data),
+            static_cast<int>(o.size),
+            0,
+            reinterpret_cast<const sockaddr*>(o.addr),
+            o.addr_len);
+        if (ret < 0) {
+            failed = true;
+            break;
+        }
+    }
+#endif
+    if (failed && done == 0) {
+        return -1;
+    }
+    return static_cast<int>(done);
+}
+
+std::size_t endpoint_key(const std::string& ip, unsigned short port) {
+    return std::hash<std::string>{}(ip) ^ (static_cast<std::size_t>(port) << 1);
+}
+
+} // namespace
+
+udp_endpoint::udp_endpoint(const std::string& ip, unsigned short port) {
+    int family = AF_INET;
+    if (udp_sender::fill_sockaddr(ip, port, addr, addr_len, family)) {
+        return;
+    }
+    addr_len = 0;
+
+    // Not a numeric address: resolve it as a host name (blocking, once per endpoint)
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_DGRAM;
+    addrinfo* result = nullptr;
+    if (ip.empty() || getaddrinfo(ip.c_str(), nullptr, &hints, &result) != 0 || result == nullptr) {
+        return;
+    }
+    for (addrinfo* ai = result; ai != nullptr; ai = ai->ai_next) {
+        if (ai->ai_family == AF_INET || ai->ai_family == AF_INET6) {
+            memset(&addr, 0, sizeof(addr));
+            memcpy(&addr, ai->ai_addr, ai->ai_addrlen);
+            if (ai->ai_family == AF_INET) {
+                reinterpret_cast<sockaddr_in*>(&addr)->sin_port = htons(port);
+            } else {
+                reinterpret_cast<sockaddr_in6*>(&addr)->sin6_port = htons(port);
+            }
+            addr_len = static_cast<socklen_t>(ai->ai_addrlen);
+            break;
+        }
+    }
+    freeaddrinfo(result);
+}
+
 bool udp_sender::fill_sockaddr(const std::string& ip, unsigned short port, sockaddr_storage& addr, socklen_t& addr_len, int& family) {
     memset(&addr, 0, sizeof(addr));
     sockaddr_in* addr4 = reinterpret_cast<sockaddr_in*>(&addr);
@@ -28,15 +153,38 @@ bool udp_sender::fill_sockaddr(const std::string& ip, unsigned short port, socka
 udp_sender::udp_sender()
     : server_ip(""), server_port(0), stop_flag(false) {}
 
+udp_sender::udp_sender(const socket_options& opts) : udp_sender() {
+    options = opts;
+}
+
+udp_thread_sender::udp_thread_sender() {
+    synchronized = false;
+}
+
+udp_thread_sender::udp_thread_sender(const socket_options& opts) : udp_sender(opts) {
+    synchronized = false;
+}
+
 udp_sender::~udp_sender() {
     stop();
 }
 
+void udp_sender::set_socket_options(const socket_options& opts) {
+    options = opts;
+}
+
+void udp_sender::set_enable_gso(bool enable) {
+    std::lock_guard<std::mutex> lock(send_mutex);
+    enable_gso = enable;
+    gso_rejected_segment = 0;
+}
+
 void udp_sender::setServer(const std::string& ip, unsigned short port) {
     std::lock_guard<std::mutex> lock(send_mutex);
     server_ip = ip;
     server_port = port;
     fill_sockaddr(server_ip, server_port, server_addr, server_addr_len, address_family);
+    gso_rejected_segment = 0; // another route, another MTU
 }
 
 bool udp_sender::create() {
@@ -68,6 +216,8 @@ bool udp_sender::create() {
 #endif
         sizeof(broadcastEnable));
 
+    options.apply(static_cast<int>(socket_fd));
+
     server_addr = tmp_addr;
     server_addr_len = tmp_len;
 
@@ -75,7 +225,14 @@ bool udp_sender::create() {
 }
 
 ssize_t udp_sender::send_data(const std::string& data) {
-    std::lock_guard<std::mutex> lock(send_mutex);
+    return send_data(data.data(), data.size());
+}
+
+ssize_t udp_sender::send_data(const void* data, std::size_t size) {
+    std::unique_lock<std::mutex> lock(send_mutex, std::defer_lock);
+    if (synchronized) {
+        lock.lock();
+    }
     ssize_t ret = 0;
 #ifdef _WIN32
     if (socket_fd != INVALID_SOCKET) {
@@ -83,8 +240,8 @@ ssize_t udp_sender::send_data(const std::string& data) {
     if (socket_fd != -1) {
 #endif
         ret = sendto(socket_fd,
-            data.c_str(),
-            static_cast<int>(data.size()),
+            static_cast<const char*>(data),
+            static_cast<int>(size),
             0,
             reinterpret_cast<const sockaddr*>(&server_addr),
             server_addr_len);
@@ -93,13 +250,40 @@ ssize_t udp_sender::send_data(const std::string& data) {
 }
 
 ssize_t udp_sender::send_data_to(const std::string& data, const std::string& ip, unsigned short port) {
-    std::lock_guard<std::mutex> lock(send_mutex);
+    std::unique_lock<std::mutex> lock(send_mutex, std::defer_lock);
+    if (synchronized) {
+        lock.lock();
+    }
+
+    ssize_t ret = 0;
+    const udp_endpoint* dest = resolve_cached(ip, port);
+    if (dest == nullptr) {
+        return ret;
+    }
+
+#ifdef _WIN32
+    if (socket_fd != INVALID_SOCKET) {
+#else
+    if (socket_fd != -1) {
+#endif
+        ret = sendto(socket_fd,
+            data.c_str(),
+            static_cast<int>(data.size()),
+            0,
+            dest->data(),
+            dest->size());
+    }
+    return ret;
+}
+
+ssize_t udp_sender::send_data_to(const std::string& data, const udp_endpoint& to) {
+    std::unique_lock<std::mutex> lock(send_mutex, std::defer_lock);
+    if (synchronized) {
+        lock.lock();
+    }
 
     ssize_t ret = 0;
-    sockaddr_storage dest_addr{};
-    socklen_t dest_addr_len = 0;
-    int dest_family = AF_INET;
-    if (!fill_sockaddr(ip, port, dest_addr, dest_addr_len, dest_family)) {
+    if (!to.valid()) {
         std::cerr << "Invalid destination address" << std::endl;
         return ret;
     }
@@ -113,12 +297,206 @@ ssize_t udp_sender::send_data_to(const std::string& data, const std::string& ip,
             data.c_str(),
             static_cast<int>(data.size()),
             0,
-            reinterpret_cast<const sockaddr*>(&dest_addr),
-            dest_addr_len);
+            to.data(),
+            to.size());
     }
     return ret;
 }
 
+int udp_sender::send_data_to_all(const send_buffer& data, const std::vector<udp_endpoint>& to) {
+    std::unique_lock<std::mutex> lock(send_mutex, std::defer_lock);
+    if (synchronized) {
+        lock.lock();
+    }
+#ifdef _WIN32
+    if (socket_fd == INVALID_SOCKET || to.empty()) {
+#else
+    if (socket_fd == -1 || to.empty()) {
+#endif
+        return 0;
+    }
+    return send_datagrams(socket_fd, to.size(), [&](std::size_t i) {
+        return outgoing{ data.data, data.size, &to[i].addr, to[i].addr_len };
+    });
+}
+
+void udp_sender::set_endpoint_cache_capacity(std::size_t capacity) {
+    std::lock_guard<std::mutex> lock(send_mutex);
+    endpoint_cache_capacity = capacity;
+    while (endpoint_lru.size() > capacity) {
+        endpoint_index.erase(endpoint_key(endpoint_lru.back().ip, endpoint_lru.back().port));
+        endpoint_lru.pop_back();
+    }
+}
+
+// Called with the send lock held. Only numeric addresses are parsed, so this never blocks on a
+// name lookup. Returns nullptr when the address is invalid; an invalid address is cached too and
+// reported only when it is first seen.
+const udp_endpoint* udp_sender::resolve_cached(const std::string& ip, unsigned short port) {
+    udp_endpoint parsed;
+    int family = AF_INET;
+    if (endpoint_cache_capacity == 0) {
+        static thread_local udp_endpoint uncached;
+        if (!fill_sockaddr(ip, port, uncached.addr, uncached.addr_len, family)) {
+            std::cerr << "Invalid destination address" << std::endl;
+            return nullptr;
+        }
+        return &uncached;
+    }
+
+    const std::size_t key = endpoint_key(ip, port);
+    auto found = endpoint_index.find(key);
+    if (found != endpoint_index.end()) {
+        auto entry = found->second;
+        if (entry->port == port && entry->ip == ip) {
+            endpoint_lru.splice(endpoint_lru.begin(), endpoint_lru, entry);
+            return entry->endpoint.valid() ? &entry->endpoint : nullptr;
+        }
+        // Hash collision: drop the old entry and parse again
+        endpoint_lru.erase(entry);
+        endpoint_index.erase(found);
+    }
+
+    if (!fill_sockaddr(ip, port, parsed.addr, parsed.addr_len, family)) {
+        parsed.addr_len = 0;
+        std::cerr << "Invalid destination address" << std::endl;
+    }
+
+    if (endpoint_lru.size() >= endpoint_cache_capacity) {
+        // Reuse the least recently used node (and its string buffer) for the new entry
+        auto last = std::prev(endpoint_lru.end());
+        endpoint_index.erase(endpoint_key(last->ip, last->port));
+        endpoint_lru.splice(endpoint_lru.begin(), endpoint_lru, last);
+    } else {
+        endpoint_lru.emplace_front();
+    }
+    cached_endpoint& entry = endpoint_lru.front();
+    entry.ip = ip;
+    entry.port = port;
+    entry.endpoint = parsed;
+    endpoint_index[key] = endpoint_lru.begin();
+    return entry.endpoint.valid() ? &entry.endpoint : nullptr;
+}
+
+int udp_sender::send_batch(const send_buffer* buffers, std::size_t count) {
+    std::unique_lock<std::mutex> lock(send_mutex, std::defer_lock);
+    if (synchronized) {
+        lock.lock();
+    }
+#ifdef _WIN32
+    if (socket_fd == INVALID_SOCKET) {
+#else
+    if (socket_fd == -1) {
+#endif
+        return -1;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    std::size_t done = 0;
+    if (enable_gso) {
+        done = static_cast<std::size_t>(send_gso(buffers, count));
+    }
+    if (done < count) {
+        int sent = send_mmsg(buffers + done, count - done);
+        if (sent < 0) {
+            return done > 0 ? static_cast<int>(done) : -1;
+        }
+        done += static_cast<std::size_t>(sent);
+    }
+    return static_cast<int>(done);
+}
+
+int udp_sender::send_batch(const std::vector<send_buffer>& buffers) {
+    return send_batch(buffers.data(), buffers.size());
+}
+
+int udp_sender::send_batch(const std::vector<std::string>& messages) {
+    std::vector<send_buffer> buffers;
+    buffers.reserve(messages.size());
+    for (const auto& m : messages) {
+        buffers.push_back(send_buffer{ m.data(), m.size() });
+    }
+    return send_batch(buffers.data(), buffers.size());
+}
+
+int udp_sender::send_mmsg(const send_buffer* buffers, std::size_t count) {
+    return send_datagrams(socket_fd, count, [&](std::size_t i) {
+        return outgoing{ buffers[i].data, buffers[i].size, &server_addr, server_addr_len };
+    });
+}
+
+// Sends as much of the batch as possible with UDP_SEGMENT and returns how many datagrams went out
+// that way; the caller sends the rest with sendmmsg. Buffers are gathered with an iovec per
+// datagram, so nothing is copied into a contiguous buffer.
+int udp_sender::send_gso(const send_buffer* buffers, std::size_t count) {
+#ifdef J2_UDP_GSO
+    const std::size_t segment = buffers[0].size;
+    if (count < 2 || segment == 0 || segment > GSO_MAX_BYTES ||
+        (gso_rejected_segment != 0 && segment >= gso_rejected_segment)) {
+        return 0;
+    }
+    for (std::size_t i = 1; i < count; ++i) {
+        if (buffers[i].size != segment && (i != count - 1 || buffers[i].size > segment)) {
+            return 0;
+        }
+    }
+    const std::size_t per_send = std::min(GSO_MAX_SEGMENTS, GSO_MAX_BYTES / segment);
+    if (per_send < 2) {
+        return 0;
+    }
+
+    iovec iovs[GSO_MAX_SEGMENTS];
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(std::uint16_t))];
+    const std::uint16_t segment_size = static_cast<std::uint16_t>(segment);
+
+    std::size_t done = 0;
+    while (done < count) {
+        const std::size_t n = std::min(per_send, count - done);
+        for (std::size_t i = 0; i < n; ++i) {
+            iovs[i].iov_base = const_cast<void*>(buffers[done + i].data);
+            iovs[i].iov_len = buffers[done + i].size;
+        }
+        msghdr msg{};
+        msg.msg_name = &server_addr;
+        msg.msg_namelen = server_addr_len;
+        msg.msg_iov = iovs;
+        msg.msg_iovlen = n;
+        if (n > 1) {
+            memset(control, 0, sizeof(control));
+            msg.msg_control = control;
+            msg.msg_controllen = sizeof(control);
+            cmsghdr* cm = CMSG_FIRSTHDR(&msg);
+            cm->cmsg_level = SOL_UDP;
+            cm->cmsg_type = UDP_SEGMENT;
+            cm->cmsg_len = CMSG_LEN(sizeof(std::uint16_t));
+            memcpy(CMSG_DATA(cm), &segment_size, sizeof(segment_size));
+        }
+        if (sendmsg(socket_fd, &msg, 0) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == ENOPROTOOPT || errno == EOPNOTSUPP || errno == EIO) {
+                enable_gso = false; // kernel or device without UDP GSO
+            }
+            else if (errno == EINVAL || errno == EMSGSIZE) {
+                // Segment larger than the route MTU: smaller batches may still use GSO
+                gso_rejected_segment = segment;
+            }
+            break;
+        }
+        done += n;
+    }
+    return static_cast<int>(done);
+#else
+    (void)buffers;
+    (void)count;
+    enable_gso = false;
+    return 0;
+#endif
+}
+
 void udp_sender::set_multicast_ttl(int ttl) {
     if (address_family == AF_INET) {
         setsockopt(socket_fd, IPPROTO_IP, IP_MULTICAST_TTL,
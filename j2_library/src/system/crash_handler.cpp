@@ -1,4 +1,5 @@
 #include "j2_library/system/system.hpp"
+#include "j2_library/log/flight_recorder.hpp"
 
 #include <iostream>
 #include <sstream>
@@ -7,6 +8,7 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <cstring>
 
 #ifdef _WIN32 
     #ifndef WIN32_LEAN_AND_MEAN
@@ -29,6 +31,7 @@ namespace j2 {
     namespace system {
 
         CrashCallback CrashHandler::s_callback = nullptr;
+        char CrashHandler::s_flight_dump_path[1024] = {};
 
         void CrashHandler::initialize(CrashCallback callback) {
             s_callback = callback;
@@ -48,14 +51,30 @@ namespace j2 {
 #endif
         }
 
+        void CrashHandler::set_flight_recorder_dump_path(const std::string& path) {
+            // 시그널 핸들러가 읽는 도중 문자열이 깨지지 않도록 초기화 단계에서 설정할 것
+            std::size_t n = std::min(path.size(), sizeof(s_flight_dump_path) - 1);
+            std::memcpy(s_flight_dump_path, path.data(), n);
+            s_flight_dump_path[n] = '\0';
+        }
+
+        void CrashHandler::dump_flight_recorder() noexcept {
+            if (s_flight_dump_path[0] != '\0') {
+                j2::log::flight_recorder::dumpToFile(s_flight_dump_path);
+            }
+        }
+
 #ifdef _WIN32
         long __stdcall CrashHandler::windows_exception_handler(struct _EXCEPTION_POINTERS* info) {
+            dump_flight_recorder();
             std::string reason = "Exception Code: 0x" + std::to_string(info->ExceptionRecord->ExceptionCode);
             handle_crash("Windows SEH Exception", reason);
             return EXCEPTION_EXECUTE_HANDLER;
         }
 #else
         void CrashHandler::posix_signal_handler(int sig) {
+            // 이후의 콜 스택 수집은 async-signal-safe 하지 않으므로 링 버퍼 덤프를 먼저 수행
+            dump_flight_recorder();
             std::string reason = "Signal: " + std::to_string(sig);
             handle_crash("POSIX Signal", reason);
             std::exit(sig);
@@ -92,6 +111,7 @@ namespace j2 {
 #endif
 
         void CrashHandler::cxx_terminate_handler() {
+            dump_flight_recorder();
             handle_crash("C++ Terminate", "Unhandled C++ Exception");
             std::abort();
         }
@@ -0,0 +1,128 @@
+#pragma once
+
+// HTTP 테스트 공용 도우미
+// - mini_http_server: 루프백의 최소 keep-alive HTTP/1.1 서버 (연결당 스레드)
+//   요청마다 delay_ms 후 "echo:<method> <target> <body>" 로 응답하고
+//   accept/요청 수와 동시에 처리 중이던 요청 수의 최댓값을 기록
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <unistd.h>
+
+namespace j2_test {
+
+    class mini_http_server {
+    public:
+        explicit mini_http_server(int delay = 0) : delay_ms(delay) {
+            listen_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+            int on = 1;
+            ::setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+            sockaddr_in addr{};
+            addr.sin_family = AF_INET;
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            ::bind(listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+            ::listen(listen_fd, 256);
+            socklen_t len = sizeof(addr);
+            ::getsockname(listen_fd, reinterpret_cast<sockaddr*>(&addr), &len);
+            port = ntohs(addr.sin_port);
+            accept_thread = std::thread([this] { accept_loop(); });
+        }
+
+        ~mini_http_server() {
+            running = false;
+            accept_thread.join();
+            std::lock_guard<std::mutex> lock(mu);
+            for (auto& t : workers) t.join();
+            ::close(listen_fd);
+        }
+
+        mini_http_server(const mini_http_server&) = delete;
+        mini_http_server& operator=(const mini_http_server&) = delete;
+
+        std::string url(const std::string& path) const {
+            return "http://127.0.0.1:" + std::to_string(port) + path;
+        }
+
+        int port = 0;
+        std::atomic<int> accepted{ 0 };
+        std::atomic<int> requests{ 0 };
+        std::atomic<int> max_concurrent{ 0 };
+
+    private:
+        void accept_loop() {
+            while (running) {
+                pollfd pfd{ listen_fd, POLLIN, 0 };
+                if (::poll(&pfd, 1, 20) <= 0) continue;
+                int fd = ::accept(listen_fd, nullptr, nullptr);
+                if (fd < 0) continue;
+                ++accepted;
+                std::lock_guard<std::mutex> lock(mu);
+                workers.emplace_back([this, fd] { serve(fd); });
+            }
+        }
+
+        void serve(int fd) {
+            std::string in;
+            char buf[4096];
+            while (running) {
+                const auto header_end = in.find("\r\n\r\n");
+                if (header_end != std::string::npos) {
+                    std::size_t content_length = 0;
+                    const auto cl = in.find("Content-Length: ");
+                    if (cl != std::string::npos && cl < header_end) {
+                        content_length = std::stoul(in.substr(cl + 16));
+                    }
+                    if (in.size() >= header_end + 4 + content_length) {
+                        const auto sp1 = in.find(' ');
+                        const auto sp2 = in.find(' ', sp1 + 1);
+                        const std::string body = "echo:" + in.substr(0, sp1) + " " + in.substr(sp1 + 1, sp2 - sp1 - 1) +
+                            " " + in.substr(header_end + 4, content_length);
+                        in.erase(0, header_end + 4 + content_length);
+
+                        const int now = ++concurrent;
+                        int seen = max_concurrent.load();
+                        while (now > seen && !max_concurrent.compare_exchange_weak(seen, now)) {}
+                        for (int waited = 0; waited < delay_ms && running; waited += 5) {
+                            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                        }
+                        --concurrent;
+                        ++requests;
+
+                        const std::string out = "HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\nContent-Length: " +
+                            std::to_string(body.size()) + "\r\n\r\n" + body;
+                        ::send(fd, out.data(), out.size(), MSG_NOSIGNAL);
+                        continue;
+                    }
+                }
+                pollfd pfd{ fd, POLLIN, 0 };
+                if (::poll(&pfd, 1, 20) <= 0) continue;
+                const ssize_t n = ::recv(fd, buf, sizeof(buf), 0);
+                if (n <= 0) break;
+                in.append(buf, static_cast<std::size_t>(n));
+            }
+            ::close(fd);
+        }
+
+        int delay_ms = 0;
+        int listen_fd = -1;
+        std::atomic<int> concurrent{ 0 };
+        std::atomic<bool> running{ true };
+        std::thread accept_thread;
+        std::mutex mu;
+        std::vector<std::thread> workers;
+    };
+
+} // namespace j2_test
+
+#endif // !_WIN32
@@ -0,0 +1,23 @@
+#pragma once
+
+// 로그 테스트 공용 도우미
+// - make_sandbox: 임시 디렉터리 아래에 테스트마다 새 작업 디렉터리 생성
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <system_error>
+
+namespace j2_test {
+
+    // prefix 예: "j2_log_archiver_test_" -> <temp>/j2_log_archiver_test_<now>
+    inline std::filesystem::path make_sandbox(const std::string& prefix) {
+        auto now = std::chrono::system_clock::now().time_since_epoch().count();
+        std::filesystem::path base = std::filesystem::temp_directory_path()
+            / (prefix + std::to_string(now));
+        std::error_code ec;
+        std::filesystem::create_directories(base, ec);
+        return base;
+    }
+
+} // namespace j2_test
@@ -0,0 +1,93 @@
+#pragma once
+
+// 네트워크 테스트 공용 도우미
+// - wait_until: 조건이 참이 될 때까지 폴링 (기본 3초)
+// - test_server / test_receiver: 임의 포트(0)로 시작한 서버/수신기의 실제 포트와 소켓을 노출
+// - connect_to / read_exactly: 루프백 TCP 클라이언트 소켓
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include "j2_library/network/network.hpp"
+
+#ifndef _WIN32
+
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+#endif
+
+namespace j2_test {
+
+    template <typename Pred>
+    bool wait_until(Pred pred, std::chrono::milliseconds timeout = std::chrono::seconds(3)) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!pred()) {
+            if (std::chrono::steady_clock::now() > deadline) return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return true;
+    }
+
+#ifndef _WIN32
+
+    // IPv4 소켓이 바인드된 로컬 포트
+    inline std::uint16_t local_port(int fd) {
+        sockaddr_in addr{};
+        socklen_t len = sizeof(addr);
+        ::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len);
+        return ntohs(addr.sin_port);
+    }
+
+    class test_server : public j2::network::tcp::tcp_server {
+    public:
+        using tcp_server::tcp_server;
+        int listen_fd() const { return server_socket; }
+        std::uint16_t port() const { return local_port(server_socket); }
+    };
+
+    class test_receiver : public j2::network::udp::udp_receiver {
+    public:
+        using udp_receiver::udp_receiver;
+        int fd() const { return server_socket; }
+        std::uint16_t port() const { return local_port(server_socket); }
+    };
+
+    // 127.0.0.1:port 에 연결한 소켓 (수신 타임아웃 설정), 실패 시 -1
+    inline int connect_to(std::uint16_t port, int recv_timeout_sec = 3) {
+        int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons(port);
+        if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+            ::close(fd);
+            return -1;
+        }
+        timeval tv{ recv_timeout_sec, 0 };
+        ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        return fd;
+    }
+
+    // size 바이트를 받을 때까지 읽음 (연결 종료/타임아웃 시 그때까지 받은 만큼)
+    inline std::string read_exactly(int fd, std::size_t size) {
+        std::string out;
+        out.reserve(size);
+        char buf[65536];
+        while (out.size() < size) {
+            ssize_t n = ::recv(fd, buf, std::min(sizeof(buf), size - out.size()), 0);
+            if (n <= 0) break;
+            out.append(buf, static_cast<std::size_t>(n));
+        }
+        return out;
+    }
+
+#endif // _WIN32
+
+} // namespace j2_test
@@ -0,0 +1,142 @@
+// 파일: test_curl_async_client.cpp
+// 목적: j2::network::rest::curl_async_client (curl_multi 이벤트 루프) 를 GoogleTest로 검증
+// - 200 개 GET 을 future 로 동시에 보내고 모두 올바른 응답을 받는지
+// - 호스트별 동시 요청 상한이 서버에서 관측되는 동시 처리 수를 넘지 않는지
+// - POST 콜백, 연결 실패 분류(classify), rest_session 공유
+// - 클라이언트 소멸 시 진행 중/대기 중 요청이 취소 응답으로 완료되는지
+// 로컬 루프백에 keep-alive 를 지원하는 최소 HTTP/1.1 서버(응답 지연 가능)를 띄워 검증합니다.
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <future>
+#include <algorithm>
+
+#include "gtest_compat.hpp"
+#include "http_test_util.hpp"
+#include "j2_library/network/network.hpp"
+
+#ifdef __linux__
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <unistd.h>
+
+namespace {
+
+    using namespace j2::network::rest;
+    using j2_test::mini_http_server;
+
+} // namespace
+
+TEST(curl_async_client, FanOutGetFutures) {
+    mini_http_server server;
+    curl_async_client client;
+    client.set_max_concurrency(16, 4);
+
+    std::vector<std::future<curl_async_client::get_response>> futures;
+    for (int i = 0; i < 200; ++i) {
+        futures.push_back(client.get_async(server.url("/item"), { {"id", std::to_string(i)}, {"q", "a b"} }));
+    }
+    for (int i = 0; i < 200; ++i) {
+        auto resp = futures[i].get();
+        ASSERT_EQ(curl_get_client::classify(resp), curl_get_client::result_code::ok) << resp.error;
+        EXPECT_EQ(resp.status, curl_get_client::http_status::ok);
+        EXPECT_EQ(resp.body, "echo:GET /item?id=" + std::to_string(i) + "&q=a%20b ");
+        EXPECT_EQ(resp.content_type, "text/plain");
+    }
+    EXPECT_EQ(server.requests.load(), 200);
+    EXPECT_LE(server.accepted.load(), 4);   // 호스트당 4 개 연결을 keep-alive 로 재사용
+    EXPECT_EQ(client.pending(), 0u);
+}
+
+TEST(curl_async_client, PerHostCapLimitsConcurrency) {
+    mini_http_server server(30);
+    curl_async_client client;
+    client.set_max_concurrency(0, 3);
+
+    std::vector<std::future<curl_async_client::get_response>> futures;
+    for (int i = 0; i < 12; ++i) {
+        futures.push_back(client.get_async(server.url("/slow")));
+    }
+    for (auto& f : futures) {
+        EXPECT_TRUE(f.get().is_success());
+    }
+    EXPECT_LE(server.max_concurrent.load(), 3);
+    EXPECT_GE(server.max_concurrent.load(), 2);   // 실제로 병렬 처리됨
+}
+
+TEST(curl_async_client, PostCallbackAndSession) {
+    mini_http_server server;
+    rest_session session;
+    curl_async_client client;
+    client.set_session(&session);
+    client.set_headers({ {"Content-Type", "application/json"} });
+
+    std::mutex mu;
+    std::vector<std::string> bodies;
+    std::promise<void> done;
+    std::atomic<int> remaining{ 10 };
+    for (int i = 0; i < 10; ++i) {
+        client.post_async(server.url("/post"), "{\"n\":" + std::to_string(i) + "}", [&](curl_async_client::post_response resp) {
+            EXPECT_EQ(curl_post_client::classify(resp), curl_post_client::result_code::ok);
+            {
+                std::lock_guard<std::mutex> lock(mu);
+                bodies.push_back(resp.body);
+            }
+            if (--remaining == 0) done.set_value();
+            });
+    }
+    ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+
+    std::sort(bodies.begin(), bodies.end());
+    EXPECT_EQ(bodies.front(), "echo:POST /post {\"n\":0}");
+    EXPECT_EQ(bodies.back(), "echo:POST /post {\"n\":9}");
+    EXPECT_GE(session.created_handles(), 1u);
+}
+
+TEST(curl_async_client, ConnectionFailureIsClassified) {
+    // 바로 닫은 소켓의 포트: 연결 거부
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+    socklen_t len = sizeof(addr);
+    ::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len);
+    ::close(fd);
+
+    curl_async_client client;
+    auto resp = client.get_async("http://127.0.0.1:" + std::to_string(ntohs(addr.sin_port)) + "/").get();
+    EXPECT_FALSE(resp.is_success());
+    EXPECT_EQ(curl_get_client::classify(resp), curl_get_client::result_code::curl_network_error);
+}
+
+TEST(curl_async_client, DestructionCancelsOutstandingRequests) {
+    mini_http_server server(2000);
+    std::vector<std::future<curl_async_client::get_response>> futures;
+    const auto start = std::chrono::steady_clock::now();
+    {
+        curl_async_client client;
+        client.set_max_concurrency(0, 1);   // 1 개 진행, 나머지는 대기열
+        for (int i = 0; i < 5; ++i) {
+            futures.push_back(client.get_async(server.url("/never")));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        EXPECT_EQ(client.pending(), 5u);
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+    for (auto& f : futures) {
+        ASSERT_EQ(f.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+        auto resp = f.get();
+        EXPECT_EQ(resp.error, "request cancelled");
+        EXPECT_EQ(curl_get_client::classify(resp), curl_get_client::result_code::curl_other_error);
+    }
+}
+
+#endif // __linux__
@@ -0,0 +1,96 @@
+// 파일: test_flight_recorder.cpp
+// 목적: j2::log::flight_recorder / flight_recorder_sink 동작을 GoogleTest로 검증
+// - 스레드별 링 버퍼에 최근 N개만 유지되는지
+// - dumpToFile() 결과에 각 스레드의 메시지가 기록되는지
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+
+#include <spdlog/spdlog.h>
+
+#include "gtest_compat.hpp"
+#include "j2_library/log/log.hpp"
+
+namespace {
+
+    std::string read_all(const std::filesystem::path& p) {
+        std::ifstream in(p, std::ios::binary);
+        std::stringstream ss;
+        ss << in.rdbuf();
+        return ss.str();
+    }
+
+    std::filesystem::path make_dump_path() {
+        auto now = std::chrono::system_clock::now().time_since_epoch().count();
+        return std::filesystem::temp_directory_path()
+            / ("j2_flight_recorder_test_" + std::to_string(now) + ".dump");
+    }
+
+} // namespace
+
+TEST(flight_recorder, KeepsLatestMessagesPerThread) {
+    j2::log::flight_recorder::setSlotsPerThread(8);
+
+    auto logger = std::make_shared<spdlog::logger>("j2_flight_recorder_test",
+        std::make_shared<j2::log::flight_recorder_sink>());
+    logger->set_level(spdlog::level::trace);
+
+    // 새 스레드에서 기록해야 변경된 슬롯 개수의 링을 할당받음
+    // 종료된 스레드의 링은 다른 스레드가 재사용하므로 덤프가 끝날 때까지 스레드를 유지
+    std::atomic<int> logged{ 0 };
+    std::atomic<bool> dumped{ false };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 2; ++t) {
+        threads.emplace_back([logger, t, &logged, &dumped] {
+            for (int i = 0; i < 20; ++i) {
+                logger->trace("fr-thread{}-msg{:02}", t, i);
+            }
+            ++logged;
+            while (!dumped) std::this_thread::yield();
+        });
+    }
+    while (logged < 2) std::this_thread::yield();
+
+    const auto path = make_dump_path();
+    const bool ok = j2::log::flight_recorder::dumpToFile(path.string().c_str());
+    dumped = true;
+    for (auto& th : threads) th.join();
+    ASSERT_TRUE(ok);
+    const std::string dump = read_all(path);
+
+    for (int t = 0; t < 2; ++t) {
+        const std::string prefix = "fr-thread" + std::to_string(t) + "-msg";
+        EXPECT_EQ(dump.find(prefix + "11"), std::string::npos);   // 덮어써진 메시지
+        EXPECT_NE(dump.find(prefix + "12"), std::string::npos);   // 최근 8개 유지
+        EXPECT_NE(dump.find(prefix + "19"), std::string::npos);
+    }
+    EXPECT_NE(dump.find("[trace] fr-thread0-msg19"), std::string::npos);
+    EXPECT_NE(dump.find("===== end of flight recorder dump ====="), std::string::npos);
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    j2::log::flight_recorder::setSlotsPerThread(256);
+}
+
+TEST(flight_recorder, TruncatesLongMessages) {
+    const std::string longText(j2::log::flight_recorder::SLOT_TEXT_SIZE + 100, 'z');
+    std::thread([&longText] {
+        j2::log::flight_recorder::record(spdlog::level::err, 0, longText.data(), longText.size());
+    }).join();
+
+    const auto path = make_dump_path();
+    ASSERT_TRUE(j2::log::flight_recorder::dumpToFile(path.string().c_str()));
+    const std::string dump = read_all(path);
+
+    const std::string kept(j2::log::flight_recorder::SLOT_TEXT_SIZE, 'z');
+    EXPECT_NE(dump.find("[error] " + kept + "\n"), std::string::npos);
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
@@ -0,0 +1,166 @@
+// GoogleTest를 이용해 j2::json 바이너리 인코딩(MessagePack/CBOR)과 udp_typed_publisher/subscriber 를 검증
+// 검증 항목:
+//   * msgpack/cbor 왕복 변환 결과가 원본과 같은지, 텍스트 dump 보다 작은지
+//   * 같은 출력 버퍼를 재사용할 때 재할당이 없는지
+//   * 잘린/뒤에 쓰레기가 붙은/빈 입력은 예외 없이 실패하는지
+//   * to_json/from_json 이 있는 구조체의 타입 버전 인코딩/디코딩
+//   * 루프백 UDP 로 타입 발행/구독이 동작하는지
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <chrono>
+#include <thread>
+#include <mutex>
+
+#include "gtest_compat.hpp"
+#include "j2_library/json/json_binary.hpp"
+#include "j2_library/network/network.hpp"
+
+namespace {
+
+    using j2::json::binary_format;
+    using j2::json::nj;
+
+    struct Sample {
+        std::string name;
+        std::optional<int> age;
+        std::vector<std::string> tags;
+    };
+
+    void to_json(nj& j, const Sample& s) {
+        j = nj{ {"name", s.name}, {"tags", s.tags} };
+        if (s.age) j["age"] = *s.age;
+        else j["age"] = nullptr;
+    }
+
+    void from_json(const nj& j, Sample& s) {
+        j.at("name").get_to(s.name);
+        const auto it = j.find("age");
+        if (it != j.end() && !it->is_null()) s.age = it->get<int>();
+        else s.age.reset();
+        j.at("tags").get_to(s.tags);
+    }
+
+    nj sample_document() {
+        return nj{
+            {"id", 1234567},
+            {"price", 101.25},
+            {"ok", true},
+            {"none", nullptr},
+            {"name", "j2"},
+            {"values", {1, -2, 300000, 4.5}},
+            {"nested", {{"a", "b"}, {"c", {1, 2, 3}}}},
+        };
+    }
+
+} // namespace
+
+TEST(JsonBinary, RoundTripBothFormats) {
+    const nj doc = sample_document();
+    for (auto format : { binary_format::msgpack, binary_format::cbor }) {
+        const auto bytes = j2::json::encode(doc, format);
+        EXPECT_LT(bytes.size(), doc.dump().size());
+
+        nj back;
+        ASSERT_TRUE(j2::json::decode(bytes, format, back));
+        EXPECT_EQ(back, doc);
+    }
+}
+
+TEST(JsonBinary, ReusesOutputBuffer) {
+    const nj doc = sample_document();
+    std::vector<std::uint8_t> out;
+    j2::json::encode(doc, binary_format::msgpack, out);
+    const auto* data = out.data();
+    const auto size = out.size();
+    for (int i = 0; i < 10; ++i) {
+        j2::json::encode(doc, binary_format::msgpack, out);
+        EXPECT_EQ(out.size(), size);       // 이전 내용 뒤에 덧붙이지 않음
+        EXPECT_EQ(out.data(), data);       // 재할당 없음
+    }
+}
+
+TEST(JsonBinary, RejectsMalformedInput) {
+    const auto bytes = j2::json::encode(sample_document(), binary_format::msgpack);
+    nj out;
+
+    EXPECT_FALSE(j2::json::decode(bytes.data(), bytes.size() / 2, binary_format::msgpack, out)); // 잘림
+
+    auto trailing = bytes;
+    trailing.push_back(0x01);
+    EXPECT_FALSE(j2::json::decode(trailing, binary_format::msgpack, out)); // 뒤에 남는 바이트
+
+    EXPECT_FALSE(j2::json::decode(nullptr, 0, binary_format::cbor, out)); // 빈 입력
+
+    const std::string text = R"({"a":1})";
+    EXPECT_FALSE(j2::json::decode(text.data(), text.size(), binary_format::msgpack, out)); // 텍스트 json
+}
+
+TEST(JsonBinary, TypedValues) {
+    Sample s{ "John Doe", 30, {"developer", "cpp", "json"} };
+    std::vector<std::uint8_t> out;
+    ASSERT_TRUE(j2::json::encode_value(s, binary_format::cbor, out));
+
+    Sample back;
+    ASSERT_TRUE(j2::json::decode_value(out.data(), out.size(), binary_format::cbor, back));
+    EXPECT_EQ(back.name, s.name);
+    EXPECT_EQ(back.age, s.age);
+    EXPECT_EQ(back.tags, s.tags);
+
+    // 형식이 맞지 않는 값 (name 누락)
+    const auto wrong = j2::json::encode(nj{ {"tags", nj::array()} }, binary_format::cbor);
+    EXPECT_FALSE(j2::json::decode_value(wrong.data(), wrong.size(), binary_format::cbor, back));
+}
+
+#ifdef __linux__
+
+TEST(JsonBinary, TypedUdpPubSub) {
+    j2::network::udp::udp_receiver receiver;
+    j2::network::udp::udp_typed_subscriber<Sample> sub(receiver);
+
+    std::mutex mu;
+    std::vector<Sample> got;
+    int errors = 0;
+    sub.setOnReceiveCallback([&](const Sample& s, const std::string&, uint16_t) {
+        std::lock_guard<std::mutex> lock(mu);
+        got.push_back(s);
+        });
+    sub.setOnErrorCallback([&](const std::string&, const std::string&, uint16_t) {
+        std::lock_guard<std::mutex> lock(mu);
+        ++errors;
+        });
+    ASSERT_TRUE(receiver.startUnicast("127.0.0.1", 0));
+
+    j2::network::udp::udp_sender sender;
+    sender.setServer("127.0.0.1", receiver.getLocalPort());
+    ASSERT_TRUE(sender.create());
+    j2::network::udp::udp_typed_publisher<Sample> pub(sender);
+
+    for (int i = 0; i < 5; ++i) {
+        Sample s{ "person-" + std::to_string(i), i % 2 ? std::optional<int>(i) : std::nullopt, {"t" + std::to_string(i)} };
+        ASSERT_GT(pub.publish(s), 0);
+        EXPECT_EQ(pub.last_size(), j2::json::encode(nj(s)).size());
+    }
+    sender.send_data(std::string("not msgpack"));
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+    for (;;) {
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            if (got.size() == 5 && errors == 1) break;
+        }
+        ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    receiver.quit();
+    sender.stop();
+
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(got[i].name, "person-" + std::to_string(i));
+        EXPECT_EQ(got[i].age.has_value(), i % 2 == 1);
+        EXPECT_EQ(got[i].tags, std::vector<std::string>{ "t" + std::to_string(i) });
+    }
+}
+
+#endif // __linux__
@@ -0,0 +1,62 @@
+// 파일: test_latency_histogram.cpp
+// 목적: j2::network::latency_histogram 의 집계/백분위 정확도를 GoogleTest로 검증
+
+#include <thread>
+#include <vector>
+
+#include "gtest_compat.hpp"
+#include "j2_library/network/latency_histogram.hpp"
+
+using j2::network::latency_histogram;
+
+TEST(latency_histogram, EmptyIsZero) {
+    latency_histogram h;
+    EXPECT_EQ(h.count(), 0u);
+    EXPECT_EQ(h.min(), 0u);
+    EXPECT_EQ(h.max(), 0u);
+    EXPECT_EQ(h.mean(), 0.0);
+    EXPECT_EQ(h.percentile(0.99), 0u);
+}
+
+TEST(latency_histogram, SummaryAndPercentiles) {
+    latency_histogram h;
+    for (std::uint64_t v = 1; v <= 10000; ++v) h.record(v * 1000); // 1us .. 10ms
+
+    EXPECT_EQ(h.count(), 10000u);
+    EXPECT_EQ(h.min(), 1000u);
+    EXPECT_EQ(h.max(), 10000000u);
+    EXPECT_NEAR(h.mean(), 5000500.0, 1.0);
+
+    // 버킷 하한값이므로 실제 값보다 최대 12.5% 작음
+    auto near = [](std::uint64_t got, double want) {
+        return static_cast<double>(got) <= want && static_cast<double>(got) >= want * 0.875;
+    };
+    EXPECT_TRUE(near(h.percentile(0.5), 5000000.0)) << h.percentile(0.5);
+    EXPECT_TRUE(near(h.percentile(0.99), 9900000.0)) << h.percentile(0.99);
+    EXPECT_EQ(h.percentile(0.0), 1000u);
+    EXPECT_FALSE(h.to_string().empty());
+
+    h.reset();
+    EXPECT_EQ(h.count(), 0u);
+    EXPECT_EQ(h.percentile(0.5), 0u);
+}
+
+TEST(latency_histogram, SmallValuesAreExact) {
+    latency_histogram h;
+    for (std::uint64_t v = 0; v < 16; ++v) h.record(v);
+    EXPECT_EQ(h.percentile(0.0), 0u);
+    EXPECT_EQ(h.percentile(1.0), 15u);
+}
+
+TEST(latency_histogram, ConcurrentRecord) {
+    latency_histogram h;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&h] {
+            for (int i = 0; i < 10000; ++i) h.record(static_cast<std::uint64_t>(i));
+            });
+    }
+    for (auto& t : threads) t.join();
+    EXPECT_EQ(h.count(), 40000u);
+    EXPECT_EQ(h.max(), 9999u);
+}
@@ -0,0 +1,98 @@
+// 파일: test_log_archiver.cpp
+// 목적: j2::log::rotating_archive_sink / j2::log::log_archiver 동작을 GoogleTest로 검증
+// - 회전 파일 이름 판별
+// - 회전 시 훅 호출 및 백그라운드 압축
+// - 보관 바이트 합계 정책에 따른 오래된 보관 파일 삭제
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <filesystem>
+
+#include <spdlog/spdlog.h>
+
+#include "gtest_compat.hpp"
+#include "log_test_util.hpp"
+#include "j2_library/log/log.hpp"
+
+namespace {
+
+    std::vector<std::filesystem::path> list_archives(const std::filesystem::path& base) {
+        std::vector<std::filesystem::path> out;
+        for (const auto& e : std::filesystem::directory_iterator(base.parent_path())) {
+            if (j2::log::rotating_archive_sink::is_rotated_name_of(base.string(), e.path().string())) {
+                out.push_back(e.path());
+            }
+        }
+        return out;
+    }
+
+} // namespace
+
+TEST(log_archiver, RotatedNameMatching) {
+    using j2::log::rotating_archive_sink;
+
+    const std::string base = "logs/all.log";
+    std::string rotated = rotating_archive_sink::make_rotated_name(base, 7);
+
+    EXPECT_TRUE(rotating_archive_sink::is_rotated_name_of(base, rotated));
+    EXPECT_TRUE(rotating_archive_sink::is_rotated_name_of(base, rotated + ".gz"));
+    EXPECT_TRUE(rotating_archive_sink::is_rotated_name_of(base, "logs/all.1.log")); // spdlog 기본 백업
+
+    EXPECT_FALSE(rotating_archive_sink::is_rotated_name_of(base, base));
+    EXPECT_FALSE(rotating_archive_sink::is_rotated_name_of(base, "logs/alerts.1.log"));
+    EXPECT_FALSE(rotating_archive_sink::is_rotated_name_of(base, "logs/all.backup.log"));
+    EXPECT_FALSE(rotating_archive_sink::is_rotated_name_of(base, "other/all.1.log"));
+    EXPECT_FALSE(rotating_archive_sink::is_rotated_name_of(base, rotated + ".gz.tmp"));
+}
+
+TEST(log_archiver, RotateCompressAndRetain) {
+    auto sandbox = j2_test::make_sandbox("j2_log_archiver_test_");
+    const auto base = sandbox / "all.log";
+
+    auto archiver = std::make_shared<j2::log::log_archiver>();
+    j2::log::log_archiver::policy p;
+    p.compress = true;
+    p.maxArchiveBytes = 0; // 먼저 무제한으로 회전 결과 확인
+    archiver->setPolicy(base.string(), p);
+    archiver->start();
+
+    std::vector<std::string> rotated;
+    auto hook = archiver->makeHook(base.string());
+    auto sink = std::make_shared<j2::log::rotating_archive_sink>(
+        base.string(), 4096,
+        [&rotated, hook](const std::string& path) { rotated.push_back(path); hook(path); });
+
+    spdlog::logger logger("j2_log_archiver_test", sink);
+    logger.set_pattern("%v");
+    const std::string line(100, 'x');
+    for (int i = 0; i < 400; ++i) {
+        logger.info(line);
+    }
+    logger.flush();
+    archiver->waitIdle();
+
+    ASSERT_GE(rotated.size(), 5u);
+    EXPECT_TRUE(std::filesystem::exists(base));
+    for (const auto& path : list_archives(base)) {
+        // 압축 가능한 빌드에서는 모든 보관 파일이 .gz 로 바뀌어야 함
+        if (j2::log::log_archiver::compressionAvailable()) {
+            EXPECT_EQ(path.extension().string(), ".gz") << path;
+        }
+    }
+
+    // 보관 바이트 상한을 낮추면 오래된 보관 파일부터 삭제
+    const std::uint64_t before = archiver->archivedBytes(base.string());
+    ASSERT_GT(before, 0u);
+    p.maxArchiveBytes = before / 2;
+    archiver->setPolicy(base.string(), p);
+    archiver->waitIdle();
+
+    EXPECT_LE(archiver->archivedBytes(base.string()), p.maxArchiveBytes);
+    EXPECT_LT(list_archives(base).size(), rotated.size());
+
+    archiver->stop();
+    std::error_code ec;
+    std::filesystem::remove_all(sandbox, ec);
+}
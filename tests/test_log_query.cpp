@@ -0,0 +1,139 @@
+// 파일: test_log_query.cpp
+// 목적: j2::log::log_index_writer / j2::log::log_query 동작을 GoogleTest로 검증
+// - 인덱스 구간 선택 (이진 탐색, 인덱스 공백/마지막 블록 처리)
+// - 회전된 여러 파일에 걸친 시간 구간/레벨/문자열 검색
+// - 필요한 구간만 읽는지 (읽은 바이트 < 전체 바이트)
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <filesystem>
+
+#include <spdlog/spdlog.h>
+
+#include "gtest_compat.hpp"
+#include "log_test_util.hpp"
+#include "j2_library/log/log.hpp"
+
+namespace {
+
+    j2::log::log_index_entry make_entry(std::int64_t firstSec, std::int64_t lastSec,
+        std::uint64_t offset, std::uint32_t length, std::uint32_t levelMask)
+    {
+        j2::log::log_index_entry e;
+        e.firstNs = firstSec * 1000000000LL;
+        e.lastNs = lastSec * 1000000000LL;
+        e.offset = offset;
+        e.length = length;
+        e.levelMask = levelMask;
+        return e;
+    }
+
+} // namespace
+
+TEST(log_query, SelectRanges) {
+    using j2::log::log_query;
+
+    const std::uint32_t infoOnly = 1u << spdlog::level::info;
+    const std::uint32_t withError = infoOnly | (1u << spdlog::level::err);
+
+    // [0,100) 은 인덱스 없음(공백), 이후 100 바이트씩 4개 블록, 끝의 50 바이트는 기록 중인 블록
+    std::vector<j2::log::log_index_entry> entries = {
+        make_entry(10, 19, 100, 100, infoOnly),
+        make_entry(20, 29, 200, 100, withError),
+        make_entry(30, 39, 300, 100, infoOnly),
+        make_entry(40, 49, 400, 100, withError),
+    };
+
+    j2::log::log_query_options opt;
+    opt.fromNs = 25 * 1000000000LL;
+    opt.toNs = 35 * 1000000000LL;
+
+    auto ranges = log_query::selectRanges(entries, 550, opt);
+    ASSERT_EQ(ranges.size(), 3u);
+    EXPECT_EQ(ranges[0].begin, 0u);     // 공백 구간
+    EXPECT_EQ(ranges[0].end, 100u);
+    EXPECT_EQ(ranges[1].begin, 200u);   // 시간 범위에 걸치는 2개 블록 (이어서 매핑)
+    EXPECT_EQ(ranges[1].end, 400u);
+    EXPECT_FALSE(ranges[1].exactTime);
+    EXPECT_EQ(ranges[2].begin, 500u);   // 기록 중인 마지막 블록
+    EXPECT_EQ(ranges[2].end, 550u);
+
+    // 레벨 조건: error 가 없는 블록은 제외
+    opt.minLevel = spdlog::level::err;
+    ranges = log_query::selectRanges(entries, 550, opt);
+    ASSERT_EQ(ranges.size(), 3u);
+    EXPECT_EQ(ranges[1].begin, 200u);
+    EXPECT_EQ(ranges[1].end, 300u);
+
+    // 시간 범위를 완전히 포함하는 블록은 줄 시각 검사를 생략
+    opt.minLevel = spdlog::level::trace;
+    opt.fromNs = 20 * 1000000000LL;
+    opt.toNs = 29 * 1000000000LL;
+    ranges = log_query::selectRanges(entries, 500, opt);
+    ASSERT_EQ(ranges.size(), 2u);
+    EXPECT_TRUE(ranges[1].exactTime);
+}
+
+TEST(log_query, ParseLineTime) {
+    const std::string line = "[2026-01-02 03:04:05.678] [info] hello";
+    std::int64_t ns = 0;
+    ASSERT_TRUE(j2::log::log_query::parseLineTime(line.data(), line.size(), true, ns));
+    EXPECT_EQ(ns, 1767323045678000000LL);
+
+    const std::string bad = "  continuation line";
+    EXPECT_FALSE(j2::log::log_query::parseLineTime(bad.data(), bad.size(), true, ns));
+}
+
+TEST(log_query, SearchRotatedFilesByTime) {
+    auto sandbox = j2_test::make_sandbox("j2_log_query_test_");
+    const auto base = sandbox / "all.log";
+
+    {
+        // 8 KB 마다 회전, 1 KB 마다 인덱스 레코드
+        auto sink = std::make_shared<j2::log::rotating_archive_sink>(base.string(), 8 * 1024, nullptr, 1024);
+        sink->set_formatter(std::make_unique<spdlog::pattern_formatter>(
+            "[%Y-%m-%d %H:%M:%S.%e] [%l] %v", spdlog::pattern_time_type::utc));
+
+        // 1초 간격의 메시지 2000개, 10개마다 error
+        const auto start = std::chrono::system_clock::time_point(std::chrono::seconds(1767225600)); // 2026-01-01 00:00:00 UTC
+        for (int i = 0; i < 2000; ++i) {
+            const std::string text = fmt::format("msg {:04} payload", i);
+            spdlog::details::log_msg msg(start + std::chrono::seconds(i), spdlog::source_loc{}, "q",
+                (i % 10 == 0) ? spdlog::level::err : spdlog::level::info, text);
+            sink->log(msg);
+        }
+        sink->flush();
+    }
+
+    auto files = j2::log::log_query::listFiles(base.string());
+    ASSERT_GE(files.size(), 5u);
+    EXPECT_EQ(files.back(), base.string());
+
+    j2::log::log_query_options opt;
+    opt.utc = true;
+    opt.fromNs = (1767225600LL + 500) * 1000000000LL;
+    opt.toNs = (1767225600LL + 799) * 1000000000LL;
+    opt.threads = 4;
+
+    j2::log::log_query_stats stats;
+    auto hits = j2::log::log_query::run(base.string(), opt, &stats);
+    ASSERT_EQ(hits.size(), 300u);
+    EXPECT_NE(hits.front().line.find("msg 0500"), std::string::npos);
+    EXPECT_NE(hits.back().line.find("msg 0799"), std::string::npos);
+    EXPECT_LT(stats.scannedBytes, stats.totalBytes / 2);
+
+    opt.minLevel = spdlog::level::err;
+    hits = j2::log::log_query::run(base.string(), opt);
+    EXPECT_EQ(hits.size(), 30u);
+
+    opt.minLevel = spdlog::level::trace;
+    opt.contains = "msg 0777";
+    hits = j2::log::log_query::run(base.string(), opt);
+    ASSERT_EQ(hits.size(), 1u);
+    EXPECT_NE(hits[0].line.find("[info]"), std::string::npos);
+
+    std::error_code ec;
+    std::filesystem::remove_all(sandbox, ec);
+}
@@ -0,0 +1,195 @@
+// 파일: test_network_sink.cpp
+// 목적: j2::log::network_sink 동작을 GoogleTest로 검증
+// - 레코드를 큰 UDP datagram 으로 묶어 전송하는지 (loopback)
+// - 전송 대기 버퍼가 가득 차면 로깅 스레드를 막지 않고 버리며 개수를 집계하는지
+// - TCP 수집기가 연결을 끊어도 (RST) 재연결 후 길이 프레임이 어긋나지 않는지
+
+#include <string>
+#include <memory>
+#include <chrono>
+
+#include <spdlog/spdlog.h>
+
+#include "gtest_compat.hpp"
+#include "net_test_util.hpp"
+#include "j2_library/log/log.hpp"
+
+#ifndef _WIN32
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <poll.h>
+
+namespace {
+
+    // 127.0.0.1 의 임의 포트에 바인드한 수신 소켓
+    int open_receiver(std::uint16_t& port) {
+        int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+        ::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+        socklen_t len = sizeof(addr);
+        ::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len);
+        port = ntohs(addr.sin_port);
+
+        timeval tv{ 2, 0 };
+        ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        return fd;
+    }
+
+    bool wait_readable(int fd, int timeout_ms) {
+        pollfd p{ fd, POLLIN, 0 };
+        return ::poll(&p, 1, timeout_ms) == 1;
+    }
+
+    // [길이(4, big-endian)][페이로드] 1개
+    bool read_frame(int fd, std::string& payload) {
+        const std::string h = j2_test::read_exactly(fd, 4);
+        if (h.size() != 4) return false;
+        const auto b = [&](int i) { return static_cast<std::uint32_t>(static_cast<unsigned char>(h[i])); };
+        const std::uint32_t n = (b(0) << 24) | (b(1) << 16) | (b(2) << 8) | b(3);
+        if (n == 0 || n > 1024 * 1024) return false;
+        payload = j2_test::read_exactly(fd, n);
+        return payload.size() == n;
+    }
+
+} // namespace
+
+TEST(network_sink, BatchesRecordsIntoDatagrams) {
+    std::uint16_t port = 0;
+    int rx = open_receiver(port);
+    ASSERT_GE(rx, 0);
+
+    j2::log::network_sink::options opt;
+    opt.host = "127.0.0.1";
+    opt.port = port;
+    opt.maxBatchBytes = 1000;
+    opt.flushIntervalMs = 50;
+
+    auto sink = std::make_shared<j2::log::network_sink>(opt);
+    spdlog::logger logger("j2_network_sink_test", sink);
+    logger.set_pattern("%v");
+
+    const int total = 100;
+    for (int i = 0; i < total; ++i) {
+        logger.info("record-{:03}", i); // 11 바이트 + 개행
+    }
+    logger.flush();
+
+    int lines = 0;
+    int datagrams = 0;
+    char buf[2048];
+    while (lines < total) {
+        ssize_t n = ::recv(rx, buf, sizeof(buf), 0);
+        if (n <= 0) break;
+        ++datagrams;
+        EXPECT_LE(static_cast<std::size_t>(n), opt.maxBatchBytes);
+        for (ssize_t k = 0; k < n; ++k) {
+            if (buf[k] == '\n') ++lines;
+        }
+    }
+
+    EXPECT_EQ(lines, total);
+    EXPECT_LT(datagrams, total / 10); // 1000 바이트 묶음이면 datagram 2개
+    EXPECT_EQ(sink->getStats().sentRecords, static_cast<std::uint64_t>(total));
+    EXPECT_EQ(sink->getStats().droppedRecords, 0u);
+    ::close(rx);
+}
+
+TEST(network_sink, DropsWhenQueueIsFull) {
+    j2::log::network_sink::options opt;
+    opt.host = "127.0.0.1";
+    opt.port = 9; // discard
+    opt.maxBatchBytes = 100;
+    opt.maxQueueBytes = 100;       // 60 바이트 레코드 1개만 들어감 (묶음 크기에 못 미쳐 전송 스레드도 깨우지 않음)
+    opt.flushIntervalMs = 10000;   // 시간 기준 전송은 일어나지 않게 함
+
+    auto sink = std::make_shared<j2::log::network_sink>(opt);
+    spdlog::logger logger("j2_network_sink_drop_test", sink);
+    logger.set_pattern("%v");
+
+    const auto t0 = std::chrono::steady_clock::now();
+    const std::string text(59, 'x');
+    for (int i = 0; i < 50; ++i) {
+        logger.info(text);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - t0;
+
+    // 버퍼가 찬 뒤에는 전송 스레드가 비우기 전까지 새 레코드를 버림
+    auto st = sink->getStats();
+    EXPECT_EQ(st.queuedRecords, 1u);
+    EXPECT_EQ(st.droppedRecords, 49u);
+    EXPECT_EQ(st.droppedBytes, 49u * 60u);
+    EXPECT_LT(elapsed, std::chrono::seconds(1));
+}
+
+TEST(network_sink, TcpReconnectsAfterCollectorReset) {
+    int lst = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(lst, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(::bind(lst, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    ASSERT_EQ(::listen(lst, 4), 0);
+    socklen_t len = sizeof(addr);
+    ::getsockname(lst, reinterpret_cast<sockaddr*>(&addr), &len);
+
+    j2::log::network_sink::options opt;
+    opt.protocol = j2::log::network_sink::transport::tcp;
+    opt.host = "127.0.0.1";
+    opt.port = ntohs(addr.sin_port);
+    opt.flushIntervalMs = 10;
+
+    auto sink = std::make_shared<j2::log::network_sink>(opt);
+    spdlog::logger logger("j2_network_sink_tcp_test", sink);
+    logger.set_pattern("%v");
+
+    ASSERT_TRUE(wait_readable(lst, 3000));
+    int c1 = ::accept(lst, nullptr, nullptr);
+    ASSERT_GE(c1, 0);
+
+    // 연결이 공개되기 전의 레코드는 버려지므로 프레임이 올 때까지 반복
+    std::string payload;
+    bool got = false;
+    for (int i = 0; i < 100 && !got; ++i) {
+        logger.info("first");
+        logger.flush();
+        got = wait_readable(c1, 30) && read_frame(c1, payload);
+    }
+    ASSERT_TRUE(got);
+    EXPECT_NE(payload.find("first\n"), std::string::npos);
+
+    // RST 로 끊음: 전송 중이던 sink 는 SIGPIPE 없이 실패하고 재연결해야 함
+    linger lg{ 1, 0 };
+    ::setsockopt(c1, SOL_SOCKET, SO_LINGER, &lg, sizeof(lg));
+    ::close(c1);
+
+    int c2 = -1;
+    for (int i = 0; i < 300 && c2 < 0; ++i) {
+        logger.info("during");
+        if (wait_readable(lst, 10)) c2 = ::accept(lst, nullptr, nullptr);
+    }
+    ASSERT_GE(c2, 0);
+
+    // 새 연결의 모든 프레임이 [길이][레코드...] 로 온전해야 함
+    got = false;
+    for (int i = 0; i < 100 && !got; ++i) {
+        logger.info("second");
+        logger.flush();
+        while (!got && wait_readable(c2, 30)) {
+            ASSERT_TRUE(read_frame(c2, payload));
+            EXPECT_EQ(payload.back(), '\n');
+            got = payload.find("second\n") != std::string::npos;
+        }
+    }
+    EXPECT_TRUE(got);
+
+    ::close(c2);
+    ::close(lst);
+}
+
+#endif // _WIN32
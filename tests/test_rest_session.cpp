@@ -0,0 +1,106 @@
+// 파일: test_rest_session.cpp
+// 목적: j2::network::rest::rest_session (CURLSH 공유 + easy 핸들 풀) 을 GoogleTest로 검증
+// - 세션에 연결한 서로 다른 클라이언트 객체들이 풀의 핸들과 함께 keep-alive 연결 하나를 재사용하는지
+// - 세션 없이 쓰면 클라이언트마다 새 연결을 맺는지 (비교 기준)
+// - GET/POST 클라이언트가 같은 세션을 공유하고, 핸들이 풀로 반납/재사용되는지
+// 로컬 루프백에 keep-alive 를 지원하는 최소 HTTP/1.1 서버를 띄워 accept 횟수를 셉니다.
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <memory>
+
+#include "gtest_compat.hpp"
+#include "http_test_util.hpp"
+#include "j2_library/network/network.hpp"
+
+#ifdef __linux__
+
+namespace {
+
+    using namespace j2::network::rest;
+    using j2_test::mini_http_server;
+
+    curl_get_client::response get_once(rest_session* session, long port) {
+        curl_get_client client;
+        client.set_server("http", "127.0.0.1", port, "/get");
+        client.set_timeout_ms(3000);
+        client.set_session(session);
+        return client.get({ {"n", "1"} });
+    }
+
+} // namespace
+
+TEST(rest_session, ClientsShareConnectionThroughSession) {
+    mini_http_server server;
+    rest_session session;
+
+    for (int i = 0; i < 5; ++i) {
+        const auto resp = get_once(&session, server.port); // 매번 새 클라이언트 객체
+        ASSERT_TRUE(resp.is_success()) << resp.error;
+        EXPECT_EQ(resp.body, "echo:GET /get?n=1 ");
+        EXPECT_EQ(resp.content_type, "text/plain");
+    }
+    EXPECT_EQ(server.requests.load(), 5);
+    EXPECT_EQ(server.accepted.load(), 1);      // keep-alive 연결 하나로 처리
+    EXPECT_EQ(session.created_handles(), 1u);  // 핸들도 하나를 재사용
+    EXPECT_EQ(session.idle_handles(), 1u);
+}
+
+TEST(rest_session, WithoutSessionEachClientConnects) {
+    mini_http_server server;
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(get_once(nullptr, server.port).is_success());
+    }
+    EXPECT_EQ(server.accepted.load(), 3);
+}
+
+TEST(rest_session, GetAndPostShareSession) {
+    mini_http_server server;
+    rest_session session;
+
+    curl_post_client post;
+    post.set_server("http", "127.0.0.1", server.port, "/post");
+    post.set_headers({ {"Content-Type", "application/json"} });
+    post.set_session(&session);
+
+    curl_get_client get;
+    get.set_server("http", "127.0.0.1", server.port, "/get");
+    get.set_session(&session);
+
+    curl_post_client::response out;
+    EXPECT_EQ(post.post(R"({"a":1})", out), curl_post_client::result_code::ok);
+    EXPECT_EQ(out.body, R"(echo:POST /post {"a":1})");
+    EXPECT_TRUE(get.get().is_success());
+    EXPECT_EQ(post.post("second").body, "echo:POST /post second");
+
+    EXPECT_EQ(server.requests.load(), 3);
+    EXPECT_EQ(server.accepted.load(), 1);
+}
+
+TEST(rest_session, ConcurrentClientsAndIdleLimit) {
+    mini_http_server server;
+    rest_session session(2);
+
+    std::vector<std::thread> threads;
+    std::atomic<int> ok{ 0 };
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 10; ++i) {
+                if (get_once(&session, server.port).is_success()) ++ok;
+            }
+            });
+    }
+    for (auto& t : threads) t.join();
+
+    EXPECT_EQ(ok.load(), 40);
+    EXPECT_LE(session.idle_handles(), 2u);
+    // 연결 캐시는 핸들별: 핸들 하나가 keep-alive 연결을 하나씩만 맺음
+    EXPECT_LE(server.accepted.load(), static_cast<int>(session.created_handles()));
+
+    session.set_max_idle_handles(0);
+    EXPECT_EQ(session.idle_handles(), 0u);
+}
+
+#endif // __linux__
@@ -0,0 +1,175 @@
+// 파일: test_shm_pubsub.cpp
+// 목적: j2::network::shm::shm_publisher / shm_subscriber 를 GoogleTest로 검증
+// - 발행한 메시지가 순서대로 모든 구독자에게 전달되는지
+// - UDP 데이터그램 한계(64KB)보다 큰 메시지가 링 경계를 넘어 전달되는지
+// - 느린 구독자가 덮어쓰인 메시지 수를 정확히 세는지
+// - 세그먼트가 없으면 구독이 실패하는지
+// - 이미 있는 세그먼트를 다른 발행자가 가로채지 않고, 기본 권한이 소유자 전용인지
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <future>
+
+#include "gtest_compat.hpp"
+#include "net_test_util.hpp"
+#include "j2_library/network/network.hpp"
+
+#ifdef __linux__
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace {
+
+    using namespace j2::network::shm;
+    using j2_test::wait_until;
+
+    std::string segment_name(const std::string& name) {
+        return "/j2_test_shm_" + name + "_" + std::to_string(::getpid());
+    }
+
+    struct collecting_subscriber {
+        shm_subscriber subscriber;
+        std::mutex mu;
+        std::vector<std::string> got;
+
+        collecting_subscriber() {
+            subscriber.setOnReceiveCallback([this](std::string_view data) {
+                std::lock_guard<std::mutex> lock(mu);
+                got.emplace_back(data);
+                });
+        }
+        std::size_t count() {
+            std::lock_guard<std::mutex> lock(mu);
+            return got.size();
+        }
+    };
+
+} // namespace
+
+TEST(shm_pubsub, DeliversInOrderToAllSubscribers) {
+    const auto name = segment_name("order");
+    shm_publisher pub;
+    ASSERT_TRUE(pub.create(name, 64 * 1024));
+
+    collecting_subscriber a, b;
+    ASSERT_TRUE(a.subscriber.start(name));
+    ASSERT_TRUE(b.subscriber.start(name));
+
+    // Small ring + many messages: the records wrap several times while both keep up
+    std::vector<std::string> sent;
+    for (int i = 0; i < 2000; ++i) {
+        sent.push_back("message-" + std::to_string(i) + std::string(static_cast<std::size_t>(i % 97), '*'));
+        ASSERT_EQ(pub.send_data(sent.back()), static_cast<ssize_t>(sent.back().size()));
+        if (i % 64 == 0) {
+            ASSERT_TRUE(wait_until([&] { return a.count() == sent.size() && b.count() == sent.size(); }));
+        }
+    }
+    ASSERT_TRUE(wait_until([&] { return a.count() == sent.size() && b.count() == sent.size(); }));
+    a.subscriber.quit();
+    b.subscriber.quit();
+
+    EXPECT_EQ(a.got, sent);
+    EXPECT_EQ(b.got, sent);
+    EXPECT_EQ(a.subscriber.getDroppedCount(), 0u);
+    EXPECT_EQ(b.subscriber.getDroppedCount(), 0u);
+}
+
+TEST(shm_pubsub, LargeMessages) {
+    const auto name = segment_name("large");
+    shm_publisher pub;
+    ASSERT_TRUE(pub.create(name, 1024 * 1024));
+    EXPECT_GE(pub.max_message_size(), 256u * 1024u);
+    EXPECT_EQ(pub.send_data(std::string(pub.max_message_size() + 1, 'x')), -1);
+
+    collecting_subscriber sub;
+    ASSERT_TRUE(sub.subscriber.start(name));
+
+    std::vector<std::string> sent;
+    for (int i = 0; i < 12; ++i) {
+        std::string payload(200 * 1024 + static_cast<std::size_t>(i) * 1000, static_cast<char>('a' + i));
+        sent.push_back(payload);
+        ASSERT_GT(pub.send_data(payload), 0);
+        ASSERT_TRUE(wait_until([&] { return sub.count() == sent.size(); }));
+    }
+    sub.subscriber.quit();
+    EXPECT_EQ(sub.got, sent);
+}
+
+TEST(shm_pubsub, SlowSubscriberCountsDrops) {
+    const auto name = segment_name("drops");
+    shm_publisher pub;
+    ASSERT_TRUE(pub.create(name, 4096));
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<int> received{ 0 };
+    std::atomic<bool> last_seen{ false };
+
+    shm_subscriber sub;
+    sub.setOnReceiveCallback([&](std::string_view data) {
+        if (received.fetch_add(1) == 0) released.wait();   // stall on the first message
+        if (data == "last") last_seen = true;
+        });
+    ASSERT_TRUE(sub.start(name));
+
+    const int total = 500;
+    for (int i = 0; i < total; ++i) {
+        ASSERT_GT(pub.send_data("payload-" + std::to_string(i) + std::string(40, '.')), 0);
+        if (i == 0) {
+            ASSERT_TRUE(wait_until([&] { return received.load() == 1; }));
+        }
+    }
+    release.set_value();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_GT(pub.send_data(std::string("last")), 0);
+    ASSERT_TRUE(wait_until([&] { return last_seen.load(); }));
+    sub.quit();
+
+    EXPECT_GT(sub.getDroppedCount(), 0u);
+    EXPECT_EQ(static_cast<std::uint64_t>(received.load()) + sub.getDroppedCount(), static_cast<std::uint64_t>(total + 1));
+}
+
+TEST(shm_pubsub, StartFailsWithoutSegment) {
+    shm_subscriber sub;
+    EXPECT_FALSE(sub.start(segment_name("missing")));
+
+    const auto name = segment_name("stopped");
+    {
+        shm_publisher pub;
+        ASSERT_TRUE(pub.create(name, 4096));
+    }   // stop() unlinks the name
+    EXPECT_FALSE(sub.start(name));
+}
+
+TEST(shm_pubsub, CreateDoesNotTakeOverExistingSegment) {
+    const auto name = segment_name("owned");
+    shm_publisher owner;
+    ASSERT_TRUE(owner.create(name, 4096));
+
+    shm_publisher other;
+    EXPECT_FALSE(other.create(name, 4096));   // the owner's subscribers stay on its segment
+
+    shm_subscriber sub;
+    std::atomic<int> received{ 0 };
+    sub.setOnReceiveCallback([&](std::string_view) { ++received; });
+    ASSERT_TRUE(sub.start(name));
+    ASSERT_GT(owner.send_data(std::string("still here")), 0);
+    EXPECT_TRUE(wait_until([&] { return received.load() == 1; }));
+    sub.quit();
+
+    struct stat st{};
+    const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(fstat(fd, &st), 0);
+    ::close(fd);
+    EXPECT_EQ(st.st_mode & 0077, 0u);   // owner only by default
+}
+
+#endif // __linux__
@@ -0,0 +1,145 @@
+// 파일: test_socket_options.cpp
+// 목적: j2::network::socket_options 프로파일을 GoogleTest로 검증
+// - 프리셋(low_latency / bulk_throughput)이 소켓 옵션에 그대로 반영되는지 (getsockopt 로 확인)
+// - UDP 소켓에서는 TCP 전용 옵션을 건너뛰는지
+// - tcp_server / tcp_client / udp_sender / udp_receiver 가 생성 시 받은 프로파일을 적용하는지
+
+#include <string>
+#include <chrono>
+#include <thread>
+
+#include "gtest_compat.hpp"
+#include "net_test_util.hpp"
+#include "j2_library/network/network.hpp"
+
+#ifdef __linux__
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+namespace {
+
+    using j2::network::socket_options;
+    using j2::network::tcp::tcp_server;
+    using j2::network::tcp::tcp_client;
+    using j2::network::udp::udp_sender;
+    using j2::network::udp::udp_receiver;
+    using j2_test::test_server;
+    using j2_test::test_receiver;
+    using j2_test::wait_until;
+
+    int get_int(int fd, int level, int name) {
+        int value = -1;
+        socklen_t len = sizeof(value);
+        ::getsockopt(fd, level, name, &value, &len);
+        return value;
+    }
+
+    class test_client : public tcp_client {
+    public:
+        using tcp_client::tcp_client;
+        int fd() const { return socket_fd; }
+    };
+
+    class test_sender : public udp_sender {
+    public:
+        using udp_sender::udp_sender;
+        int fd() const { return socket_fd; }
+    };
+
+} // namespace
+
+TEST(socket_options, LowLatencyOnTcpSocket) {
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(fd, 0);
+    EXPECT_TRUE(socket_options::low_latency().apply(fd));
+
+    EXPECT_NE(get_int(fd, IPPROTO_TCP, TCP_NODELAY), 0);
+    EXPECT_NE(get_int(fd, SOL_SOCKET, SO_KEEPALIVE), 0);
+    EXPECT_EQ(get_int(fd, IPPROTO_TCP, TCP_KEEPIDLE), 5);
+    EXPECT_EQ(get_int(fd, IPPROTO_TCP, TCP_KEEPINTVL), 1);
+    EXPECT_EQ(get_int(fd, IPPROTO_TCP, TCP_KEEPCNT), 3);
+    EXPECT_EQ(get_int(fd, IPPROTO_TCP, TCP_USER_TIMEOUT), 5000);
+    EXPECT_EQ(get_int(fd, SOL_SOCKET, SO_PRIORITY), 6);
+    ::close(fd);
+}
+
+TEST(socket_options, BulkAndExplicitBuffers) {
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(fd, 0);
+    EXPECT_TRUE(socket_options::bulk_throughput().apply(fd));
+    EXPECT_EQ(get_int(fd, IPPROTO_TCP, TCP_NODELAY), 0);
+    EXPECT_EQ(get_int(fd, IPPROTO_TCP, TCP_KEEPIDLE), 60);
+    ::close(fd);
+
+    // 작은 값은 rmem_max/wmem_max 에 걸리지 않음 (커널이 두 배로 보고)
+    socket_options o;
+    o.send_buffer = 64 * 1024;
+    o.receive_buffer = 32 * 1024;
+    fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    EXPECT_TRUE(o.apply(fd));
+    EXPECT_EQ(get_int(fd, SOL_SOCKET, SO_SNDBUF), 2 * 64 * 1024);
+    EXPECT_EQ(get_int(fd, SOL_SOCKET, SO_RCVBUF), 2 * 32 * 1024);
+    ::close(fd);
+}
+
+TEST(socket_options, UdpSkipsTcpOptions) {
+    int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+    ASSERT_GE(fd, 0);
+    EXPECT_TRUE(socket_options::low_latency().apply(fd)); // TCP_NODELAY 등은 시도하지 않음
+    EXPECT_EQ(get_int(fd, SOL_SOCKET, SO_PRIORITY), 6);
+    ::close(fd);
+
+    socket_options none;
+    EXPECT_TRUE(none.apply(0)); // 설정할 것이 없으면 아무것도 하지 않음
+    EXPECT_FALSE(none.apply(-1));
+}
+
+TEST(socket_options, AppliedByTcpClasses) {
+    test_server server(socket_options::low_latency());
+    server.setBackend(tcp_server::Backend::Epoll);
+    ASSERT_EQ(server.start("127.0.0.1", 0), tcp_server::StartResult::Success);
+    EXPECT_EQ(get_int(server.listen_fd(), SOL_SOCKET, SO_PRIORITY), 6);
+
+    socket_options clientOpts;
+    clientOpts.tcp_nodelay = true;
+    clientOpts.tcp_user_timeout_ms = 1234;
+    test_client client(clientOpts);
+    client.setServer("127.0.0.1", server.port());
+    ASSERT_TRUE(client.start());
+    ASSERT_TRUE(wait_until([&] { return client.is_connected() && server.getClientCount() == 1; }));
+
+    EXPECT_NE(get_int(client.fd(), IPPROTO_TCP, TCP_NODELAY), 0);
+    EXPECT_EQ(get_int(client.fd(), IPPROTO_TCP, TCP_USER_TIMEOUT), 1234);
+
+    const int accepted = server.getClientSockets().front();
+    EXPECT_NE(get_int(accepted, IPPROTO_TCP, TCP_NODELAY), 0);
+    EXPECT_EQ(get_int(accepted, IPPROTO_TCP, TCP_KEEPCNT), 3);
+
+    client.stop();
+    server.quit();
+}
+
+TEST(socket_options, AppliedByUdpClasses) {
+    socket_options o;
+    o.receive_buffer = 48 * 1024;
+    o.priority = 4;
+
+    test_receiver receiver(udp_receiver::IpVersion::IPv4, o);
+    ASSERT_TRUE(receiver.startUnicast("127.0.0.1", 0));
+    EXPECT_EQ(get_int(receiver.fd(), SOL_SOCKET, SO_RCVBUF), 2 * 48 * 1024);
+    EXPECT_EQ(get_int(receiver.fd(), SOL_SOCKET, SO_PRIORITY), 4);
+    receiver.quit();
+
+    test_sender sender;
+    sender.set_socket_options(o);
+    sender.setServer("127.0.0.1", 9);
+    ASSERT_TRUE(sender.create());
+    EXPECT_EQ(get_int(sender.fd(), SOL_SOCKET, SO_PRIORITY), 4);
+    sender.stop();
+}
+
+#endif // __linux__
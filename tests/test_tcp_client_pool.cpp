@@ -0,0 +1,224 @@
+// 파일: test_tcp_client_pool.cpp
+// 목적: j2::network::tcp::tcp_client_pool 동작을 GoogleTest로 검증
+// - 하나의 루프로 여러 연결을 맺고 연결별 콜백(on_connect/on_receive)이 호출되는지
+// - send_data 가 연결별로 전달되고 echo 응답이 해당 연결로만 돌아오는지
+// - 서버가 없을 때 지수 백오프로 재시도하다가 서버가 뜨면 접속하는지
+// - SYN 이 응답 없이 버려질 때 connect_timeout 후 포기하고 다시 시도하는지
+// - 서버가 끊으면 on_close 후 다시 접속하는지, remove/stop 이 멈추지 않는지
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <map>
+
+#include "gtest_compat.hpp"
+#include "net_test_util.hpp"
+#include "j2_library/network/network.hpp"
+
+#ifdef __linux__
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+namespace {
+
+    using j2::network::tcp::tcp_server;
+    using j2::network::tcp::tcp_client_pool;
+    using j2::network::tcp::framing;
+    using j2_test::test_server;
+    using j2_test::wait_until;
+
+    // 바인드 후 닫아 당분간 아무도 듣지 않는 포트를 얻음
+    std::uint16_t unused_port() {
+        int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        ::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+        socklen_t len = sizeof(addr);
+        ::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len);
+        ::close(fd);
+        return ntohs(addr.sin_port);
+    }
+
+} // namespace
+
+TEST(tcp_client_pool, ConnectsAndEchoesPerConnection) {
+    test_server server;
+    server.setBackend(tcp_server::Backend::Epoll);
+    server.setFraming(framing::delimited());
+    server.setOnMessageCallback([&](int fd, std::string_view msg) {
+        server.sendToClient(fd, std::string(msg) + "\n"); // echo
+        });
+    ASSERT_EQ(server.start("127.0.0.1", 0), tcp_server::StartResult::Success);
+
+    tcp_client_pool pool;
+    std::mutex mu;
+    std::map<int, std::vector<std::string>> received;
+    std::atomic<int> connects{ 0 };
+
+    const int count = 16;
+    std::vector<int> ids;
+    for (int i = 0; i < count; ++i) {
+        const int id = pool.add("127.0.0.1", server.port());
+        ASSERT_GE(id, 0);
+        pool.set_framing(id, framing::delimited());
+        pool.set_on_connect(id, [&] { ++connects; });
+        pool.set_on_message(id, [&, id](std::string_view msg) {
+            std::lock_guard<std::mutex> lock(mu);
+            received[id].emplace_back(msg);
+            });
+        ids.push_back(id);
+    }
+    EXPECT_EQ(pool.send_data(ids[0], "early\n"), -1); // 아직 연결 전
+
+    ASSERT_TRUE(pool.start());
+    ASSERT_TRUE(wait_until([&] { return pool.connected_count() == static_cast<std::size_t>(count); }));
+    EXPECT_EQ(connects.load(), count);
+    ASSERT_TRUE(wait_until([&] { return server.getClientCount() == static_cast<std::size_t>(count); }));
+
+    for (int id : ids) {
+        const std::string msg = "hello-" + std::to_string(id) + "\n";
+        EXPECT_EQ(pool.send_data(id, msg), static_cast<int>(msg.size()));
+    }
+    ASSERT_TRUE(wait_until([&] {
+        std::lock_guard<std::mutex> lock(mu);
+        return received.size() == static_cast<std::size_t>(count);
+        }));
+    {
+        std::lock_guard<std::mutex> lock(mu);
+        for (int id : ids) {
+            ASSERT_EQ(received[id].size(), 1u);
+            EXPECT_EQ(received[id][0], "hello-" + std::to_string(id));
+        }
+    }
+
+    // 제거된 연결은 닫히고 더 이상 보낼 수 없음
+    pool.remove(ids[0]);
+    ASSERT_TRUE(wait_until([&] { return server.getClientCount() == static_cast<std::size_t>(count - 1); }));
+    EXPECT_EQ(pool.size(), static_cast<std::size_t>(count - 1));
+    EXPECT_EQ(pool.send_data(ids[0], "x\n"), -1);
+
+    pool.stop();
+    EXPECT_EQ(pool.connected_count(), 0u);
+    server.quit();
+}
+
+TEST(tcp_client_pool, BacksOffUntilServerAppears) {
+    const std::uint16_t port = unused_port();
+
+    tcp_client_pool pool;
+    pool.set_backoff(std::chrono::milliseconds(20), std::chrono::milliseconds(200));
+    std::atomic<int> connects{ 0 };
+    const int id = pool.add("127.0.0.1", port);
+    pool.set_on_connect(id, [&] { ++connects; });
+    ASSERT_TRUE(pool.start());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_FALSE(pool.is_connected(id));
+    EXPECT_EQ(connects.load(), 0);
+
+    test_server server;
+    ASSERT_EQ(server.start("127.0.0.1", port), tcp_server::StartResult::Success);
+    // 백오프 상한(200ms, 지터 포함) 안에 접속
+    ASSERT_TRUE(wait_until([&] { return pool.is_connected(id); }, std::chrono::seconds(2)));
+    EXPECT_EQ(connects.load(), 1);
+
+    pool.stop();
+    server.quit();
+}
+
+TEST(tcp_client_pool, ConnectTimeoutRetriesSilentServer) {
+    // backlog 0 의 accept 큐를 채우면 커널이 이후 SYN 을 응답 없이 버림
+    int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(::bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    ASSERT_EQ(::listen(listener, 0), 0);
+    socklen_t len = sizeof(addr);
+    ::getsockname(listener, reinterpret_cast<sockaddr*>(&addr), &len);
+
+    int filler = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_EQ(::connect(filler, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+
+    tcp_client_pool pool;
+    pool.set_backoff(std::chrono::milliseconds(20), std::chrono::milliseconds(50));
+    pool.set_connect_timeout(std::chrono::milliseconds(100));
+    const int id = pool.add("127.0.0.1", ntohs(addr.sin_port));
+    ASSERT_TRUE(pool.start());
+
+    // 첫 SYN 재전송(1초) 이후까지 대기
+    std::this_thread::sleep_for(std::chrono::milliseconds(1200));
+    EXPECT_FALSE(pool.is_connected(id));
+
+    // 큐를 비우면 다음 재시도가 곧바로 접속 (커널의 다음 SYN 재전송은 3초 시점)
+    int accepted = ::accept(listener, nullptr, nullptr);
+    ASSERT_GE(accepted, 0);
+    EXPECT_TRUE(wait_until([&] { return pool.is_connected(id); }, std::chrono::milliseconds(800)));
+
+    pool.stop();
+    ::close(accepted);
+    ::close(filler);
+    ::close(listener);
+}
+
+TEST(tcp_client_pool, ReconnectsAfterServerCloses) {
+    test_server server;
+    server.setBackend(tcp_server::Backend::Epoll);
+    ASSERT_EQ(server.start("127.0.0.1", 0), tcp_server::StartResult::Success);
+
+    tcp_client_pool pool;
+    pool.set_backoff(std::chrono::milliseconds(10), std::chrono::milliseconds(100));
+    std::atomic<int> connects{ 0 };
+    std::atomic<int> closes{ 0 };
+    const int id = pool.add("127.0.0.1", server.port());
+    pool.set_on_connect(id, [&] { ++connects; });
+    pool.set_on_close(id, [&] { ++closes; });
+    ASSERT_TRUE(pool.start());
+    ASSERT_TRUE(wait_until([&] { return server.getClientCount() == 1; }));
+
+    server.closeClient(server.getClientSockets().front());
+    ASSERT_TRUE(wait_until([&] { return closes.load() == 1 && connects.load() == 2; }));
+    ASSERT_TRUE(wait_until([&] { return server.getClientCount() == 1; }));
+
+    // 새 연결로도 보낼 수 있음
+    std::atomic<bool> got{ false };
+    server.setOnReceiveCallback([&](int, const std::string& msg) { if (msg == "again") got = true; });
+    ASSERT_TRUE(wait_until([&] { return pool.is_connected(id); }));
+    EXPECT_EQ(pool.send_data(id, "again"), 5);
+    EXPECT_TRUE(wait_until([&] { return got.load(); }));
+
+    pool.stop();
+    EXPECT_EQ(closes.load(), 2); // stop() 도 on_close 호출
+    server.quit();
+}
+
+TEST(tcp_client_pool, LargeSendIsQueuedWithoutBlocking) {
+    test_server server;
+    server.setBackend(tcp_server::Backend::Epoll);
+    std::atomic<std::size_t> bytes{ 0 };
+    server.setOnReceiveCallback([&](int, const std::string& msg) { bytes += msg.size(); });
+    ASSERT_EQ(server.start("127.0.0.1", 0), tcp_server::StartResult::Success);
+
+    tcp_client_pool pool;
+    const int id = pool.add("127.0.0.1", server.port());
+    ASSERT_TRUE(pool.start());
+    ASSERT_TRUE(wait_until([&] { return pool.is_connected(id); }));
+
+    const std::string payload(1024 * 1024, 'z');
+    for (int i = 0; i < 16; ++i) {
+        ASSERT_EQ(pool.send_data(id, payload), static_cast<int>(payload.size()));
+    }
+    EXPECT_TRUE(wait_until([&] { return bytes.load() == 16u * payload.size(); }, std::chrono::seconds(10)));
+
+    pool.stop();
+    server.quit();
+}
+
+#endif // __linux__
@@ -0,0 +1,185 @@
+// 파일: test_tcp_connection_stats.cpp
+// 목적: tcp_server / tcp_client 의 연결별 통계(connection_stats) 를 GoogleTest로 검증
+// - 애플리케이션 바이트/메시지 수(in/out)가 양쪽에서 집계되는지 (Thread/Epoll 백엔드)
+// - TCP_INFO 샘플(상태, RTT, 큐 깊이)이 채워지는지
+// - 주기적 덤프가 sink 로 전달되고 quit()/stop() 에서 멈추는지
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <memory>
+#include <mutex>
+
+#include "gtest_compat.hpp"
+#include "net_test_util.hpp"
+#include "j2_library/network/network.hpp"
+
+#ifdef __linux__
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+namespace {
+
+    using j2::network::tcp::tcp_server;
+    using j2::network::tcp::tcp_client;
+    using j2::network::tcp::framing;
+    using j2::network::tcp::connection_stats;
+    using j2_test::test_server;
+    using j2_test::wait_until;
+
+    class TcpConnectionStats : public ::testing::TestWithParam<tcp_server::Backend> {};
+
+} // namespace
+
+TEST_P(TcpConnectionStats, CountsBothDirections) {
+    test_server server;
+    server.setBackend(GetParam());
+    server.setFraming(framing::delimited());
+    std::atomic<int> messages{ 0 };
+    server.setOnMessageCallback([&](int, std::string_view) { ++messages; });
+    ASSERT_EQ(server.start("127.0.0.1", 0), tcp_server::StartResult::Success);
+
+    tcp_client client;
+    client.setServer("127.0.0.1", server.port());
+    std::atomic<std::size_t> clientBytes{ 0 };
+    client.set_on_receive([&](const std::string& msg) { clientBytes += msg.size(); });
+    ASSERT_TRUE(client.start());
+    ASSERT_TRUE(wait_until([&] { return client.is_connected() && server.getClientCount() == 1; }));
+    const int fd = server.getClientSockets().front();
+
+    // 클라이언트 -> 서버: 메시지 3 개 (12 바이트)
+    ASSERT_EQ(client.send_data("aaa\nbbb\nccc\n"), 12);
+    ASSERT_TRUE(wait_until([&] { return messages.load() == 3; }));
+
+    connection_stats s;
+    ASSERT_TRUE(server.getConnectionStats(fd, s));
+    EXPECT_EQ(s.socket, fd);
+    EXPECT_EQ(s.bytes_in, 12u);
+    EXPECT_EQ(s.messages_in, 3u);
+    EXPECT_TRUE(s.tcp_info_valid);
+    EXPECT_EQ(s.state, TCP_ESTABLISHED);
+    EXPECT_GT(s.snd_mss, 0u);
+    EXPECT_EQ(s.recv_queue_bytes, 0u);
+
+    // 서버 -> 클라이언트: 2 번 전송
+    ASSERT_EQ(server.sendToClient(fd, "hello"), 5);
+    ASSERT_EQ(server.sendToClient(fd, "world!"), 6);
+    ASSERT_TRUE(wait_until([&] { return clientBytes.load() == 11; }));
+    ASSERT_TRUE(server.getConnectionStats(fd, s));
+    EXPECT_EQ(s.bytes_out, 11u);
+    EXPECT_EQ(s.messages_out, 2u);
+
+    const connection_stats c = client.get_stats();
+    EXPECT_TRUE(c.tcp_info_valid);
+    EXPECT_EQ(c.bytes_out, 12u);
+    EXPECT_EQ(c.messages_out, 1u);
+    EXPECT_EQ(c.bytes_in, 11u);
+    EXPECT_GE(c.messages_in, 1u); // 프레이밍 없음: 수신 단위마다 1
+    EXPECT_NE(c.to_string().find("rtt="), std::string::npos);
+
+    EXPECT_FALSE(server.getConnectionStats(fd + 1000, s));
+    EXPECT_EQ(server.getAllConnectionStats().size(), 1u);
+
+    client.stop();
+    ASSERT_TRUE(wait_until([&] { return server.getClientCount() == 0; }));
+    EXPECT_FALSE(server.getConnectionStats(fd, s));
+    server.quit();
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends, TcpConnectionStats,
+    ::testing::Values(tcp_server::Backend::Thread, tcp_server::Backend::Epoll));
+
+TEST(tcp_connection_stats, PeriodicDump) {
+    test_server server;
+    server.setBackend(tcp_server::Backend::Epoll);
+    ASSERT_EQ(server.start("127.0.0.1", 0), tcp_server::StartResult::Success);
+
+    tcp_client client;
+    client.setServer("127.0.0.1", server.port());
+    ASSERT_TRUE(client.start());
+    ASSERT_TRUE(wait_until([&] { return server.getClientCount() == 1; }));
+
+    std::mutex mu;
+    std::vector<std::size_t> dumps;
+    ASSERT_TRUE(server.startStatsDump(std::chrono::milliseconds(20), [&](const std::vector<connection_stats>& all) {
+        std::lock_guard<std::mutex> lock(mu);
+        dumps.push_back(all.size());
+        }));
+    EXPECT_FALSE(server.startStatsDump(std::chrono::milliseconds(20))); // 이미 실행 중
+
+    std::atomic<int> clientDumps{ 0 };
+    ASSERT_TRUE(client.start_stats_dump(std::chrono::milliseconds(20), [&](const std::vector<connection_stats>& all) {
+        if (all.size() == 1 && all[0].tcp_info_valid) ++clientDumps;
+        }));
+
+    ASSERT_TRUE(wait_until([&] {
+        std::lock_guard<std::mutex> lock(mu);
+        return dumps.size() >= 3;
+        }));
+    ASSERT_TRUE(wait_until([&] { return clientDumps.load() >= 3; }));
+    {
+        std::lock_guard<std::mutex> lock(mu);
+        EXPECT_EQ(dumps.front(), 1u);
+    }
+
+    client.stop(); // 덤프도 멈춤
+    server.quit();
+    std::size_t after = 0;
+    {
+        std::lock_guard<std::mutex> lock(mu);
+        after = dumps.size();
+    }
+    const int clientAfter = clientDumps.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(80));
+    std::lock_guard<std::mutex> lock(mu);
+    EXPECT_EQ(dumps.size(), after);
+    EXPECT_EQ(clientDumps.load(), clientAfter);
+}
+
+TEST(tcp_connection_stats, StopFromSink) {
+    j2::network::tcp::stats_dumper dumper;
+    std::atomic<int> calls{ 0 };
+    ASSERT_TRUE(dumper.start(std::chrono::milliseconds(5),
+        [] { return std::vector<connection_stats>{}; },
+        [&](const std::vector<connection_stats>&) {
+            ++calls;
+            dumper.stop(); // 싱크에서 멈춤: 스레드는 여기서 분리되지 않고 이후 join 됨
+        }));
+    ASSERT_TRUE(wait_until([&] { return calls.load() == 1; }));
+    ASSERT_TRUE(wait_until([&] { return !dumper.is_running(); }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    EXPECT_EQ(calls.load(), 1);
+
+    // 다시 시작 가능 (멈춘 스레드는 start() 가 join)
+    ASSERT_TRUE(dumper.start(std::chrono::milliseconds(5),
+        [] { return std::vector<connection_stats>{}; },
+        [&](const std::vector<connection_stats>&) { ++calls; }));
+    ASSERT_TRUE(wait_until([&] { return calls.load() >= 3; }));
+    dumper.stop();
+    EXPECT_FALSE(dumper.is_running());
+}
+
+TEST(tcp_connection_stats, DestroyFromSink) {
+    auto dumper = std::make_unique<j2::network::tcp::stats_dumper>();
+    std::atomic<bool> armed{ false };
+    std::atomic<int> calls{ 0 };
+    ASSERT_TRUE(dumper->start(std::chrono::milliseconds(5),
+        [] { return std::vector<connection_stats>{}; },
+        [&](const std::vector<connection_stats>&) {
+            if (!armed) return;
+            ++calls;
+            dumper.reset(); // 싱크에서 소멸: 루프는 공유 상태만 쓰고 스스로 끝남
+        }));
+    armed = true;
+    ASSERT_TRUE(wait_until([&] { return calls.load() == 1; }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    EXPECT_EQ(calls.load(), 1);
+}
+
+#endif // __linux__
@@ -0,0 +1,210 @@
+// 파일: test_tcp_framing.cpp
+// 목적: j2::network::tcp::frame_decoder 및 tcp_server/tcp_client 프레이밍 수신을 GoogleTest로 검증
+// - 길이 접두/구분자/고정 크기 모드에서 TCP 조각을 완전한 메시지로 재조립하는지
+// - NUL 바이트가 포함된 데이터를 잘리지 않고 전달하는지
+// - 최대 메시지 크기 초과 시 Error 를 반환하는지
+// - tcp_server(Thread/Epoll) 와 tcp_client 가 on_message 로 메시지 단위 전달하는지 (loopback)
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <cstring>
+#include <algorithm>
+
+#include "gtest_compat.hpp"
+#include "net_test_util.hpp"
+#include "j2_library/network/network.hpp"
+
+using j2::network::tcp::framing;
+using j2::network::tcp::frame_decoder;
+
+namespace {
+
+    // data 를 chunk 바이트씩 나누어 넣고 완성된 메시지를 모은다
+    std::vector<std::string> feed(frame_decoder& dec, const std::string& data, std::size_t chunk,
+        bool* error = nullptr) {
+        std::vector<std::string> out;
+        for (std::size_t off = 0, n = 0; off < data.size(); off += n) {
+            char* p = dec.prepare();
+            n = std::min({ chunk, data.size() - off, dec.writable() });
+            std::memcpy(p, data.data() + off, n);
+            dec.commit(n);
+
+            std::string_view msg;
+            frame_decoder::Result r;
+            while ((r = dec.next(msg)) == frame_decoder::Result::Message) {
+                out.emplace_back(msg);
+            }
+            if (r == frame_decoder::Result::Error) {
+                if (error) *error = true;
+                break;
+            }
+        }
+        return out;
+    }
+
+} // namespace
+
+TEST(tcp_framing, LengthPrefixReassemblesFragments) {
+    const framing f = framing::length_prefix(4);
+    std::string wire;
+    const std::string binary("a\0b\0c", 5);
+    f.encode(wire, "hello");
+    f.encode(wire, binary);
+    f.encode(wire, "");
+    f.encode(wire, std::string(50000, 'x'));
+
+    for (std::size_t chunk : { std::size_t(1), std::size_t(3), std::size_t(4096), wire.size() }) {
+        frame_decoder dec(f, 1024);
+        auto msgs = feed(dec, wire, chunk);
+        ASSERT_EQ(msgs.size(), 4u) << "chunk=" << chunk;
+        EXPECT_EQ(msgs[0], "hello");
+        EXPECT_EQ(msgs[1], binary);
+        EXPECT_TRUE(msgs[2].empty());
+        EXPECT_EQ(msgs[3].size(), 50000u);
+        EXPECT_EQ(dec.buffered(), 0u);
+    }
+}
+
+TEST(tcp_framing, LengthPrefixLittleEndianAndTwoBytes) {
+    const framing f = framing::length_prefix(2, false);
+    std::string wire;
+    f.encode(wire, "abc");
+    EXPECT_EQ(wire, std::string("\x03\x00" "abc", 5));
+
+    frame_decoder dec(f);
+    auto msgs = feed(dec, wire, 2);
+    ASSERT_EQ(msgs.size(), 1u);
+    EXPECT_EQ(msgs[0], "abc");
+}
+
+TEST(tcp_framing, DelimiterSplitAcrossReads) {
+    const framing f = framing::delimited("\r\n");
+    const std::string wire = "first\r\nsecond\r\n\r\nthird";
+
+    frame_decoder dec(f, 16);
+    auto msgs = feed(dec, wire, 1);
+    ASSERT_EQ(msgs.size(), 3u);
+    EXPECT_EQ(msgs[0], "first");
+    EXPECT_EQ(msgs[1], "second");
+    EXPECT_EQ(msgs[2], "");
+    EXPECT_EQ(dec.buffered(), 5u); // "third" 는 구분자를 기다림
+}
+
+TEST(tcp_framing, FixedSize) {
+    frame_decoder dec(framing::fixed(4));
+    auto msgs = feed(dec, std::string("abcd\0\0\0\x01" "xy", 10), 3);
+    ASSERT_EQ(msgs.size(), 2u);
+    EXPECT_EQ(msgs[0], "abcd");
+    EXPECT_EQ(msgs[1], std::string("\0\0\0\x01", 4));
+    EXPECT_EQ(dec.buffered(), 2u);
+}
+
+TEST(tcp_framing, OversizedMessageIsError) {
+    framing f = framing::length_prefix(4);
+    f.max_message_size = 100;
+    std::string wire;
+    f.encode(wire, std::string(101, 'x'));
+
+    frame_decoder dec(f);
+    bool error = false;
+    auto msgs = feed(dec, wire, wire.size(), &error);
+    EXPECT_TRUE(msgs.empty());
+    EXPECT_TRUE(error);
+
+    framing d = framing::delimited("\n");
+    d.max_message_size = 10;
+    frame_decoder dec2(d);
+    error = false;
+    feed(dec2, std::string(64, 'y'), 8, &error);
+    EXPECT_TRUE(error);
+}
+
+TEST(tcp_framing, BufferIsReused) {
+    frame_decoder dec(framing::length_prefix(4), 256);
+    std::string wire;
+    framing::length_prefix(4).encode(wire, std::string(100, 'z'));
+
+    feed(dec, wire, 37); // 최초 성장 이후에는 같은 크기로 재사용
+    const std::size_t cap = dec.capacity();
+    for (int i = 0; i < 100; ++i) {
+        feed(dec, wire, 37);
+    }
+    EXPECT_EQ(dec.capacity(), cap);
+}
+
+#ifdef __linux__
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+namespace {
+
+    using j2::network::tcp::tcp_server;
+    using j2_test::test_server;
+    using j2_test::wait_until;
+
+    // 클라이언트가 보낸 길이 접두 메시지를 서버가 그대로 되돌려 보내고 클라이언트가 메시지 단위로 받는다
+    void run_echo(tcp_server::Backend backend) {
+        const framing f = framing::length_prefix(4);
+
+        test_server server;
+        server.setBackend(backend);
+        server.setFraming(f);
+        std::mutex mu;
+        std::vector<std::string> serverGot;
+        server.setOnMessageCallback([&](int fd, std::string_view msg) {
+            {
+                std::lock_guard<std::mutex> lock(mu);
+                serverGot.emplace_back(msg);
+            }
+            std::string out;
+            f.encode(out, msg);
+            server.sendToClient(fd, out);
+            });
+        ASSERT_EQ(server.start("127.0.0.1", 0), tcp_server::StartResult::Success);
+
+        j2::network::tcp::tcp_client client;
+        client.setServer("127.0.0.1", server.port());
+        client.set_framing(f);
+        std::vector<std::string> clientGot;
+        client.set_on_message([&](std::string_view msg) {
+            std::lock_guard<std::mutex> lock(mu);
+            clientGot.emplace_back(msg);
+            });
+        ASSERT_TRUE(client.start(std::chrono::seconds(0)));
+        ASSERT_TRUE(wait_until([&] { return client.is_connected() && server.getClientCount() == 1; }));
+
+        const std::vector<std::string> sent = {
+            "one", std::string("t\0w\0o", 5), std::string(20000, 'b'), "" };
+        std::string wire;
+        for (const auto& m : sent) f.encode(wire, m);
+        ASSERT_EQ(client.send_data(wire), static_cast<int>(wire.size()));
+
+        ASSERT_TRUE(wait_until([&] {
+            std::lock_guard<std::mutex> lock(mu);
+            return clientGot.size() == sent.size();
+            }));
+        std::lock_guard<std::mutex> lock(mu);
+        EXPECT_EQ(serverGot, sent);
+        EXPECT_EQ(clientGot, sent);
+
+        client.stop();
+        server.quit();
+    }
+
+} // namespace
+
+TEST(tcp_framing, ThreadBackendEcho) {
+    run_echo(tcp_server::Backend::Thread);
+}
+
+TEST(tcp_framing, EpollBackendEcho) {
+    run_echo(tcp_server::Backend::Epoll);
+}
+
+#endif // __linux__
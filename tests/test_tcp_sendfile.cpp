@@ -0,0 +1,171 @@
+// 파일: test_tcp_sendfile.cpp
+// 목적: j2::network::tcp::tcp_server::sendFileToClient 동작을 GoogleTest로 검증
+// - 파일 전체/일부(offset, length)를 정확히 전송하는지 (Thread/Epoll 백엔드)
+// - Epoll 백엔드에서 큰 파일이 즉시 반환되고 앞뒤 sendToClient 와 순서가 유지되는지
+// - 잘못된 범위/경로는 -1 을 반환하는지
+// - Thread 백엔드에서 SO_SNDTIMEO 가 지나면 재시도하며 멈춰 있지 않고 실패하는지
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <fstream>
+#include <filesystem>
+
+#include "gtest_compat.hpp"
+#include "net_test_util.hpp"
+#include "j2_library/network/network.hpp"
+
+#ifdef __linux__
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+    using j2::network::tcp::tcp_server;
+    namespace fs = std::filesystem;
+    using j2_test::test_server;
+    using j2_test::connect_to;
+    using j2_test::read_exactly;
+    using j2_test::wait_until;
+
+    class TcpSendFile : public ::testing::TestWithParam<tcp_server::Backend> {
+    protected:
+        void SetUp() override {
+            path = fs::temp_directory_path() / ("j2_sendfile_" + std::to_string(::getpid()) + ".bin");
+            content.resize(8 * 1024 * 1024);
+            std::uint32_t x = 12345;
+            for (auto& ch : content) {
+                x = x * 1103515245u + 12345u;
+                ch = static_cast<char>(x >> 24);
+            }
+            std::ofstream(path, std::ios::binary).write(content.data(), static_cast<std::streamsize>(content.size()));
+
+            server.setBackend(GetParam());
+            ASSERT_EQ(server.start("127.0.0.1", 0), tcp_server::StartResult::Success);
+            client = connect_to(server.port());
+            ASSERT_GE(client, 0);
+            ASSERT_TRUE(wait_until([&] { return server.getClientCount() == 1; }));
+            serverFd = server.getClientSockets().front();
+        }
+
+        void TearDown() override {
+            server.quit();
+            if (client >= 0) ::close(client);
+            std::error_code ec;
+            fs::remove(path, ec);
+        }
+
+        fs::path path;
+        std::string content;
+        test_server server;
+        int client = -1;
+        int serverFd = -1;
+    };
+
+} // namespace
+
+TEST_P(TcpSendFile, WholeFileInOrderWithOtherSends) {
+    // Thread 백엔드는 전송이 끝날 때까지 막히므로 별도 스레드에서 읽음
+    std::string got;
+    std::thread reader([&] { got = read_exactly(client, 3 + content.size() + 3); });
+
+    ASSERT_EQ(server.sendToClient(serverFd, "HDR"), 3);
+    EXPECT_EQ(server.sendFileToClient(serverFd, path.string()), static_cast<std::int64_t>(content.size()));
+    ASSERT_EQ(server.sendToClient(serverFd, "END"), 3);
+
+    reader.join();
+    ASSERT_EQ(got.size(), content.size() + 6);
+    EXPECT_EQ(got.substr(0, 3), "HDR");
+    EXPECT_TRUE(got.compare(3, content.size(), content) == 0);
+    EXPECT_EQ(got.substr(3 + content.size()), "END");
+    EXPECT_TRUE(wait_until([&] { return server.getQueuedBytes(serverFd) == 0; }));
+}
+
+TEST_P(TcpSendFile, RangeFromDescriptor) {
+    int fd = ::open(path.string().c_str(), O_RDONLY);
+    ASSERT_GE(fd, 0);
+
+    std::string got;
+    std::thread reader([&] { got = read_exactly(client, 100000); });
+    EXPECT_EQ(server.sendFileToClient(serverFd, fd, 12345, 100000), 100000);
+    ::close(fd); // 서버가 자신의 복제본을 사용
+    reader.join();
+    EXPECT_EQ(got, content.substr(12345, 100000));
+}
+
+TEST_P(TcpSendFile, InvalidArguments) {
+    EXPECT_EQ(server.sendFileToClient(serverFd, path.string() + ".missing"), -1);
+    EXPECT_EQ(server.sendFileToClient(serverFd, path.string(), content.size() + 1), -1);
+    EXPECT_EQ(server.sendFileToClient(serverFd, path.string(), content.size()), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends, TcpSendFile,
+    ::testing::Values(tcp_server::Backend::Thread, tcp_server::Backend::Epoll));
+
+TEST(tcp_sendfile, EpollReturnsBeforeSlowClientReads) {
+    test_server server;
+    server.setBackend(tcp_server::Backend::Epoll);
+    ASSERT_EQ(server.start("127.0.0.1", 0), tcp_server::StartResult::Success);
+    int client = connect_to(server.port());
+    ASSERT_GE(client, 0);
+    ASSERT_TRUE(wait_until([&] { return server.getClientCount() == 1; }));
+    const int serverFd = server.getClientSockets().front();
+
+    const fs::path path = fs::temp_directory_path() / ("j2_sendfile_big_" + std::to_string(::getpid()) + ".bin");
+    {
+        std::ofstream out(path, std::ios::binary);
+        std::string block(1024 * 1024, 'f');
+        for (int i = 0; i < 32; ++i) out.write(block.data(), static_cast<std::streamsize>(block.size()));
+    }
+
+    // 클라이언트가 읽지 않아도 즉시 반환하고 나머지는 큐에 남음
+    const auto t0 = std::chrono::steady_clock::now();
+    EXPECT_EQ(server.sendFileToClient(serverFd, path.string()), 32 * 1024 * 1024);
+    EXPECT_LT(std::chrono::steady_clock::now() - t0, std::chrono::seconds(1));
+    EXPECT_GT(server.getQueuedBytes(serverFd), 0u);
+
+    std::string got = read_exactly(client, 32u * 1024u * 1024u);
+    EXPECT_EQ(got.size(), 32u * 1024u * 1024u);
+    EXPECT_TRUE(wait_until([&] { return server.getQueuedBytes(serverFd) == 0; }));
+
+    server.quit();
+    ::close(client);
+    std::error_code ec;
+    fs::remove(path, ec);
+}
+
+TEST(tcp_sendfile, ThreadBackendFailsOnSendTimeout) {
+    test_server server;
+    server.setBackend(tcp_server::Backend::Thread);
+    ASSERT_EQ(server.start("127.0.0.1", 0), tcp_server::StartResult::Success);
+    int client = connect_to(server.port());
+    ASSERT_GE(client, 0);
+    ASSERT_TRUE(wait_until([&] { return server.getClientCount() == 1; }));
+    const int serverFd = server.getClientSockets().front();
+    timeval tv{ 0, 200 * 1000 };
+    ASSERT_EQ(::setsockopt(serverFd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv)), 0);
+
+    const fs::path path = fs::temp_directory_path() / ("j2_sendfile_timeout_" + std::to_string(::getpid()) + ".bin");
+    {
+        std::ofstream out(path, std::ios::binary);
+        std::string block(1024 * 1024, 't');
+        for (int i = 0; i < 64; ++i) out.write(block.data(), static_cast<std::streamsize>(block.size()));
+    }
+
+    // 클라이언트가 읽지 않으면 소켓 버퍼가 찬 뒤 송신 타임아웃으로 실패
+    const auto t0 = std::chrono::steady_clock::now();
+    EXPECT_EQ(server.sendFileToClient(serverFd, path.string()), -1);
+    EXPECT_LT(std::chrono::steady_clock::now() - t0, std::chrono::seconds(3));
+
+    server.quit();
+    ::close(client);
+    std::error_code ec;
+    fs::remove(path, ec);
+}
+
+#endif // __linux__
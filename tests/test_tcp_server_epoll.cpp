@@ -0,0 +1,240 @@
+// 파일: test_tcp_server_epoll.cpp
+// 목적: j2::network::tcp::tcp_server 의 epoll 백엔드 동작을 GoogleTest로 검증
+// - 여러 클라이언트 접속 시 on_connect 호출과 클라이언트 수 집계
+// - on_receive 로 받은 데이터를 sendToClient 로 되돌려 보내는지 (echo)
+// - 클라이언트 종료 시 on_close 호출 및 목록 제거, quit() 이 멈추지 않는지
+// - 읽지 않는 느린 클라이언트가 있어도 전송/브로드캐스트가 막히지 않고 (송신 큐)
+//   high watermark 초과 시 Reject/Disconnect 정책대로 동작하는지
+// - SO_REUSEPORT 분산 수락 시 여러 루프가 접속을 나누어 받는지
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <set>
+#include <mutex>
+
+#include "gtest_compat.hpp"
+#include "net_test_util.hpp"
+#include "j2_library/network/network.hpp"
+
+#ifdef __linux__
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+namespace {
+
+    using j2::network::tcp::tcp_server;
+    using j2_test::test_server;
+    using j2_test::connect_to;
+    using j2_test::wait_until;
+
+} // namespace
+
+TEST(tcp_server_epoll, EchoConnectAndClose) {
+    test_server server;
+    server.setBackend(tcp_server::Backend::Epoll, 2);
+
+    std::atomic<int> connects{ 0 };
+    std::atomic<int> closes{ 0 };
+    server.setOnConnectCallback([&](int, const std::string&) { ++connects; });
+    server.setOnCloseCallback([&](int, const std::string&) { ++closes; });
+    server.setOnReceiveCallback([&](int fd, const std::string& msg) {
+        server.sendToClient(fd, msg); // echo
+        });
+
+    ASSERT_EQ(server.start("127.0.0.1", 0), tcp_server::StartResult::Success);
+    const std::uint16_t port = server.port();
+    ASSERT_NE(port, 0);
+
+    const int count = 8;
+    std::vector<int> clients;
+    for (int i = 0; i < count; ++i) {
+        int fd = connect_to(port);
+        ASSERT_GE(fd, 0);
+        clients.push_back(fd);
+    }
+    ASSERT_TRUE(wait_until([&] { return server.getClientCount() == static_cast<std::size_t>(count); }));
+    EXPECT_EQ(connects.load(), count);
+
+    for (int i = 0; i < count; ++i) {
+        const std::string msg = "hello-" + std::to_string(i);
+        ASSERT_EQ(::send(clients[i], msg.data(), msg.size(), 0), static_cast<ssize_t>(msg.size()));
+
+        std::string got;
+        char buf[64];
+        while (got.size() < msg.size()) {
+            ssize_t n = ::recv(clients[i], buf, sizeof(buf), 0);
+            if (n <= 0) break;
+            got.append(buf, static_cast<std::size_t>(n));
+        }
+        EXPECT_EQ(got, msg);
+    }
+
+    // 절반은 클라이언트 쪽에서 종료
+    for (int i = 0; i < count / 2; ++i) {
+        ::close(clients[i]);
+    }
+    ASSERT_TRUE(wait_until([&] { return closes.load() == count / 2; }));
+    EXPECT_EQ(server.getClientCount(), static_cast<std::size_t>(count - count / 2));
+
+    // 서버 쪽에서 종료 (소유 루프가 on_close 를 호출)
+    server.closeClient(server.getClientSockets().front());
+    ASSERT_TRUE(wait_until([&] { return closes.load() == count / 2 + 1; }));
+
+    server.quit();
+    EXPECT_EQ(server.getClientCount(), 0u);
+    for (int i = count / 2; i < count; ++i) {
+        ::close(clients[i]);
+    }
+}
+
+TEST(tcp_server_epoll, SlowClientDoesNotBlockBroadcast) {
+    test_server server;
+    server.setBackend(tcp_server::Backend::Epoll);
+    server.setSendQueueLimit(1024 * 1024, tcp_server::Overflow::Reject);
+    ASSERT_EQ(server.start("127.0.0.1", 0), tcp_server::StartResult::Success);
+
+    int slow = connect_to(server.port()); // 읽지 않음
+    int fast = connect_to(server.port());
+    ASSERT_GE(slow, 0);
+    ASSERT_GE(fast, 0);
+    ASSERT_TRUE(wait_until([&] { return server.getClientCount() == 2; }));
+
+    // fast 클라이언트는 별도 스레드에서 계속 읽음
+    std::atomic<std::size_t> fastBytes{ 0 };
+    std::thread reader([&] {
+        char buf[65536];
+        ssize_t n;
+        while ((n = ::recv(fast, buf, sizeof(buf), 0)) > 0) fastBytes += static_cast<std::size_t>(n);
+        });
+
+    // 서버 쪽 소켓을 클라이언트 포트로 구분
+    auto local_port = [](int fd, bool peer) {
+        sockaddr_in addr{};
+        socklen_t len = sizeof(addr);
+        if (peer) ::getpeername(fd, reinterpret_cast<sockaddr*>(&addr), &len);
+        else ::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len);
+        return ntohs(addr.sin_port);
+    };
+    int slowServerFd = -1;
+    int fastServerFd = -1;
+    for (int fd : server.getClientSockets()) {
+        if (local_port(fd, true) == local_port(slow, false)) slowServerFd = fd;
+        if (local_port(fd, true) == local_port(fast, false)) fastServerFd = fd;
+    }
+    ASSERT_NE(slowServerFd, -1);
+    ASSERT_NE(fastServerFd, -1);
+
+    const std::string payload(64 * 1024, 'p');
+    const int rounds = 200; // 12.8 MB: 소켓 버퍼 + 1 MB 큐를 넘김
+    int slowFailures = 0;
+    int fastFailures = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; ++i) {
+        for (int fd : server.broadcastToClients(payload)) {
+            if (fd == slowServerFd) ++slowFailures;
+            if (fd == fastServerFd) ++fastFailures;
+        }
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - t0, std::chrono::seconds(2));
+    EXPECT_GT(slowFailures, 0);
+
+    // Reject 는 연결을 유지하고 큐는 한도를 넘지 않음
+    EXPECT_EQ(server.getClientCount(), 2u);
+    EXPECT_GT(server.getQueuedBytes(slowServerFd), 0u);
+    EXPECT_LE(server.getQueuedBytes(slowServerFd), 1024u * 1024u);
+
+    // fast 는 거절되지 않은 메시지를 모두 받음
+    const std::size_t expected = static_cast<std::size_t>(rounds - fastFailures) * payload.size();
+    ASSERT_TRUE(wait_until([&] { return fastBytes.load() == expected; }));
+
+    // fast 가 비운 뒤에는 fast 만 다시 받음 (slow 의 큐와 무관)
+    auto failed = server.broadcastToClients(payload);
+    ASSERT_EQ(failed.size(), 1u);
+    EXPECT_EQ(failed[0], slowServerFd);
+    ASSERT_TRUE(wait_until([&] { return fastBytes.load() == expected + payload.size(); }));
+
+    server.quit();
+    reader.join();
+    ::close(slow);
+    ::close(fast);
+}
+
+TEST(tcp_server_epoll, SlowClientIsDisconnected) {
+    test_server server;
+    server.setBackend(tcp_server::Backend::Epoll);
+    server.setSendQueueLimit(256 * 1024, tcp_server::Overflow::Disconnect);
+    std::atomic<int> closes{ 0 };
+    server.setOnCloseCallback([&](int, const std::string&) { ++closes; });
+    ASSERT_EQ(server.start("127.0.0.1", 0), tcp_server::StartResult::Success);
+
+    int slow = connect_to(server.port());
+    ASSERT_GE(slow, 0);
+    ASSERT_TRUE(wait_until([&] { return server.getClientCount() == 1; }));
+    const int fd = server.getClientSockets().front();
+
+    auto shared = std::make_shared<const std::string>(64 * 1024, 'q');
+    int result = 0;
+    for (int i = 0; i < 200 && result >= 0; ++i) {
+        result = server.sendToClient(fd, shared);
+    }
+    EXPECT_LT(result, 0);
+    ASSERT_TRUE(wait_until([&] { return closes.load() == 1; }));
+    EXPECT_EQ(server.getClientCount(), 0u);
+
+    server.quit();
+    ::close(slow);
+}
+
+TEST(tcp_server_epoll, AcceptShardingSpreadsConnections) {
+    test_server server;
+    server.setBackend(tcp_server::Backend::Epoll, 4);
+    server.setAcceptSharding(true, false);
+
+    std::mutex mu;
+    std::set<std::thread::id> acceptingLoops;
+    server.setOnConnectCallback([&](int, const std::string&) {
+        std::lock_guard<std::mutex> lock(mu);
+        acceptingLoops.insert(std::this_thread::get_id());
+        });
+    server.setOnReceiveCallback([&](int fd, const std::string& msg) { server.sendToClient(fd, msg); });
+    ASSERT_EQ(server.start("127.0.0.1", 0), tcp_server::StartResult::Success);
+
+    const int count = 64;
+    std::vector<int> clients;
+    for (int i = 0; i < count; ++i) {
+        int fd = connect_to(server.port());
+        ASSERT_GE(fd, 0);
+        clients.push_back(fd);
+    }
+    ASSERT_TRUE(wait_until([&] { return server.getClientCount() == static_cast<std::size_t>(count); }));
+    {
+        std::lock_guard<std::mutex> lock(mu);
+        EXPECT_GT(acceptingLoops.size(), 1u); // 커널이 4 개 리스너에 분산
+    }
+
+    // 어느 루프가 받았든 echo 는 동작
+    char buf[8];
+    ASSERT_EQ(::send(clients.back(), "ping", 4, 0), 4);
+    ASSERT_EQ(::recv(clients.back(), buf, sizeof(buf), MSG_WAITALL), 4);
+    EXPECT_EQ(std::string(buf, 4), "ping");
+
+    server.quit();
+    for (int fd : clients) ::close(fd);
+}
+
+TEST(tcp_server_epoll, ThreadBackendQuitDoesNotBlock) {
+    test_server server;
+    ASSERT_EQ(server.start("127.0.0.1", 0), tcp_server::StartResult::Success);
+
+    const auto t0 = std::chrono::steady_clock::now();
+    server.quit();
+    EXPECT_LT(std::chrono::steady_clock::now() - t0, std::chrono::seconds(1));
+}
+
+#endif // __linux__
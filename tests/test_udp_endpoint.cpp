@@ -0,0 +1,145 @@
+// 파일: test_udp_endpoint.cpp
+// 목적: j2::network::udp::udp_endpoint 와 udp_sender 의 목적지 캐시를 GoogleTest로 검증
+// - 숫자 주소/호스트 이름은 해석되고 잘못된 주소는 invalid 인지
+// - udp_endpoint 로 보내기와 여러 목적지로의 fan-out 이 모두 도착하는지
+// - 캐시 용량보다 많은 목적지를 번갈아 보내도(축출/재사용) 올바른 곳으로 가는지
+// - 문자열 목적지는 숫자 주소만 받고 호스트 이름은 udp_endpoint 로 보내는지
+
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "gtest_compat.hpp"
+#include "j2_library/network/network.hpp"
+
+#ifdef __linux__
+
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+namespace {
+
+    using j2::network::udp::udp_sender;
+    using j2::network::udp::udp_endpoint;
+    using j2::network::udp::send_buffer;
+
+    // 루프백에 바인드된 수신 소켓
+    struct sink {
+        int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+        std::uint16_t port = 0;
+
+        sink() {
+            timeval tv{ 2, 0 };
+            ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+            sockaddr_in addr{};
+            addr.sin_family = AF_INET;
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            ::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+            socklen_t len = sizeof(addr);
+            ::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len);
+            port = ntohs(addr.sin_port);
+        }
+        ~sink() { ::close(fd); }
+
+        std::string receive() {
+            char buf[2048];
+            ssize_t n = ::recv(fd, buf, sizeof(buf), 0);
+            return n < 0 ? std::string("<timeout>") : std::string(buf, static_cast<std::size_t>(n));
+        }
+    };
+
+} // namespace
+
+TEST(udp_endpoint, Resolves) {
+    udp_endpoint v4("127.0.0.1", 9000);
+    EXPECT_TRUE(v4.valid());
+    EXPECT_EQ(v4.family(), AF_INET);
+    EXPECT_EQ(v4.size(), static_cast<socklen_t>(sizeof(sockaddr_in)));
+    EXPECT_EQ(ntohs(reinterpret_cast<const sockaddr_in*>(v4.data())->sin_port), 9000);
+
+    udp_endpoint v6("::1", 9000);
+    EXPECT_TRUE(v6.valid());
+    EXPECT_EQ(v6.family(), AF_INET6);
+
+    udp_endpoint host("localhost", 9001);
+    EXPECT_TRUE(host.valid());
+
+    EXPECT_FALSE(udp_endpoint().valid());
+    EXPECT_FALSE(udp_endpoint("", 9000).valid());
+    EXPECT_FALSE(udp_endpoint("999.1.1.1", 9000).valid());
+}
+
+TEST(udp_endpoint, SendToEndpointAndFanOut) {
+    sink a, b, c;
+    udp_sender sender;
+    sender.setServer("127.0.0.1", a.port);
+    ASSERT_TRUE(sender.create());
+
+    udp_endpoint to_b("127.0.0.1", b.port);
+    EXPECT_EQ(sender.send_data_to("direct", to_b), 6);
+    EXPECT_EQ(b.receive(), "direct");
+
+    std::vector<udp_endpoint> all = {
+        udp_endpoint("127.0.0.1", a.port),
+        udp_endpoint("127.0.0.1", b.port),
+        udp_endpoint("127.0.0.1", c.port),
+    };
+    const std::string payload = "fan-out";
+    EXPECT_EQ(sender.send_data_to_all(send_buffer{ payload.data(), payload.size() }, all), 3);
+    EXPECT_EQ(a.receive(), payload);
+    EXPECT_EQ(b.receive(), payload);
+    EXPECT_EQ(c.receive(), payload);
+
+    EXPECT_EQ(sender.send_data_to("x", udp_endpoint()), 0);
+}
+
+TEST(udp_endpoint, CacheEvictsAndStillDelivers) {
+    std::vector<std::unique_ptr<sink>> sinks;
+    for (int i = 0; i < 5; ++i) sinks.push_back(std::make_unique<sink>());
+
+    udp_sender sender;
+    sender.setServer("127.0.0.1", sinks[0]->port);
+    ASSERT_TRUE(sender.create());
+    sender.set_endpoint_cache_capacity(2); // 목적지 5 개 > 용량 2
+
+    for (int round = 0; round < 3; ++round) {
+        for (std::size_t i = 0; i < sinks.size(); ++i) {
+            const std::string msg = "r" + std::to_string(round) + "-" + std::to_string(i);
+            EXPECT_EQ(sender.send_data_to(msg, "127.0.0.1", sinks[i]->port), static_cast<ssize_t>(msg.size()));
+            EXPECT_EQ(sinks[i]->receive(), msg);
+        }
+    }
+
+    sender.set_endpoint_cache_capacity(0); // 캐시 끔
+    EXPECT_EQ(sender.send_data_to("nocache", "127.0.0.1", sinks[3]->port), 7);
+    EXPECT_EQ(sinks[3]->receive(), "nocache");
+    EXPECT_EQ(sender.send_data_to("bad", "", sinks[3]->port), 0);
+}
+
+TEST(udp_endpoint, StringOverloadTakesNumericAddressesOnly) {
+    sink s;
+    udp_sender sender;
+    sender.setServer("127.0.0.1", s.port);
+    ASSERT_TRUE(sender.create());
+
+    // 호스트 이름은 패킷마다 조회하지 않음 (실패도 캐시되어 두 번째는 다시 해석하지 않음)
+    EXPECT_EQ(sender.send_data_to("name", "localhost", s.port), 0);
+    EXPECT_EQ(sender.send_data_to("name", "localhost", s.port), 0);
+
+    // 호스트 이름은 udp_endpoint 로 한 번 해석해 사용
+    udp_endpoint host("localhost", s.port);
+    ASSERT_TRUE(host.valid());
+    if (host.family() == AF_INET) {
+        EXPECT_EQ(sender.send_data_to("host", host), 4);
+        EXPECT_EQ(s.receive(), "host");
+    }
+
+    // 다음 숫자 주소는 정상 전송
+    EXPECT_EQ(sender.send_data_to("ok", "127.0.0.1", s.port), 2);
+    EXPECT_EQ(s.receive(), "ok");
+}
+
+#endif // __linux__
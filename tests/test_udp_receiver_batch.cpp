@@ -0,0 +1,150 @@
+// 파일: test_udp_receiver_batch.cpp
+// 목적: j2::network::udp::udp_receiver 의 배치 수신(recvmmsg + 버퍼 풀) 동작을 GoogleTest로 검증
+// - 여러 데이터그램이 내용/순서/송신 주소 그대로 배치 콜백으로 전달되는지
+// - 풀 버퍼보다 큰 데이터그램은 truncated 로 표시되는지
+// - 기존 콜백 경로가 1024 바이트보다 큰 데이터그램을 자르지 않는지
+// - 수신이 없어도 quit() 이 멈추지 않는지
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+
+#include "gtest_compat.hpp"
+#include "net_test_util.hpp"
+#include "j2_library/network/network.hpp"
+
+#ifdef __linux__
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+namespace {
+
+    using j2::network::udp::udp_receiver;
+    using j2::network::udp::datagram_batch;
+    using j2_test::test_receiver;
+    using j2_test::wait_until;
+
+    struct sender {
+        int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+        sockaddr_in to{};
+
+        explicit sender(std::uint16_t port) {
+            to.sin_family = AF_INET;
+            to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            to.sin_port = htons(port);
+        }
+        ~sender() { ::close(fd); }
+
+        void send(const std::string& payload) {
+            ::sendto(fd, payload.data(), payload.size(), 0, reinterpret_cast<sockaddr*>(&to), sizeof(to));
+        }
+        std::uint16_t local_port() const {
+            sockaddr_in addr{};
+            socklen_t len = sizeof(addr);
+            ::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len);
+            return ntohs(addr.sin_port);
+        }
+    };
+
+} // namespace
+
+TEST(udp_receiver_batch, DeliversDatagramsInBatches) {
+    test_receiver receiver;
+    receiver.setBatchMode(16, udp_receiver::MAX_DATAGRAM_SIZE);
+
+    std::mutex mu;
+    std::vector<std::string> got;
+    std::vector<std::uint16_t> ports;
+    std::size_t batches = 0;
+    receiver.setOnBatchCallback([&](const datagram_batch& batch) {
+        std::lock_guard<std::mutex> lock(mu);
+        ++batches;
+        for (const auto& d : batch) {
+            EXPECT_FALSE(d.truncated);
+            got.emplace_back(reinterpret_cast<const char*>(d.data), d.size);
+            ASSERT_EQ(d.from.ss_family, AF_INET);
+            ports.push_back(ntohs(reinterpret_cast<const sockaddr_in&>(d.from).sin_port));
+        }
+        });
+    ASSERT_TRUE(receiver.startUnicast("127.0.0.1", 0));
+
+    sender s(receiver.port());
+    std::vector<std::string> sent;
+    for (int i = 0; i < 200; ++i) {
+        // 1024 바이트보다 큰 데이터그램 포함
+        std::string payload = "pkt-" + std::to_string(i) + "-" + std::string(static_cast<std::size_t>(i * 37 % 5000), 'x');
+        sent.push_back(payload);
+        s.send(payload);
+        if (i % 20 == 19) {
+            // 소켓 수신 버퍼가 넘치지 않도록 20 개씩 보냄
+            ASSERT_TRUE(wait_until([&] {
+                std::lock_guard<std::mutex> lock(mu);
+                return got.size() == sent.size();
+                }));
+        }
+    }
+
+    ASSERT_TRUE(wait_until([&] {
+        std::lock_guard<std::mutex> lock(mu);
+        return got.size() == sent.size();
+        }));
+    {
+        std::lock_guard<std::mutex> lock(mu);
+        EXPECT_EQ(got, sent);
+        EXPECT_LE(batches, sent.size());
+        for (auto p : ports) EXPECT_EQ(p, s.local_port());
+    }
+    receiver.quit();
+}
+
+TEST(udp_receiver_batch, MarksTruncatedDatagrams) {
+    test_receiver receiver;
+    receiver.setBatchMode(4, 512);
+    std::atomic<int> truncated{ 0 };
+    std::atomic<std::size_t> size{ 0 };
+    receiver.setOnBatchCallback([&](const datagram_batch& batch) {
+        for (const auto& d : batch) {
+            if (d.truncated) ++truncated;
+            size = d.size;
+        }
+        });
+    ASSERT_TRUE(receiver.startUnicast("127.0.0.1", 0));
+
+    sender s(receiver.port());
+    s.send(std::string(1000, 't'));
+    ASSERT_TRUE(wait_until([&] { return truncated.load() == 1; }));
+    EXPECT_EQ(size.load(), 512u);
+    receiver.quit();
+}
+
+TEST(udp_receiver_batch, LegacyCallbackKeepsLargeDatagrams) {
+    test_receiver receiver;
+    std::atomic<std::size_t> size{ 0 };
+    receiver.setOnReceiveCallback([&](const std::string& data, const std::string& ip, uint16_t) {
+        if (ip == "127.0.0.1") size = data.size();
+        });
+    ASSERT_TRUE(receiver.startUnicast("127.0.0.1", 0));
+
+    sender s(receiver.port());
+    s.send(std::string(4000, 'L'));
+    ASSERT_TRUE(wait_until([&] { return size.load() == 4000u; }));
+    receiver.quit();
+}
+
+TEST(udp_receiver_batch, QuitWithoutTraffic) {
+    test_receiver receiver;
+    receiver.setOnBatchCallback([](const datagram_batch&) {});
+    ASSERT_TRUE(receiver.startUnicast("127.0.0.1", 0));
+
+    const auto t0 = std::chrono::steady_clock::now();
+    receiver.quit();
+    EXPECT_LT(std::chrono::steady_clock::now() - t0, std::chrono::seconds(1));
+}
+
+#endif // __linux__
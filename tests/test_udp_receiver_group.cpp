@@ -0,0 +1,131 @@
+// 파일: test_udp_receiver_group.cpp
+// 목적: j2::network::udp::udp_receiver_group (SO_REUSEPORT 수신 그룹) 을 GoogleTest로 검증
+// - 여러 송신 소켓(서로 다른 플로)의 데이터그램이 빠짐없이 한 번씩, 여러 수신기로 나뉘어 도착하는지
+// - 같은 인덱스의 콜백은 항상 같은 스레드에서 호출되는지
+// - 스티어링 프로그램/배치 모드에서도 모두 도착하는지
+// - 이미 사용 중인 포트면 start 가 실패하고 아무것도 남지 않는지
+
+#include <string>
+#include <vector>
+#include <set>
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <thread>
+
+#include "gtest_compat.hpp"
+#include "net_test_util.hpp"
+#include "j2_library/network/network.hpp"
+
+#ifdef __linux__
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+namespace {
+
+    using j2::network::udp::udp_receiver_group;
+    using j2::network::udp::datagram_batch;
+    using j2_test::wait_until;
+
+    struct collected {
+        std::mutex mu;
+        std::multiset<std::string> payloads;
+        std::map<std::size_t, std::set<std::thread::id>> threads;
+
+        void add(std::size_t index, std::string payload) {
+            std::lock_guard<std::mutex> lock(mu);
+            payloads.insert(std::move(payload));
+            threads[index].insert(std::this_thread::get_id());
+        }
+        std::size_t count() {
+            std::lock_guard<std::mutex> lock(mu);
+            return payloads.size();
+        }
+    };
+
+    // 소켓마다 소스 포트가 달라서 플로 해시가 서로 다름
+    std::vector<std::string> send_from_many_sockets(std::uint16_t port, int sockets, int per_socket) {
+        sockaddr_in to{};
+        to.sin_family = AF_INET;
+        to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        to.sin_port = htons(port);
+
+        std::vector<std::string> sent;
+        for (int s = 0; s < sockets; ++s) {
+            int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+            for (int i = 0; i < per_socket; ++i) {
+                std::string payload = "s" + std::to_string(s) + "-" + std::to_string(i);
+                ::sendto(fd, payload.data(), payload.size(), 0, reinterpret_cast<sockaddr*>(&to), sizeof(to));
+                sent.push_back(payload);
+            }
+            ::close(fd);
+        }
+        return sent;
+    }
+
+} // namespace
+
+TEST(udp_receiver_group, SpreadsFlowsOverReceivers) {
+    udp_receiver_group group(4);
+    collected got;
+    group.setOnReceiveCallback([&](std::size_t index, const std::string& data, const std::string&, uint16_t) {
+        EXPECT_LT(index, 4u);
+        got.add(index, data);
+        });
+    ASSERT_TRUE(group.start("127.0.0.1", 0));
+    ASSERT_NE(group.getLocalPort(), 0);
+    EXPECT_EQ(group.size(), 4u);
+
+    auto sent = send_from_many_sockets(group.getLocalPort(), 32, 5);
+    ASSERT_TRUE(wait_until([&] { return got.count() == sent.size(); }));
+    group.quit();
+
+    EXPECT_EQ(got.payloads, std::multiset<std::string>(sent.begin(), sent.end()));
+    EXPECT_GT(got.threads.size(), 1u); // 32 개 플로가 한 소켓으로만 갈 확률은 사실상 0
+    for (const auto& [index, ids] : got.threads) {
+        EXPECT_EQ(ids.size(), 1u) << "receiver " << index;
+    }
+}
+
+TEST(udp_receiver_group, SteeringAndBatchModeDeliverEverything) {
+    for (auto steering : { udp_receiver_group::Steering::ReceivingCpu, udp_receiver_group::Steering::FlowHash }) {
+        udp_receiver_group group(3);
+        group.setSteering(steering);
+        group.setPinToCores(true);
+        group.setBatchMode(16);
+        collected got;
+        group.setOnBatchCallback([&](std::size_t index, const datagram_batch& batch) {
+            for (const auto& d : batch) {
+                got.add(index, std::string(reinterpret_cast<const char*>(d.data), d.size));
+            }
+            });
+        ASSERT_TRUE(group.start("127.0.0.1", 0));
+
+        auto sent = send_from_many_sockets(group.getLocalPort(), 8, 10);
+        ASSERT_TRUE(wait_until([&] { return got.count() == sent.size(); }));
+        group.quit();
+        EXPECT_EQ(got.payloads, std::multiset<std::string>(sent.begin(), sent.end()));
+    }
+}
+
+TEST(udp_receiver_group, FailsOnPortInUse) {
+    // SO_REUSEPORT 없이 먼저 바인드한 소켓
+    int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    socklen_t len = sizeof(addr);
+    ::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len);
+
+    udp_receiver_group group(2);
+    group.setOnReceiveCallback([](std::size_t, const std::string&, const std::string&, uint16_t) {});
+    EXPECT_FALSE(group.start("127.0.0.1", ntohs(addr.sin_port)));
+    EXPECT_EQ(group.getLocalPort(), 0);
+    ::close(fd);
+}
+
+#endif // __linux__
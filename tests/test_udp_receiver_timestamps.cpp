@@ -0,0 +1,117 @@
+// 파일: test_udp_receiver_timestamps.cpp
+// 목적: j2::network::udp::udp_receiver 의 커널 수신 타임스탬프(SO_TIMESTAMPNS) 를 GoogleTest로 검증
+// - 타임스탬프 콜백이 송신 시각 이후, 콜백 시각 이전의 커널 수신 시각을 받는지 (루프백 단방향 지연)
+// - 배치 모드의 datagram.kernel_time 과 커널->콜백 지연 히스토그램이 채워지는지
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <cstdint>
+
+#include "gtest_compat.hpp"
+#include "net_test_util.hpp"
+#include "j2_library/network/network.hpp"
+
+#ifdef __linux__
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+namespace {
+
+    using j2::network::udp::udp_receiver;
+    using j2::network::udp::datagram_batch;
+    using clock_type = std::chrono::system_clock;
+    using j2_test::wait_until;
+
+    std::int64_t now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now().time_since_epoch()).count();
+    }
+
+    // 페이로드 = 송신 시각(ns) 문자열
+    void send_stamped(std::uint16_t port, int count) {
+        int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+        sockaddr_in to{};
+        to.sin_family = AF_INET;
+        to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        to.sin_port = htons(port);
+        for (int i = 0; i < count; ++i) {
+            const std::string payload = std::to_string(now_ns());
+            ::sendto(fd, payload.data(), payload.size(), 0, reinterpret_cast<sockaddr*>(&to), sizeof(to));
+        }
+        ::close(fd);
+    }
+
+} // namespace
+
+TEST(udp_receiver_timestamps, TimestampedCallbackGivesOneWayLatency) {
+    udp_receiver receiver;
+    receiver.setEnableKernelTimestamps(true);
+
+    std::mutex mu;
+    std::vector<std::int64_t> one_way_ns;
+    std::atomic<bool> ordered{ true };
+    receiver.setOnReceiveTimestampedCallback([&](const std::string& data, const std::string&, uint16_t,
+                                                 clock_type::time_point kernel_time) {
+        const std::int64_t sent = std::stoll(data);
+        const std::int64_t kernel = std::chrono::duration_cast<std::chrono::nanoseconds>(kernel_time.time_since_epoch()).count();
+        if (kernel < sent || kernel > now_ns()) ordered = false;
+        std::lock_guard<std::mutex> lock(mu);
+        one_way_ns.push_back(kernel - sent);
+        });
+    ASSERT_TRUE(receiver.startUnicast("127.0.0.1", 0));
+
+    send_stamped(receiver.getLocalPort(), 50);
+    ASSERT_TRUE(wait_until([&] {
+        std::lock_guard<std::mutex> lock(mu);
+        return one_way_ns.size() == 50;
+        }));
+    receiver.quit();
+
+    EXPECT_TRUE(ordered.load());
+    EXPECT_EQ(receiver.getKernelDelayHistogram().count(), 50u);
+    for (auto ns : one_way_ns) EXPECT_LT(ns, 1000000000); // 루프백에서 1초 미만
+}
+
+TEST(udp_receiver_timestamps, BatchModeFillsKernelTime) {
+    udp_receiver receiver;
+    receiver.setEnableKernelTimestamps(true);
+    receiver.setBatchMode(8);
+    std::atomic<int> stamped{ 0 };
+    receiver.setOnBatchCallback([&](const datagram_batch& batch) {
+        for (const auto& d : batch) {
+            if (d.kernel_time.time_since_epoch().count() != 0) ++stamped;
+        }
+        });
+    ASSERT_TRUE(receiver.startUnicast("127.0.0.1", 0));
+
+    send_stamped(receiver.getLocalPort(), 30);
+    ASSERT_TRUE(wait_until([&] { return stamped.load() == 30; }));
+    receiver.quit();
+
+    const auto& h = receiver.getKernelDelayHistogram();
+    EXPECT_EQ(h.count(), 30u);
+    EXPECT_LE(h.percentile(0.5), h.max());
+    receiver.resetKernelDelayHistogram();
+    EXPECT_EQ(receiver.getKernelDelayHistogram().count(), 0u);
+}
+
+TEST(udp_receiver_timestamps, PlainCallbackStillCalled) {
+    udp_receiver receiver;
+    receiver.setEnableKernelTimestamps(true);
+    std::atomic<int> got{ 0 };
+    receiver.setOnReceiveCallback([&](const std::string&, const std::string& ip, uint16_t) {
+        if (ip == "127.0.0.1") ++got;
+        });
+    ASSERT_TRUE(receiver.startUnicast("127.0.0.1", 0));
+    send_stamped(receiver.getLocalPort(), 5);
+    ASSERT_TRUE(wait_until([&] { return got.load() == 5; }));
+    receiver.quit();
+}
+
+#endif // __linux__
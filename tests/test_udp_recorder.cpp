@@ -0,0 +1,182 @@
+// 파일: test_udp_recorder.cpp
+// 목적: j2::network::udp::udp_recorder / udp_recording / udp_replayer 를 GoogleTest로 검증
+// - 수신기에 붙인 recorder 가 내용/송신 주소/시각을 파일에 남기고 다시 읽히는지
+// - 최대 속도 재생 시 모든 데이터그램이 순서대로 도착하는지
+// - 원래 간격/배속 재생이 기록된 시간 간격을 따르는지
+// - 잘못된 파일은 열리지 않는지
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <filesystem>
+#include <fstream>
+
+#include "gtest_compat.hpp"
+#include "net_test_util.hpp"
+#include "j2_library/network/network.hpp"
+
+#ifdef __linux__
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+namespace {
+
+    namespace fs = std::filesystem;
+    using namespace j2::network::udp;
+    using j2_test::wait_until;
+
+    fs::path temp_file(const std::string& name) {
+        return fs::temp_directory_path() / ("j2_test_udp_recorder_" + name + "_" + std::to_string(::getpid()) + ".j2rec");
+    }
+
+    sockaddr_storage loopback(std::uint16_t port) {
+        sockaddr_storage ss{};
+        auto& a = reinterpret_cast<sockaddr_in&>(ss);
+        a.sin_family = AF_INET;
+        a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        a.sin_port = htons(port);
+        return ss;
+    }
+
+    // 10ms 간격의 데이터그램 count 개를 기록한 파일
+    fs::path write_spaced_recording(const std::string& name, int count) {
+        const auto path = temp_file(name);
+        udp_recorder recorder;
+        EXPECT_TRUE(recorder.open(path.string()));
+        const auto t0 = std::chrono::system_clock::now();
+        for (int i = 0; i < count; ++i) {
+            const std::string payload = "p" + std::to_string(i);
+            recorder.record(payload.data(), payload.size(), loopback(1000), t0 + std::chrono::milliseconds(10 * i));
+        }
+        recorder.close();
+        return path;
+    }
+
+    struct collecting_receiver {
+        udp_receiver receiver;
+        std::mutex mu;
+        std::vector<std::string> got;
+
+        collecting_receiver() {
+            receiver.setOnReceiveCallback([this](const std::string& data, const std::string&, uint16_t) {
+                std::lock_guard<std::mutex> lock(mu);
+                got.push_back(data);
+                });
+            EXPECT_TRUE(receiver.startUnicast("127.0.0.1", 0));
+        }
+        std::size_t count() {
+            std::lock_guard<std::mutex> lock(mu);
+            return got.size();
+        }
+    };
+
+} // namespace
+
+TEST(udp_recorder, RecordsReceivedDatagrams) {
+    const auto path = temp_file("capture");
+    udp_recorder recorder;
+    ASSERT_TRUE(recorder.open(path.string()));
+
+    udp_receiver receiver;
+    receiver.setEnableKernelTimestamps(true);
+    recorder.attach(receiver);
+    ASSERT_TRUE(receiver.startUnicast("127.0.0.1", 0));
+
+    int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+    auto to = loopback(receiver.getLocalPort());
+    std::vector<std::string> sent;
+    for (int i = 0; i < 50; ++i) {
+        std::string payload = "datagram-" + std::to_string(i) + std::string(static_cast<std::size_t>(i), '#');
+        ::sendto(fd, payload.data(), payload.size(), 0, reinterpret_cast<sockaddr*>(&to), sizeof(sockaddr_in));
+        sent.push_back(payload);
+    }
+    sockaddr_in local{};
+    socklen_t len = sizeof(local);
+    ::getsockname(fd, reinterpret_cast<sockaddr*>(&local), &len);
+
+    ASSERT_TRUE(wait_until([&] { return recorder.count() == sent.size(); }));
+    receiver.quit();
+    recorder.close();
+    ::close(fd);
+
+    udp_recording recording;
+    ASSERT_TRUE(recording.open(path.string()));
+    ASSERT_EQ(recording.size(), sent.size());
+    for (std::size_t i = 0; i < sent.size(); ++i) {
+        const auto& r = recording[i];
+        EXPECT_EQ(std::string(reinterpret_cast<const char*>(r.data), r.size), sent[i]);
+        EXPECT_EQ(r.from.ss_family, AF_INET);
+        EXPECT_EQ(reinterpret_cast<const sockaddr_in&>(r.from).sin_port, local.sin_port);
+        if (i > 0) { EXPECT_GE(r.time_ns, recording[i - 1].time_ns); }
+    }
+    recording.close();
+    fs::remove(path);
+}
+
+TEST(udp_recorder, ReplayAtMaxRate) {
+    const auto path = write_spaced_recording("maxrate", 200);
+    udp_recording recording;
+    ASSERT_TRUE(recording.open(path.string()));
+    EXPECT_EQ(recording.duration(), std::chrono::milliseconds(1990));
+
+    collecting_receiver sink;
+    udp_sender sender;
+    sender.setServer("127.0.0.1", sink.receiver.getLocalPort());
+    ASSERT_TRUE(sender.create());
+
+    const auto stats = udp_replayer(sender).replay(recording, { replay_mode::MaxRate, 1.0, 32, 1 });
+    EXPECT_EQ(stats.datagrams, 200u);
+    EXPECT_EQ(stats.failed, 0u);
+    EXPECT_LT(stats.seconds, 1.0); // 기록 시간(2초) 보다 훨씬 빠름
+
+    ASSERT_TRUE(wait_until([&] { return sink.count() == 200; }));
+    std::lock_guard<std::mutex> lock(sink.mu);
+    for (std::size_t i = 0; i < sink.got.size(); ++i) EXPECT_EQ(sink.got[i], "p" + std::to_string(i));
+    sink.receiver.quit();
+    recording.close();
+    fs::remove(path);
+}
+
+TEST(udp_recorder, ReplayFollowsRecordedTiming) {
+    const auto path = write_spaced_recording("timing", 11); // 100ms 분량
+    udp_recording recording;
+    ASSERT_TRUE(recording.open(path.string()));
+
+    collecting_receiver sink;
+    udp_sender sender;
+    sender.setServer("127.0.0.1", sink.receiver.getLocalPort());
+    ASSERT_TRUE(sender.create());
+    udp_replayer replayer(sender);
+
+    auto original = replayer.replay(recording, { replay_mode::OriginalTiming });
+    EXPECT_EQ(original.datagrams, 11u);
+    EXPECT_GE(original.seconds, 0.095);
+
+    auto scaled = replayer.replay(recording, { replay_mode::Scaled, 4.0 });
+    EXPECT_EQ(scaled.datagrams, 11u);
+    EXPECT_GE(scaled.seconds, 0.024);
+    EXPECT_LT(scaled.seconds, original.seconds);
+
+    ASSERT_TRUE(wait_until([&] { return sink.count() == 22; }));
+    sink.receiver.quit();
+    recording.close();
+    fs::remove(path);
+}
+
+TEST(udp_recorder, RejectsInvalidFiles) {
+    udp_recording recording;
+    EXPECT_FALSE(recording.open(temp_file("missing").string()));
+
+    const auto path = temp_file("garbage");
+    std::ofstream(path, std::ios::binary) << "definitely not a recording";
+    EXPECT_FALSE(recording.open(path.string()));
+    fs::remove(path);
+}
+
+#endif // __linux__